@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "first_touch.hpp"
+
+namespace {
+
+struct GridBatch
+{
+};
+struct GridX
+{
+};
+
+using IdxBatchX = Idx<GridBatch, GridX>;
+using IdxStepBatchX = IdxStep<GridBatch, GridX>;
+using IdxRangeBatchX = IdxRange<GridBatch, GridX>;
+
+using HostExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+/**
+ * A triad kernel (a = b + s * c) with the iteration mapping of the kernels acting on the
+ * distribution function (a parallel loop over the whole index range).
+ */
+void triad(
+        host_t<DFieldMem<IdxRangeBatchX>>& a_alloc,
+        host_t<DFieldMem<IdxRangeBatchX>> const& b_alloc,
+        host_t<DFieldMem<IdxRangeBatchX>> const& c_alloc)
+{
+    host_t<DField<IdxRangeBatchX>> const a = get_field(a_alloc);
+    host_t<DConstField<IdxRangeBatchX>> const b = get_const_field(b_alloc);
+    host_t<DConstField<IdxRangeBatchX>> const c = get_const_field(c_alloc);
+    ddc::parallel_for_each(HostExecSpace(), get_idx_range(a), [=](IdxBatchX const idx) {
+        a(idx) = b(idx) + 0.5 * c(idx);
+    });
+    Kokkos::fence();
+}
+
+IdxRangeBatchX get_idx_range_batch_x(benchmark::State const& state)
+{
+    return IdxRangeBatchX(IdxBatchX(0, 0), IdxStepBatchX(state.range(0), state.range(1)));
+}
+
+/// The triad kernel applied to fields which were first touched by a single thread.
+void triad_serial_first_touch(benchmark::State& state)
+{
+    IdxRangeBatchX const idx_range = get_idx_range_batch_x(state);
+    host_t<DFieldMem<IdxRangeBatchX>> a_alloc(idx_range);
+    host_t<DFieldMem<IdxRangeBatchX>> b_alloc(idx_range);
+    host_t<DFieldMem<IdxRangeBatchX>> c_alloc(idx_range);
+    host_t<DField<IdxRangeBatchX>> const a = get_field(a_alloc);
+    host_t<DField<IdxRangeBatchX>> const b = get_field(b_alloc);
+    host_t<DField<IdxRangeBatchX>> const c = get_field(c_alloc);
+    ddc::for_each(idx_range, [&](IdxBatchX const idx) {
+        a(idx) = 0.;
+        b(idx) = 1.;
+        c(idx) = 2.;
+    });
+    for (auto _ : state) {
+        triad(a_alloc, b_alloc, c_alloc);
+    }
+    state.SetBytesProcessed(state.iterations() * 3 * idx_range.size() * sizeof(double));
+}
+
+/// The triad kernel applied to fields which were first touched with first_touch.
+void triad_parallel_first_touch(benchmark::State& state)
+{
+    IdxRangeBatchX const idx_range = get_idx_range_batch_x(state);
+    host_t<DFieldMem<IdxRangeBatchX>> a_alloc(idx_range);
+    host_t<DFieldMem<IdxRangeBatchX>> b_alloc(idx_range);
+    host_t<DFieldMem<IdxRangeBatchX>> c_alloc(idx_range);
+    first_touch(HostExecSpace(), get_field(a_alloc), 0.);
+    first_touch(HostExecSpace(), get_field(b_alloc), 1.);
+    first_touch(HostExecSpace(), get_field(c_alloc), 2.);
+    for (auto _ : state) {
+        triad(a_alloc, b_alloc, c_alloc);
+    }
+    state.SetBytesProcessed(state.iterations() * 3 * idx_range.size() * sizeof(double));
+}
+
+} // namespace
+
+// The first argument is the number of rows, the second is the length of a row.
+// The fields must be much larger than the last level cache to measure the memory bandwidth.
+BENCHMARK(triad_serial_first_touch)->Args({256, 32768})->Args({1024, 32768})->UseRealTime();
+BENCHMARK(triad_parallel_first_touch)->Args({256, 32768})->Args({1024, 32768})->UseRealTime();
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+    ddc::ScopeGuard const ddc_scope(argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
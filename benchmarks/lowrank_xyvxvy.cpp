@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "lowranksplitvlasovsolver.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "splitvlasovsolver.hpp"
+#include "tensortrain.hpp"
+#include "workspace_arena.hpp"
+
+namespace {
+
+IdxRangeSpXYVxVy init_idx_range()
+{
+    // The discrete spaces can only be initialised once
+    static IdxRangeSpXYVxVy const idx_range = []() {
+        IdxStepX const x_ncells(32);
+        IdxStepY const y_ncells(32);
+        IdxStepVx const vx_ncells(31);
+        IdxStepVy const vy_ncells(31);
+        ddc::init_discrete_space<BSplinesX>(CoordX(0.0), CoordX(4.0 * M_PI), x_ncells);
+        ddc::init_discrete_space<BSplinesY>(CoordY(0.0), CoordY(4.0 * M_PI), y_ncells);
+        ddc::init_discrete_space<BSplinesVx>(CoordVx(-6.0), CoordVx(6.0), vx_ncells);
+        ddc::init_discrete_space<BSplinesVy>(CoordVy(-6.0), CoordVy(6.0), vy_ncells);
+        ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+        ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+        ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+        ddc::init_discrete_space<GridVy>(SplineInterpPointsVy::get_sampling<GridVy>());
+
+        IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(1));
+        host_t<DFieldMemSp> masses(idx_range_sp);
+        host_t<DFieldMemSp> charges(idx_range_sp);
+        masses(idx_range_sp.front()) = 1.0;
+        charges(idx_range_sp.front()) = -1.0;
+        ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+        return IdxRangeSpXYVxVy(
+                idx_range_sp,
+                SplineInterpPointsX::get_domain<GridX>(),
+                SplineInterpPointsY::get_domain<GridY>(),
+                SplineInterpPointsVx::get_domain<GridVx>(),
+                SplineInterpPointsVy::get_domain<GridVy>());
+    }();
+    return idx_range;
+}
+
+/// Initialise a Landau damping test case and the associated electric field.
+void init_landau(host_t<DFieldSpXYVxVy> allfdistribu, host_t<DFieldXY> electric_field)
+{
+    ddc::for_each(get_idx_range(allfdistribu), [&](IdxSpXYVxVy const ispxyvxvy) {
+        double const x = ddc::coordinate(ddc::select<GridX>(ispxyvxvy));
+        double const y = ddc::coordinate(ddc::select<GridY>(ispxyvxvy));
+        double const vx = ddc::coordinate(ddc::select<GridVx>(ispxyvxvy));
+        double const vy = ddc::coordinate(ddc::select<GridVy>(ispxyvxvy));
+        allfdistribu(ispxyvxvy) = std::exp(-0.5 * (vx * vx + vy * vy)) / (2.0 * M_PI)
+                                  * (1.0 + 0.01 * (std::cos(0.5 * x) + std::cos(0.5 * y)));
+    });
+    ddc::for_each(get_idx_range(electric_field), [&](IdxXY const ixy) {
+        double const x = ddc::coordinate(ddc::select<GridX>(ixy));
+        electric_field(ixy) = 0.02 * std::sin(0.5 * x);
+    });
+}
+
+void full_grid_split_vlasov_solver(benchmark::State& state)
+{
+    IdxRangeSpXYVxVy const idx_range = init_idx_range();
+    IdxRangeXYVxVy const mesh_xyvxvy(idx_range);
+    IdxRangeXY const mesh_xy(idx_range);
+
+    host_t<DFieldMemSpXYVxVy> allfdistribu_host(idx_range);
+    host_t<DFieldMemXY> electric_field_host(mesh_xy);
+    init_landau(get_field(allfdistribu_host), get_field(electric_field_host));
+    auto allfdistribu = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(allfdistribu_host));
+    auto electric_field = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(electric_field_host));
+
+    SplineXBuilder const builder_x(mesh_xyvxvy);
+    SplineYBuilder const builder_y(mesh_xyvxvy);
+    SplineVxBuilder const builder_vx(mesh_xyvxvy);
+    SplineVyBuilder const builder_vy(mesh_xyvxvy);
+
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    ddc::PeriodicExtrapolationRule<Y> bv_y_min;
+    ddc::PeriodicExtrapolationRule<Y> bv_y_max;
+    SplineYEvaluator const spline_y_evaluator(bv_y_min, bv_y_max);
+    PreallocatableSplineInterpolator const spline_y_interpolator(builder_y, spline_y_evaluator);
+
+    IdxRangeVx const mesh_vx(idx_range);
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_min(ddc::coordinate(mesh_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_max(ddc::coordinate(mesh_vx.back()));
+    SplineVxEvaluator const spline_vx_evaluator(bv_vx_min, bv_vx_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    IdxRangeVy const mesh_vy(idx_range);
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_min(ddc::coordinate(mesh_vy.front()));
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_max(ddc::coordinate(mesh_vy.back()));
+    SplineVyEvaluator const spline_vy_evaluator(bv_vy_min, bv_vy_max);
+    PreallocatableSplineInterpolator const spline_vy_interpolator(builder_vy, spline_vy_evaluator);
+
+    BslAdvectionSpatial<GeometryXYVxVy, GridX> const advection_x(spline_x_interpolator);
+    BslAdvectionSpatial<GeometryXYVxVy, GridY> const advection_y(spline_y_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, GridVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, GridVy> const advection_vy(spline_vy_interpolator);
+
+    SplitVlasovSolver const vlasov(advection_x, advection_y, advection_vx, advection_vy);
+
+    for (auto _ : state) {
+        vlasov(get_field(allfdistribu),
+               get_const_field(electric_field),
+               get_const_field(electric_field),
+               0.1);
+        Kokkos::fence();
+    }
+    // The peak memory of a step is reached during an advection. It holds the distribution
+    // function, the batched spline coefficients and the feet and derivatives allocated in the
+    // workspace arena.
+    std::size_t const spline_coefs_size = std::max(
+            {builder_x.batched_spline_domain().size(),
+             builder_y.batched_spline_domain().size(),
+             builder_vx.batched_spline_domain().size(),
+             builder_vy.batched_spline_domain().size()});
+    state.counters["memory_bytes"] = (allfdistribu.size() + spline_coefs_size) * sizeof(double)
+                                     + get_workspace_arena().high_water_mark();
+}
+
+void low_rank_split_vlasov_solver(benchmark::State& state)
+{
+    IdxRangeSpXYVxVy const idx_range = init_idx_range();
+    IdxRangeXY const mesh_xy(idx_range);
+
+    host_t<DFieldMemSpXYVxVy> allfdistribu_host(idx_range);
+    host_t<DFieldMemXY> electric_field_host(mesh_xy);
+    init_landau(get_field(allfdistribu_host), get_field(electric_field_host));
+
+    int const max_rank = state.range(0);
+    TensorTrainFdistribu allfdistribu(get_const_field(allfdistribu_host), 1e-8, max_rank);
+    // The full grid distribution function is only needed for the initialisation
+    allfdistribu_host = host_t<DFieldMemSpXYVxVy>();
+
+    LowRankSplitVlasovSolver const vlasov {IdxRangeXYVxVy(idx_range)};
+
+    for (auto _ : state) {
+        vlasov(allfdistribu,
+               get_const_field(electric_field_host),
+               get_const_field(electric_field_host),
+               0.1);
+    }
+    // The peak memory of a step includes the intermediate matrices of the advections and the
+    // workspace of the singular value decompositions
+    state.counters["memory_bytes"] = vlasov.peak_memory_bytes();
+}
+
+} // namespace
+
+BENCHMARK(full_grid_split_vlasov_solver)->Unit(benchmark::kMillisecond);
+BENCHMARK(low_rank_split_vlasov_solver)
+        ->Arg(4)
+        ->Arg(8)
+        ->Arg(16)
+        ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+    ddc::ScopeGuard const ddc_scope(argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "transpose.hpp"
+
+namespace {
+
+struct GridX
+{
+};
+struct GridY
+{
+};
+struct GridZ
+{
+};
+
+using IdxXYZ = Idx<GridX, GridY, GridZ>;
+using IdxStepXYZ = IdxStep<GridX, GridY, GridZ>;
+using IdxRangeXYZ = IdxRange<GridX, GridY, GridZ>;
+using IdxRangeXZY = IdxRange<GridX, GridZ, GridY>;
+
+IdxRangeXYZ get_idx_range_xyz(benchmark::State const& state)
+{
+    return IdxRangeXYZ(
+            IdxXYZ(0, 0, 0),
+            IdxStepXYZ(state.range(0), state.range(1), state.range(1)));
+}
+
+/// Report the bandwidth, taking into account one read and one write per element.
+void set_bandwidth(benchmark::State& state, std::size_t n_elements)
+{
+    state.SetBytesProcessed(state.iterations() * 2 * n_elements * sizeof(double));
+}
+
+/// A plain copy between two fields with the same layout.
+void copy(benchmark::State& state)
+{
+    IdxRangeXYZ const idx_range = get_idx_range_xyz(state);
+    DFieldMem<IdxRangeXYZ> start_alloc(idx_range);
+    DFieldMem<IdxRangeXYZ> end_alloc(idx_range);
+    ddc::parallel_fill(get_field(start_alloc), 1.0);
+    for (auto _ : state) {
+        ddc::parallel_deepcopy(get_field(end_alloc), get_const_field(start_alloc));
+        Kokkos::fence();
+    }
+    set_bandwidth(state, idx_range.size());
+}
+
+/// A transposition which copies the elements one by one.
+void transpose_elementwise(benchmark::State& state)
+{
+    IdxRangeXYZ const idx_range = get_idx_range_xyz(state);
+    DFieldMem<IdxRangeXYZ> start_alloc(idx_range);
+    DFieldMem<IdxRangeXZY> end_alloc(idx_range);
+    ddc::parallel_fill(get_field(start_alloc), 1.0);
+    for (auto _ : state) {
+        detail::transpose_layout_elementwise(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(end_alloc),
+                get_const_field(start_alloc));
+        Kokkos::fence();
+    }
+    set_bandwidth(state, idx_range.size());
+}
+
+/// A transposition using the automatically selected algorithm (tiled for this layout).
+void transpose(benchmark::State& state)
+{
+    IdxRangeXYZ const idx_range = get_idx_range_xyz(state);
+    DFieldMem<IdxRangeXYZ> start_alloc(idx_range);
+    DFieldMem<IdxRangeXZY> end_alloc(idx_range);
+    ddc::parallel_fill(get_field(start_alloc), 1.0);
+    for (auto _ : state) {
+        transpose_layout(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(end_alloc),
+                get_const_field(start_alloc));
+        Kokkos::fence();
+    }
+    set_bandwidth(state, idx_range.size());
+}
+
+} // namespace
+
+// The first argument is the batch size, the second is the size of the transposed dimensions
+BENCHMARK(copy)->Args({16, 256})->Args({4, 1024})->Args({1, 4096})->UseRealTime();
+BENCHMARK(transpose_elementwise)->Args({16, 256})->Args({4, 1024})->Args({1, 4096})->UseRealTime();
+BENCHMARK(transpose)->Args({16, 256})->Args({4, 1024})->Args({1, 4096})->UseRealTime();
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+    ddc::ScopeGuard const ddc_scope(argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "vector_field.hpp"
+#include "vector_field_mem.hpp"
+
+namespace {
+
+struct X
+{
+};
+struct Y
+{
+};
+
+struct GridX
+{
+};
+struct GridY
+{
+};
+
+using CoordXY = Coord<X, Y>;
+using IdxXY = Idx<GridX, GridY>;
+using IdxStepXY = IdxStep<GridX, GridY>;
+using IdxRangeXY = IdxRange<GridX, GridY>;
+
+template <class ComponentLayout>
+using AdvectionFieldMem = VectorFieldMem<
+        double,
+        IdxRangeXY,
+        NDTag<X, Y>,
+        ddc::KokkosAllocator<double, Kokkos::DefaultExecutionSpace::memory_space>,
+        ComponentLayout>;
+
+/**
+ * A synthetic foot-finding kernel: the feet of the characteristics are computed with an
+ * explicit Euler step feet = x - dt * A(x). Both components of the advection field are read
+ * at each index.
+ */
+template <class ComponentLayout>
+void find_feet(benchmark::State& state)
+{
+    IdxRangeXY const idx_range(IdxXY(0, 0), IdxStepXY(state.range(0), state.range(0)));
+    double const dx = 1.0 / state.range(0);
+    double const dt = 0.1;
+
+    AdvectionFieldMem<ComponentLayout> advection_field_alloc(idx_range);
+    FieldMem<CoordXY, IdxRangeXY> feet_alloc(idx_range);
+
+    auto advection_field = get_field(advection_field_alloc);
+    Field<CoordXY, IdxRangeXY> feet = get_field(feet_alloc);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(IdxXY const idx) {
+                double const x = dx * Idx<GridX>(idx).uid();
+                double const y = dx * Idx<GridY>(idx).uid();
+                ddcHelper::get<X>(advection_field)(idx) = -y;
+                ddcHelper::get<Y>(advection_field)(idx) = x;
+            });
+
+    for (auto _ : state) {
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idx_range,
+                KOKKOS_LAMBDA(IdxXY const idx) {
+                    CoordXY const coord(dx * Idx<GridX>(idx).uid(), dx * Idx<GridY>(idx).uid());
+                    feet(idx) = coord - dt * advection_field(idx);
+                });
+        Kokkos::fence();
+    }
+    // Two components are read and written for each index
+    state.SetBytesProcessed(state.iterations() * 4 * idx_range.size() * sizeof(double));
+}
+
+} // namespace
+
+// The argument is the number of points in each direction
+BENCHMARK(find_feet<SeparateComponents>)->RangeMultiplier(4)->Range(64, 4096)->UseRealTime();
+BENCHMARK(find_feet<InterleavedComponents>)->RangeMultiplier(4)->Range(64, 4096)->UseRealTime();
+
+int main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    Kokkos::ScopeGuard const kokkos_scope(argc, argv);
+    ddc::ScopeGuard const ddc_scope(argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -1,4 +1,5 @@
 // SPDX-License-Identifier: MIT
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <filesystem>
@@ -21,6 +22,7 @@
 #include "paraconfpp.hpp"
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
+#include "polynomial_moments.hpp"
 #include "simpson_quadrature.hpp"
 #include "species_info.hpp"
 #include "species_init.hpp"
@@ -101,6 +103,44 @@ int main(int argc, char** argv)
             get_const_field(coeff_intdvpar),
             B_norm);
 
+    // ---> Initialisation of the moments used to monitor the conservation properties
+    //      of the collision operator: int f, int vpar f, int vpar^2 f and int mu f
+    IdxRangeVparMu const idxrange_vparmu(idxrange_vpar, idxrange_mu);
+    DFieldMemVparMu const coeff_intdvparmu(
+            simpson_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(idxrange_vparmu));
+    PolynomialMoments<IdxRangeVparMu, IdxRangeSpVparMu, 4> const compute_moments(
+            get_const_field(coeff_intdvparmu),
+            {{{0, 0}, {1, 0}, {2, 0}, {0, 1}}});
+    std::array<DFieldMemSp, 4> moments_alloc {
+            DFieldMemSp(idxrange_kinsp),
+            DFieldMemSp(idxrange_kinsp),
+            DFieldMemSp(idxrange_kinsp),
+            DFieldMemSp(idxrange_kinsp)};
+    std::array<DFieldSp, 4> const moments {
+            get_field(moments_alloc[0]),
+            get_field(moments_alloc[1]),
+            get_field(moments_alloc[2]),
+            get_field(moments_alloc[3])};
+    host_t<DConstFieldSp> const masses = ddc::host_discrete_space<Species>().masses();
+    // Compute the total number of particles, the total parallel momentum and the total energy
+    auto compute_conserved_quantities = [&](DConstFieldSpVparMu fdistribu) {
+        compute_moments(Kokkos::DefaultExecutionSpace(), moments, fdistribu);
+        auto density_host = ddc::create_mirror_view_and_copy(moments[0]);
+        auto momentum_host = ddc::create_mirror_view_and_copy(moments[1]);
+        auto vpar2_host = ddc::create_mirror_view_and_copy(moments[2]);
+        auto mu_host = ddc::create_mirror_view_and_copy(moments[3]);
+        std::array<double, 3> conserved_quantities {0., 0., 0.};
+        for (IdxSp const isp : idxrange_kinsp) {
+            conserved_quantities[0] += density_host(isp);
+            conserved_quantities[1] += masses(isp) * momentum_host(isp);
+            conserved_quantities[2]
+                    += 0.5 * masses(isp) * vpar2_host(isp) + B_norm * mu_host(isp);
+        }
+        return conserved_quantities;
+    };
+    std::array<double, 3> const conserved_quantities_init
+            = compute_conserved_quantities(get_const_field(allfdistribu));
+
     // --------- TIME ITERATION ---------
     // ---> Reading of algorithm info from input YAML file
     double const deltat = PCpp_double(conf_collision, ".Algorithm.deltat");
@@ -142,6 +182,14 @@ int main(int argc, char** argv)
         // Apply collision operator
         collision_operator(allfdistribu, deltat);
         ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+
+        // Check the conservation of the density, the momentum and the energy
+        std::array<double, 3> const conserved_quantities
+                = compute_conserved_quantities(get_const_field(allfdistribu));
+        cout << "  conservation errors: density = "
+             << conserved_quantities[0] - conserved_quantities_init[0]
+             << " ; momentum = " << conserved_quantities[1] - conserved_quantities_init[1]
+             << " ; energy = " << conserved_quantities[2] - conserved_quantities_init[2] << endl;
     }
 
     steady_clock::time_point const end = steady_clock::now();
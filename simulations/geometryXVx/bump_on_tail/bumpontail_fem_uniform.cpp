@@ -12,8 +12,7 @@
 #include <paraconf.h>
 #include <pdi.h>
 
-#include "bsl_advection_vx.hpp"
-#include "bsl_advection_x.hpp"
+#include "bsl_advection_xvx.hpp"
 #include "bumpontailequilibrium.hpp"
 #include "chargedensitycalculator.hpp"
 #include "ddc_alias_inline_functions.hpp"
@@ -124,8 +123,8 @@ int main(int argc, char** argv)
     SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
     PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
 
-    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
-    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionX const advection_x(spline_x_interpolator);
+    BslAdvectionVx const advection_vx(spline_vx_interpolator);
 
     SplitVlasovSolver const vlasov(advection_x, advection_vx);
 
@@ -136,7 +135,7 @@ int main(int argc, char** argv)
     FEM1DPoissonSolver fem_solver(builder_x_poisson, spline_x_evaluator_poisson);
     QNSolver const poisson(fem_solver, rhs);
 
-    PredCorr const predcorr(vlasov, poisson);
+    PredCorr const predcorr(vlasov, poisson, nbstep_diag);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ensemble_initialization.hpp"
+#include "ensemble_predcorr.hpp"
+#include "ensemble_qnsolver.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "geometry_ensemble.hpp"
+#include "input.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "output.hpp"
+#include "paraconfpp.hpp"
+#include "params_ensemble.yaml.hpp"
+#include "pdi_out_ensemble.yml.hpp"
+#include "species_info.hpp"
+#include "species_init.hpp"
+#include "spline_interpolator.hpp"
+
+using std::chrono::steady_clock;
+
+int main(int argc, char** argv)
+{
+    // Environments variables for profiling
+    setenv("KOKKOS_TOOLS_LIBS", KP_KERNEL_TIMER_PATH, false);
+    setenv("KOKKOS_TOOLS_TIMER_JSON", "true", false);
+
+    PC_tree_t conf_voicexx = parse_executable_arguments(argc, argv, params_yaml);
+    PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
+    PC_errhandler(PC_NULL_HANDLER);
+    PDI_init(conf_pdi);
+
+    Kokkos::ScopeGuard kokkos_scope(argc, argv);
+    ddc::ScopeGuard ddc_scope(argc, argv);
+
+    // Reading config
+    // --> Mesh info
+    IdxRangeX const mesh_x = init_spline_dependent_idx_range<
+            GridX,
+            BSplinesX,
+            SplineInterpPointsX>(conf_voicexx, "x");
+    IdxRangeVx const mesh_vx = init_spline_dependent_idx_range<
+            GridVx,
+            BSplinesVx,
+            SplineInterpPointsVx>(conf_voicexx, "vx");
+
+    // --> Ensemble info
+    int const n_members = PCpp_len(conf_voicexx, ".Ensemble.perturb_amplitudes");
+    IdxRangeEns const idx_range_ens(IdxEns(0), IdxStepEns(n_members));
+    IdxRangeEnsX const mesh_ens_x(idx_range_ens, mesh_x);
+    IdxRangeEnsXVx const mesh_ens_xvx(idx_range_ens, mesh_x, mesh_vx);
+
+    IdxRangeSp const idx_range_kinsp = init_species(conf_voicexx);
+    IdxRangeSpVx const meshSpVx(idx_range_kinsp, mesh_vx);
+    IdxRangeEnsSpVx const mesh_ens_sp_vx(idx_range_ens, idx_range_kinsp, mesh_vx);
+    IdxRangeSpEnsXVx const mesh_sp_ens_xvx(idx_range_kinsp, mesh_ens_xvx);
+
+    SplineXBuilderEns const builder_x(mesh_ens_xvx);
+    SplineVxBuilderEns const builder_vx(mesh_ens_xvx);
+    SplineVxBuilder_1d const builder_vx_poisson(mesh_vx);
+
+    // Initialization of the distribution function
+    // All the members share the same equilibrium
+    DFieldMemSpVx allfequilibrium(meshSpVx);
+    MaxwellianEquilibrium const init_fequilibrium
+            = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_voicexx);
+    init_fequilibrium(allfequilibrium);
+    DFieldMemEnsSpVx allfequilibrium_ens(mesh_ens_sp_vx);
+    DConstFieldSpVx const allfequilibrium_proxy = get_const_field(allfequilibrium);
+    DFieldEnsSpVx const allfequilibrium_ens_proxy = get_field(allfequilibrium_ens);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            mesh_ens_sp_vx,
+            KOKKOS_LAMBDA(IdxEnsSpVx const iens_sp_vx) {
+                allfequilibrium_ens_proxy(iens_sp_vx) = allfequilibrium_proxy(IdxSpVx(iens_sp_vx));
+            });
+
+    // Each member has its own perturbation amplitude
+    host_t<IFieldMemSp> init_perturb_mode(idx_range_kinsp);
+    host_t<DFieldMemEnsSp> init_perturb_amplitude(IdxRangeEnsSp(idx_range_ens, idx_range_kinsp));
+    for (IdxSp const isp : idx_range_kinsp) {
+        PC_tree_t const conf_isp = PCpp_get(conf_voicexx, ".SpeciesInfo[%d]", isp.uid());
+        init_perturb_mode(isp) = static_cast<int>(PCpp_int(conf_isp, ".perturb_mode"));
+        for (IdxEns const iens : idx_range_ens) {
+            init_perturb_amplitude(iens, isp) = PCpp_double(
+                    conf_voicexx,
+                    ".Ensemble.perturb_amplitudes[%d]",
+                    iens.uid());
+        }
+    }
+
+    DFieldMemSpEnsXVx allfdistribu(mesh_sp_ens_xvx);
+    EnsembleSingleModePerturbInitialization const init(
+            get_const_field(allfequilibrium_ens),
+            std::move(init_perturb_mode),
+            std::move(init_perturb_amplitude));
+    init(get_field(allfdistribu));
+    auto allfequilibrium_host = ddc::create_mirror_view_and_copy(get_field(allfequilibrium));
+
+    // --> Algorithm info
+    double const deltat = PCpp_double(conf_voicexx, ".Algorithm.deltat");
+    int const nbiter = static_cast<int>(PCpp_int(conf_voicexx, ".Algorithm.nbiter"));
+
+    // --> Output info
+    double const time_diag = PCpp_double(conf_voicexx, ".Output.time_diag");
+    int const nbstep_diag = int(time_diag / deltat);
+
+    // Creating operators
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluatorEns const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolatorXEns const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::coordinate(mesh_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::coordinate(mesh_vx.back()));
+    SplineVxEvaluatorEns const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolatorVxEns const
+            spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    BslAdvectionEnsX const advection_x(spline_x_interpolator);
+    BslAdvectionEnsVx const advection_vx(spline_vx_interpolator);
+
+    DFieldMemVx const quadrature_coeffs(
+            neumann_spline_quadrature_coefficients<
+                    Kokkos::DefaultExecutionSpace>(mesh_vx, builder_vx_poisson));
+
+    FFTPoissonSolver<IdxRangeX, IdxRangeEnsX, Kokkos::DefaultExecutionSpace> fft_poisson_solver(
+            mesh_x);
+    EnsembleQNSolver const poisson(fft_poisson_solver, get_const_field(quadrature_coeffs));
+
+    EnsemblePredCorr const predcorr(advection_x, advection_vx, poisson, nbstep_diag);
+
+    // Starting the code
+    ddc::expose_to_pdi("iter_start", 0);
+    ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
+    ddc::expose_to_pdi("Nvx_spline_cells", ddc::discrete_space<BSplinesVx>().ncells());
+    expose_mesh_to_pdi("MeshX", mesh_x);
+    expose_mesh_to_pdi("MeshVx", mesh_vx);
+    ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
+    ddc::expose_to_pdi("Nmembers", n_members);
+    ddc::expose_to_pdi(
+            "fdistribu_charges",
+            ddc::discrete_space<Species>().charges()[idx_range_kinsp]);
+    ddc::expose_to_pdi(
+            "fdistribu_masses",
+            ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
+    ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
+
+    steady_clock::time_point const start = steady_clock::now();
+
+    predcorr(get_field(allfdistribu), 0., deltat, nbiter);
+
+    steady_clock::time_point const end = steady_clock::now();
+
+    double const simulation_time = std::chrono::duration<double>(end - start).count();
+    std::cout << "Simulation time: " << simulation_time << "s\n";
+
+    PC_tree_destroy(&conf_pdi);
+
+    PDI_finalize();
+
+    PC_tree_destroy(&conf_voicexx);
+
+    return EXIT_SUCCESS;
+}
@@ -12,8 +12,7 @@
 #include <paraconf.h>
 #include <pdi.h>
 
-#include "bsl_advection_vx.hpp"
-#include "bsl_advection_x.hpp"
+#include "bsl_advection_xvx.hpp"
 #include "chargedensitycalculator.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "fem_1d_poisson_solver.hpp"
@@ -124,8 +123,8 @@ int main(int argc, char** argv)
     SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
     PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
 
-    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
-    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionX const advection_x(spline_x_interpolator);
+    BslAdvectionVx const advection_vx(spline_vx_interpolator);
 
     SplitVlasovSolver const vlasov(advection_x, advection_vx);
 
@@ -138,7 +137,7 @@ int main(int argc, char** argv)
     ChargeDensityCalculator rhs(quadrature_coeffs);
     QNSolver const poisson(fem_solver, rhs);
 
-    PredCorr const predcorr(vlasov, poisson);
+    PredCorr const predcorr(vlasov, poisson, nbstep_diag);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -146,6 +145,7 @@ int main(int argc, char** argv)
     expose_mesh_to_pdi("MeshX", mesh_x);
     expose_mesh_to_pdi("MeshVx", mesh_vx);
     ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("delta_f", 0);
     ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
     ddc::expose_to_pdi(
             "fdistribu_charges",
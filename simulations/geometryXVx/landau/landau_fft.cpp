@@ -5,6 +5,8 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <optional>
+#include <string>
 #include <string_view>
 
 #include <ddc/ddc.hpp>
@@ -13,10 +15,11 @@
 #include <paraconf.h>
 #include <pdi.h>
 
-#include "bsl_advection_vx.hpp"
-#include "bsl_advection_x.hpp"
+#include "bsl_advection_xvx.hpp"
 #include "chargedensitycalculator.hpp"
 #include "ddc_alias_inline_functions.hpp"
+#include "deltafadvectionvx.hpp"
+#include "deltafchargedensitycalculator.hpp"
 #include "fft_poisson_solver.hpp"
 #include "geometry.hpp"
 #include "input.hpp"
@@ -33,6 +36,7 @@
 #include "species_info.hpp"
 #include "species_init.hpp"
 #include "spline_interpolator.hpp"
+#include "spline_solver_selection.hpp"
 #include "splitvlasovsolver.hpp"
 
 using std::cerr;
@@ -72,8 +76,6 @@ int main(int argc, char** argv)
     IdxRangeSpXVx const meshSpXVx(idx_range_kinsp, meshXVx);
     IdxRangeSpVx const meshSpVx(idx_range_kinsp, mesh_vx);
 
-    SplineXBuilder const builder_x(meshXVx);
-    SplineVxBuilder const builder_vx(meshXVx);
     SplineVxBuilder_1d const builder_vx_poisson(mesh_vx);
 
     // Initialization of the distribution function
@@ -99,6 +101,27 @@ int main(int argc, char** argv)
     // --> Algorithm info
     double const deltat = PCpp_double(conf_voicexx, ".Algorithm.deltat");
     int const nbiter = static_cast<int>(PCpp_int(conf_voicexx, ".Algorithm.nbiter"));
+    bool delta_f(false);
+    if (!PC_status(PCpp_get(conf_voicexx, ".Algorithm.delta_f"))) {
+        delta_f = PCpp_bool(conf_voicexx, ".Algorithm.delta_f");
+    }
+    std::string spline_solver("LAPACK");
+    if (!PC_status(PCpp_get(conf_voicexx, ".Algorithm.spline_solver"))) {
+        spline_solver = PCpp_string(conf_voicexx, ".Algorithm.spline_solver");
+    }
+    SplineSolverChoice const spline_solver_choice = spline_solver_choice_from_string(spline_solver);
+
+    if (delta_f && iter_start == 0) {
+        // Only the perturbation around the equilibrium is stored (restart files already contain it)
+        DFieldSpXVx const allfdistribu_field = get_field(allfdistribu);
+        DConstFieldSpVx const allfequilibrium_field = get_const_field(allfequilibrium);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                meshSpXVx,
+                KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                    allfdistribu_field(ispxvx) -= allfequilibrium_field(IdxSpVx(ispxvx));
+                });
+    }
 
     // --> Output info
     double const time_diag = PCpp_double(conf_voicexx, ".Output.time_diag");
@@ -113,30 +136,107 @@ int main(int argc, char** argv)
 #endif
 
     // Creating operators
+    // Only the builders of the chosen spline solver are created (the benchmark needs both)
+    bool const use_lapack = spline_solver_choice != SplineSolverChoice::GINKGO;
+    bool const use_ginkgo = spline_solver_choice != SplineSolverChoice::LAPACK;
+    std::optional<SplineXBuilder> builder_x;
+    std::optional<SplineVxBuilder> builder_vx;
+    std::optional<SplineXBuilderGinkgo> builder_x_ginkgo;
+    std::optional<SplineVxBuilderGinkgo> builder_vx_ginkgo;
     SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
-    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    std::optional<PreallocatableSplineInterpolatorX> spline_x_interpolator_lapack;
+    std::optional<PreallocatableSplineInterpolatorXGinkgo> spline_x_interpolator_ginkgo;
 
     ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::coordinate(mesh_vx.front()));
     ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::coordinate(mesh_vx.back()));
-
     SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
-    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    std::optional<PreallocatableSplineInterpolatorVx> spline_vx_interpolator_lapack;
+    std::optional<PreallocatableSplineInterpolatorVxGinkgo> spline_vx_interpolator_ginkgo;
+
+    if (use_lapack) {
+        builder_x.emplace(meshXVx);
+        builder_vx.emplace(meshXVx);
+        spline_x_interpolator_lapack.emplace(*builder_x, spline_x_evaluator);
+        spline_vx_interpolator_lapack.emplace(*builder_vx, spline_vx_evaluator);
+    }
+    if (use_ginkgo) {
+        builder_x_ginkgo.emplace(meshXVx);
+        builder_vx_ginkgo.emplace(meshXVx);
+        spline_x_interpolator_ginkgo.emplace(*builder_x_ginkgo, spline_x_evaluator);
+        spline_vx_interpolator_ginkgo.emplace(*builder_vx_ginkgo, spline_vx_evaluator);
+    }
 
-    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
-    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+    IPreallocatableInterpolator<GridX, GridX, GridVx> const& spline_x_interpolator
+            = select_spline_interpolator(
+                    spline_solver_choice,
+                    use_lapack ? &*spline_x_interpolator_lapack : nullptr,
+                    use_ginkgo ? &*spline_x_interpolator_ginkgo : nullptr,
+                    meshXVx);
+    IPreallocatableInterpolator<GridVx, GridX, GridVx> const& spline_vx_interpolator
+            = select_spline_interpolator(
+                    spline_solver_choice,
+                    use_lapack ? &*spline_vx_interpolator_lapack : nullptr,
+                    use_ginkgo ? &*spline_vx_interpolator_ginkgo : nullptr,
+                    meshXVx);
+    if (spline_solver_choice == SplineSolverChoice::Benchmark) {
+        std::cout << "Spline solver along x: "
+                  << (&spline_x_interpolator == &*spline_x_interpolator_lapack ? "LAPACK"
+                                                                                : "GINKGO")
+                  << std::endl;
+        std::cout << "Spline solver along vx: "
+                  << (&spline_vx_interpolator == &*spline_vx_interpolator_lapack ? "LAPACK"
+                                                                                  : "GINKGO")
+                  << std::endl;
+    }
 
-    SplitVlasovSolver const vlasov(advection_x, advection_vx);
+    BslAdvectionX const advection_x(spline_x_interpolator);
+    BslAdvectionVx const advection_vx(spline_vx_interpolator);
+
+    // The delta-f operators are only built when the perturbation is evolved
+    std::optional<SplineSpVxBuilder> builder_spvx;
+    std::optional<SplineSpVxEvaluator> spline_spvx_evaluator;
+    std::optional<DeltaFAdvectionVelocity<
+            GeometryXVx,
+            GridVx,
+            SplineSpVxBuilder,
+            SplineSpVxEvaluator>>
+            deltaf_advection_vx;
+    if (delta_f) {
+        builder_spvx.emplace(meshSpVx);
+        spline_spvx_evaluator.emplace(bv_v_min, bv_v_max);
+        deltaf_advection_vx.emplace(
+                advection_vx,
+                *builder_spvx,
+                *spline_spvx_evaluator,
+                get_const_field(allfequilibrium));
+    }
+
+    IAdvectionVelocity<GeometryXVx, GridVx> const& vlasov_advection_vx
+            = delta_f ? static_cast<IAdvectionVelocity<GeometryXVx, GridVx> const&>(
+                      *deltaf_advection_vx)
+                      : advection_vx;
+
+    SplitVlasovSolver const vlasov(advection_x, vlasov_advection_vx);
 
     DFieldMemVx const quadrature_coeffs(
             neumann_spline_quadrature_coefficients<
                     Kokkos::DefaultExecutionSpace>(mesh_vx, builder_vx_poisson));
 
     ChargeDensityCalculator rhs(get_field(quadrature_coeffs));
+    std::optional<DeltaFChargeDensityCalculator> deltaf_rhs;
+    if (delta_f) {
+        deltaf_rhs.emplace(
+                rhs,
+                get_const_field(quadrature_coeffs),
+                get_const_field(allfequilibrium));
+    }
     FFTPoissonSolver<IdxRangeX, IdxRangeX, Kokkos::DefaultExecutionSpace> fft_poisson_solver(
             mesh_x);
-    QNSolver const poisson(fft_poisson_solver, rhs);
+    IChargeDensityCalculator const& poisson_rhs
+            = delta_f ? static_cast<IChargeDensityCalculator const&>(*deltaf_rhs) : rhs;
+    QNSolver const poisson(fft_poisson_solver, poisson_rhs);
 
-    PredCorr const predcorr(vlasov, poisson);
+    PredCorr const predcorr(vlasov, poisson, nbstep_diag);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -144,6 +244,8 @@ int main(int argc, char** argv)
     expose_mesh_to_pdi("MeshX", mesh_x);
     expose_mesh_to_pdi("MeshVx", mesh_vx);
     ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    // In delta-f mode the fdistribu output contains the perturbation f - fdistribu_eq
+    ddc::expose_to_pdi("delta_f", int(delta_f));
     ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
     ddc::expose_to_pdi(
             "fdistribu_charges",
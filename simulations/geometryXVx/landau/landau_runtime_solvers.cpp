@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "input.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "output.hpp"
+#include "paraconfpp.hpp"
+#include "params.yaml.hpp"
+#include "pdi_out.yml.hpp"
+#include "predcorr.hpp"
+#include "restartinitialization.hpp"
+#include "singlemodeperturbinitialization.hpp"
+#include "species_info.hpp"
+#include "species_init.hpp"
+#include "xvx_solver_autotuner.hpp"
+#include "xvx_solvers.hpp"
+
+using std::cerr;
+using std::endl;
+using std::chrono::steady_clock;
+
+int main(int argc, char** argv)
+{
+    // Environments variables for profiling
+    setenv("KOKKOS_TOOLS_LIBS", KP_KERNEL_TIMER_PATH, false);
+    setenv("KOKKOS_TOOLS_TIMER_JSON", "true", false);
+
+    long int iter_start;
+    PC_tree_t conf_voicexx;
+    parse_executable_arguments(conf_voicexx, iter_start, argc, argv, params_yaml);
+    PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
+    PC_errhandler(PC_NULL_HANDLER);
+    PDI_init(conf_pdi);
+
+    Kokkos::ScopeGuard kokkos_scope(argc, argv);
+    ddc::ScopeGuard ddc_scope(argc, argv);
+
+    // Reading config
+    // --> Mesh info
+    IdxRangeX const mesh_x = init_spline_dependent_idx_range<
+            GridX,
+            BSplinesX,
+            SplineInterpPointsX>(conf_voicexx, "x");
+    IdxRangeVx const mesh_vx = init_spline_dependent_idx_range<
+            GridVx,
+            BSplinesVx,
+            SplineInterpPointsVx>(conf_voicexx, "vx");
+    IdxRangeXVx const meshXVx(mesh_x, mesh_vx);
+
+    IdxRangeSp const idx_range_kinsp = init_species(conf_voicexx);
+
+    IdxRangeSpXVx const meshSpXVx(idx_range_kinsp, meshXVx);
+    IdxRangeSpVx const meshSpVx(idx_range_kinsp, mesh_vx);
+
+    // Initialization of the distribution function
+    DFieldMemSpVx allfequilibrium(meshSpVx);
+    MaxwellianEquilibrium const init_fequilibrium
+            = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_voicexx);
+    init_fequilibrium(allfequilibrium);
+
+    ddc::expose_to_pdi("iter_start", iter_start);
+
+    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    double time_start(0);
+    if (iter_start == 0) {
+        SingleModePerturbInitialization const init = SingleModePerturbInitialization::
+                init_from_input(allfequilibrium, idx_range_kinsp, conf_voicexx);
+        init(allfdistribu);
+    } else {
+        RestartInitialization const restart(iter_start, time_start);
+        restart(allfdistribu);
+    }
+    auto allfequilibrium_host = ddc::create_mirror_view_and_copy(get_field(allfequilibrium));
+
+    // --> Algorithm info
+    double const deltat = PCpp_double(conf_voicexx, ".Algorithm.deltat");
+    int const nbiter = static_cast<int>(PCpp_int(conf_voicexx, ".Algorithm.nbiter"));
+
+    // --> Output info
+    double const time_diag = PCpp_double(conf_voicexx, ".Output.time_diag");
+    int const nbstep_diag = int(time_diag / deltat);
+
+    // --> Solver info
+    PC_tree_t const conf_solvers = PCpp_get(conf_voicexx, ".Algorithm.solvers");
+    std::string const selection = PCpp_string(conf_solvers, ".selection");
+    int const lagrange_degree = static_cast<int>(PCpp_int(conf_solvers, ".lagrange_degree"));
+
+    // Creating operators
+    XVxSolverConfiguration configuration;
+    if (selection == "auto") {
+        XVxSolverAutotuner const autotuner(
+                meshXVx,
+                lagrange_degree,
+                static_cast<int>(PCpp_int(conf_solvers, ".autotuner_steps")),
+                PCpp_double(conf_solvers, ".autotuner_tolerance"));
+        std::vector<XVxSolverTiming> const timings
+                = autotuner.time_configurations(get_const_field(allfdistribu), deltat);
+        for (XVxSolverTiming const& timing : timings) {
+            std::cout << std::setw(40) << std::left << to_string(timing.configuration)
+                      << " time per step: " << timing.time_per_step
+                      << "s, relative error: " << timing.relative_error << std::endl;
+        }
+        configuration = autotuner.select(timings);
+    } else if (selection == "manual") {
+        configuration.interpolator_x
+                = interpolator_choice_from_string(PCpp_string(conf_solvers, ".interpolator_x"));
+        configuration.interpolator_vx
+                = interpolator_choice_from_string(PCpp_string(conf_solvers, ".interpolator_vx"));
+        configuration.poisson_solver
+                = poisson_solver_choice_from_string(PCpp_string(conf_solvers, ".poisson_solver"));
+    } else {
+        cerr << "Unknown solver selection : " << selection << endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Solvers: " << to_string(configuration) << std::endl;
+
+    XVxSolvers const solvers(configuration, meshXVx, lagrange_degree);
+
+    PredCorr const predcorr(solvers.vlasov_solver(), solvers.qn_solver(), nbstep_diag);
+
+    // Starting the code
+    ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
+    ddc::expose_to_pdi("Nvx_spline_cells", ddc::discrete_space<BSplinesVx>().ncells());
+    expose_mesh_to_pdi("MeshX", mesh_x);
+    expose_mesh_to_pdi("MeshVx", mesh_vx);
+    ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("delta_f", 0);
+    ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
+    ddc::expose_to_pdi(
+            "fdistribu_charges",
+            ddc::discrete_space<Species>().charges()[idx_range_kinsp]);
+    ddc::expose_to_pdi(
+            "fdistribu_masses",
+            ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
+    ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
+
+    steady_clock::time_point const start = steady_clock::now();
+
+    predcorr(allfdistribu, time_start, deltat, nbiter);
+
+    steady_clock::time_point const end = steady_clock::now();
+
+    double const simulation_time = std::chrono::duration<double>(end - start).count();
+    std::cout << "Simulation time: " << simulation_time << "s\n";
+
+    PC_tree_destroy(&conf_pdi);
+
+    PDI_finalize();
+
+    PC_tree_destroy(&conf_voicexx);
+
+    return EXIT_SUCCESS;
+}
@@ -22,6 +22,16 @@ SpeciesInfo:
 Algorithm:
   deltat: 0.125
   nbiter: 360
+  delta_f: false
+  spline_solver: LAPACK
+  solvers:
+    selection: auto
+    interpolator_x: spline
+    interpolator_vx: spline
+    poisson_solver: FEM
+    lagrange_degree: 3
+    autotuner_steps: 4
+    autotuner_tolerance: 1.e-3
 
 Output:
   time_diag: 0.25
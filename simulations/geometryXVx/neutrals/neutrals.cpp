@@ -16,8 +16,7 @@
 #include <paraconf.h>
 #include <pdi.h>
 
-#include "bsl_advection_vx.hpp"
-#include "bsl_advection_x.hpp"
+#include "bsl_advection_xvx.hpp"
 #include "charge_exchange.hpp"
 #include "chargedensitycalculator.hpp"
 #include "collisions_inter.hpp"
@@ -167,8 +166,8 @@ int main(int argc, char** argv)
     PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
     PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
 
-    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
-    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionX const advection_x(spline_x_interpolator);
+    BslAdvectionVx const advection_vx(spline_vx_interpolator);
 
     // list of rhs operators
     std::vector<std::reference_wrapper<IRightHandSide const>> rhs_operators;
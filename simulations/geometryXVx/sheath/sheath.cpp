@@ -13,11 +13,11 @@
 #include <ddc/ddc.hpp>
 #include <ddc/kernels/splines.hpp>
 
+#include <mpi.h>
 #include <paraconf.h>
 #include <pdi.h>
 
-#include "bsl_advection_vx.hpp"
-#include "bsl_advection_x.hpp"
+#include "bsl_advection_xvx.hpp"
 #include "chargedensitycalculator.hpp"
 #include "collisions_inter.hpp"
 #include "collisions_intra.hpp"
@@ -34,6 +34,7 @@
 #include "neumann_spline_quadrature.hpp"
 #include "output.hpp"
 #include "paraconfpp.hpp"
+#include "parareal.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
 #include "qnsolver.hpp"
@@ -57,11 +58,28 @@ int main(int argc, char** argv)
     setenv("KOKKOS_TOOLS_LIBS", KP_KERNEL_TIMER_PATH, false);
     setenv("KOKKOS_TOOLS_TIMER_JSON", "true", false);
 
+    MPI_Init(&argc, &argv);
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
     long int iter_start;
     PC_tree_t conf_voicexx;
     parse_executable_arguments(conf_voicexx, iter_start, argc, argv, params_yaml);
-    PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
     PC_errhandler(PC_NULL_HANDLER);
+
+    std::string time_integrator("predcorr");
+    if (!PC_status(PCpp_get(conf_voicexx, ".Algorithm.time_integrator"))) {
+        time_integrator = PCpp_string(conf_voicexx, ".Algorithm.time_integrator");
+    }
+    if (time_integrator != "predcorr" && time_integrator != "parareal") {
+        throw std::invalid_argument(
+                "Invalid time integrator, allowed values are: 'predcorr', or 'parareal'.");
+    }
+    bool const use_parareal = time_integrator == "parareal";
+
+    // With Parareal all the ranks hold the final distribution function so only the first rank
+    // saves the diagnostics
+    PC_tree_t conf_pdi = PC_parse_string((use_parareal && rank > 0) ? "" : PDI_CFG);
     PDI_init(conf_pdi);
 
     Kokkos::ScopeGuard kokkos_scope(argc, argv);
@@ -99,15 +117,60 @@ int main(int argc, char** argv)
 
     ddc::expose_to_pdi("iter_start", iter_start);
 
-    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    bool float_storage(false);
+    if (!PC_status(PCpp_get(conf_voicexx, ".Algorithm.float_storage"))) {
+        float_storage = PCpp_bool(conf_voicexx, ".Algorithm.float_storage");
+    }
+    if (float_storage && use_parareal) {
+        throw std::invalid_argument(
+                "The Parareal time integrator does not support the float storage.");
+    }
+    // Only the distribution function with the requested precision is kept during the simulation
+    DFieldMemSpXVx allfdistribu(float_storage ? IdxRangeSpXVx() : meshSpXVx);
+    FieldMemSpXVx<float> allfdistribu_float(float_storage ? meshSpXVx : IdxRangeSpXVx());
     double time_start(0);
     if (iter_start == 0) {
         SingleModePerturbInitialization const init = SingleModePerturbInitialization::
                 init_from_input(allfequilibrium, idx_range_kinsp, conf_voicexx);
-        init(allfdistribu);
+        if (float_storage) {
+            // Initialise one species at a time in a double precision buffer so the whole
+            // distribution function is never stored in double precision
+            FieldSpXVx<float> const allfdistribu_float_field = get_field(allfdistribu_float);
+            for (IdxSp const isp : idx_range_kinsp) {
+                IdxRangeSpXVx const idx_range_slice(IdxRangeSp(isp, IdxStepSp(1)), meshXVx);
+                DFieldMemSpXVx fdistribu_alloc(idx_range_slice);
+                DFieldSpXVx const fdistribu = get_field(fdistribu_alloc);
+                init(fdistribu);
+                ddc::parallel_for_each(
+                        Kokkos::DefaultExecutionSpace(),
+                        idx_range_slice,
+                        KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                            allfdistribu_float_field(ispxvx)
+                                    = static_cast<float>(fdistribu(ispxvx));
+                        });
+            }
+        } else {
+            init(get_field(allfdistribu));
+        }
     } else {
         RestartInitialization const restart(iter_start, time_start);
-        restart(allfdistribu);
+        if (float_storage) {
+            // The restart file is written in double precision
+            DFieldMemSpXVx allfdistribu_restart(meshSpXVx);
+            restart(get_field(allfdistribu_restart));
+            FieldSpXVx<float> const allfdistribu_float_field = get_field(allfdistribu_float);
+            DConstFieldSpXVx const allfdistribu_restart_field
+                    = get_const_field(allfdistribu_restart);
+            ddc::parallel_for_each(
+                    Kokkos::DefaultExecutionSpace(),
+                    meshSpXVx,
+                    KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                        allfdistribu_float_field(ispxvx)
+                                = static_cast<float>(allfdistribu_restart_field(ispxvx));
+                    });
+        } else {
+            restart(get_field(allfdistribu));
+        }
     }
     auto allfequilibrium_host = ddc::create_mirror_view_and_copy(get_field(allfequilibrium));
 
@@ -139,8 +202,8 @@ int main(int argc, char** argv)
     PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
     PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
 
-    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
-    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionX const advection_x(spline_x_interpolator);
+    BslAdvectionVx const advection_vx(spline_vx_interpolator);
 
     // list of rhs operators
     std::vector<std::reference_wrapper<IRightHandSide const>> rhs_operators;
@@ -198,8 +261,14 @@ int main(int argc, char** argv)
     rhs_operators.emplace_back(rhs_kinetic_source);
 
 
-    CollisionsIntra const
-            collisions_intra(meshSpXVx, PCpp_double(conf_voicexx, ".CollisionsInfo.nustar0"));
+    int tile_size = 0;
+    if (!PC_status(PCpp_get(conf_voicexx, ".CollisionsInfo.tile_size"))) {
+        tile_size = PCpp_int(conf_voicexx, ".CollisionsInfo.tile_size");
+    }
+    CollisionsIntra const collisions_intra(
+            meshSpXVx,
+            PCpp_double(conf_voicexx, ".CollisionsInfo.nustar0"),
+            tile_size);
     rhs_operators.emplace_back(collisions_intra);
 
     std::optional<CollisionsInter> collisions_inter;
@@ -222,7 +291,7 @@ int main(int argc, char** argv)
 #endif
     QNSolver const poisson(poisson_solver, rhs);
 
-    PredCorr const predcorr(boltzmann, poisson);
+    PredCorr const predcorr(boltzmann, poisson, nbstep_diag);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -242,12 +311,47 @@ int main(int argc, char** argv)
 
     steady_clock::time_point const start = steady_clock::now();
 
-    predcorr(allfdistribu, time_start, deltat, nbiter);
+    if (use_parareal) {
+        // The same operators are used by the coarse and the fine propagators, only the time
+        // step differs. The propagators do not save any diagnostics.
+        PredCorr const propagator(boltzmann, poisson, 0);
+        Parareal const parareal(
+                propagator,
+                propagator,
+                MPI_COMM_WORLD,
+                static_cast<int>(PCpp_int(conf_voicexx, ".Parareal.coarse_ratio")),
+                static_cast<int>(PCpp_int(conf_voicexx, ".Parareal.max_iterations")),
+                PCpp_double(conf_voicexx, ".Parareal.tolerance"));
+        parareal(get_field(allfdistribu), time_start, deltat, nbiter);
+
+        // Save the final state as PredCorr would
+        DFieldMemX electrostatic_potential(mesh_x);
+        DFieldMemX electric_field(mesh_x);
+        poisson(get_field(electrostatic_potential),
+                get_field(electric_field),
+                get_const_field(allfdistribu));
+        auto allfdistribu_host = ddc::create_mirror_view_and_copy(get_field(allfdistribu));
+        auto electrostatic_potential_host
+                = ddc::create_mirror_view_and_copy(get_field(electrostatic_potential));
+        int const iter = nbiter;
+        double const time = time_start + nbiter * deltat;
+        ddc::PdiEvent("last_iteration")
+                .with("iter", iter)
+                .and_with("time_saved", time)
+                .and_with("fdistribu", allfdistribu_host)
+                .and_with("electrostatic_potential", electrostatic_potential_host);
+    } else if (float_storage) {
+        predcorr(get_field(allfdistribu_float), time_start, deltat, nbiter);
+    } else {
+        predcorr(get_field(allfdistribu), time_start, deltat, nbiter);
+    }
 
     steady_clock::time_point const end = steady_clock::now();
 
     double const simulation_time = std::chrono::duration<double>(end - start).count();
-    std::cout << "Simulation time: " << simulation_time << "s\n";
+    if (rank == 0) {
+        std::cout << "Simulation time: " << simulation_time << "s\n";
+    }
 
     PC_tree_destroy(&conf_pdi);
 
@@ -255,5 +359,7 @@ int main(int argc, char** argv)
 
     PC_tree_destroy(&conf_voicexx);
 
+    MPI_Finalize();
+
     return EXIT_SUCCESS;
 }
@@ -48,10 +48,18 @@ KineticSource:
 CollisionsInfo:
   enable_inter: true
   nustar0: 0.1
+  tile_size: 0
 
 Algorithm:
   deltat: 0.1
   nbiter: 50
+  float_storage: false
+  time_integrator: 'predcorr' # 'predcorr' or 'parareal'
+
+Parareal: # Only used by the 'parareal' time integrator
+  coarse_ratio: 5
+  max_iterations: 4
+  tolerance: 1e-8
 
 Output:
   time_diag: 0.1
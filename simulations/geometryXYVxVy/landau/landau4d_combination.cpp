@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <mpi.h>
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "combination_technique.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "first_touch.hpp"
+#include "geometry.hpp"
+#include "input.hpp"
+#include "landau4d_solvers.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "paraconfpp.hpp"
+#include "params_combination.yaml.hpp"
+#include "predcorr.hpp"
+#include "qnsolver.hpp"
+#include "singlemodeperturbinitialization.hpp"
+#include "species_info.hpp"
+#include "species_init.hpp"
+#include "splitvlasovsolver.hpp"
+
+using std::cerr;
+using std::endl;
+using std::chrono::steady_clock;
+
+namespace {
+
+/**
+ * Initialise the uniform B-splines and the interpolation points along a dimension of a
+ * component grid.
+ *
+ * @param[in] conf_voicexx The configuration of the simulation.
+ * @param[in] mesh_identifier The name of the dimension in the configuration.
+ * @param[in] ncells The number of cells of the component grid along the dimension.
+ *
+ * @returns The index range of the interpolation points.
+ */
+template <class Grid1D, class BSplines, class InterpPointInitMethod>
+IdxRange<Grid1D> init_component_idx_range(
+        PC_tree_t const& conf_voicexx,
+        std::string const& mesh_identifier,
+        int const ncells)
+{
+    static_assert(BSplines::is_uniform(), "The component grids must be uniform.");
+    using Coord1D = Coord<typename Grid1D::continuous_dimension_type>;
+    Coord1D const min(PCpp_double(conf_voicexx, ".SplineMesh." + mesh_identifier + "_min"));
+    Coord1D const max(PCpp_double(conf_voicexx, ".SplineMesh." + mesh_identifier + "_max"));
+    ddc::init_discrete_space<BSplines>(min, max, IdxStep<Grid1D>(ncells));
+    ddc::init_discrete_space<Grid1D>(InterpPointInitMethod::template get_sampling<Grid1D>());
+    return InterpPointInitMethod::template get_domain<Grid1D>();
+}
+
+/**
+ * Compute the electric energy 1/2 int (Ex^2 + Ey^2) dx dy on a uniform periodic grid.
+ */
+double compute_electric_energy(DConstFieldXY electric_field_x, DConstFieldXY electric_field_y)
+{
+    IdxRangeXY const mesh_xy = get_idx_range(electric_field_x);
+    double const cell_area = ddc::discrete_space<BSplinesX>().length()
+                             * ddc::discrete_space<BSplinesY>().length() / mesh_xy.size();
+    return 0.5 * cell_area
+           * ddc::parallel_transform_reduce(
+                   Kokkos::DefaultExecutionSpace(),
+                   mesh_xy,
+                   0.,
+                   ddc::reducer::sum<double>(),
+                   KOKKOS_LAMBDA(IdxXY const ixy) {
+                       return electric_field_x(ixy) * electric_field_x(ixy)
+                              + electric_field_y(ixy) * electric_field_y(ixy);
+                   });
+}
+
+} // namespace
+
+/**
+ * A Landau damping simulation using the sparse grid combination technique.
+ *
+ * Each MPI rank solves the Vlasov-Poisson system on one anisotropic component grid with the
+ * same solvers as landau4d_fft, so the simulation must be run on exactly as many ranks as
+ * there are component grids. The electric energy is saved on each component grid and the
+ * combined time series is printed by the first rank.
+ */
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv);
+    int rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    PC_tree_t conf_voicexx = parse_executable_arguments(argc, argv, params_combination_yaml);
+    PC_errhandler(PC_NULL_HANDLER);
+
+    // --> Combination technique info
+    std::array<int, 4> const min_levels {
+            static_cast<int>(PCpp_int(conf_voicexx, ".CombinationTechnique.x_min_level")),
+            static_cast<int>(PCpp_int(conf_voicexx, ".CombinationTechnique.y_min_level")),
+            static_cast<int>(PCpp_int(conf_voicexx, ".CombinationTechnique.vx_min_level")),
+            static_cast<int>(PCpp_int(conf_voicexx, ".CombinationTechnique.vy_min_level"))};
+    int const level = static_cast<int>(PCpp_int(conf_voicexx, ".CombinationTechnique.level"));
+    std::vector<CombinationComponent<4>> const components = combination_scheme(min_levels, level);
+
+    // Each component grid is solved by exactly one rank
+    int const n_components = static_cast<int>(components.size());
+    if (comm_size != n_components) {
+        if (rank == 0) {
+            cerr << "The combination technique with these levels uses " << n_components
+                 << " component grids so it must be run on exactly " << n_components
+                 << " MPI ranks (" << comm_size << " were provided)." << endl;
+        }
+        PC_tree_destroy(&conf_voicexx);
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    Kokkos::ScopeGuard kokkos_scope(argc, argv);
+    ddc::ScopeGuard ddc_scope(argc, argv);
+
+    int const icomponent = get_combination_component(MPI_COMM_WORLD, n_components);
+    CombinationComponent<4> const& component = components[icomponent];
+
+    // Reading config
+    // --> Mesh info
+    IdxRangeX const mesh_x = init_component_idx_range<
+            GridX,
+            BSplinesX,
+            SplineInterpPointsX>(conf_voicexx, "x", component.ncells(0));
+    IdxRangeY const mesh_y = init_component_idx_range<
+            GridY,
+            BSplinesY,
+            SplineInterpPointsY>(conf_voicexx, "y", component.ncells(1));
+    IdxRangeVx const mesh_vx = init_component_idx_range<
+            GridVx,
+            BSplinesVx,
+            SplineInterpPointsVx>(conf_voicexx, "vx", component.ncells(2));
+    IdxRangeVy const mesh_vy = init_component_idx_range<
+            GridVy,
+            BSplinesVy,
+            SplineInterpPointsVy>(conf_voicexx, "vy", component.ncells(3));
+    IdxRangeXY const mesh_xy(mesh_x, mesh_y);
+    IdxRangeXYVxVy const meshXYVxVy(mesh_x, mesh_y, mesh_vx, mesh_vy);
+
+    IdxRangeSp const idx_range_kinsp = init_species(conf_voicexx);
+
+    IdxRangeSpVxVy const meshSpVxVy(idx_range_kinsp, mesh_vx, mesh_vy);
+    IdxRangeSpXYVxVy const meshSpXYVxVy(idx_range_kinsp, meshXYVxVy);
+
+    // Initialization of the distribution function
+    DFieldMemSpVxVy allfequilibrium(meshSpVxVy);
+    MaxwellianEquilibrium const init_fequilibrium
+            = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_voicexx);
+    init_fequilibrium(allfequilibrium);
+    DFieldMemSpXYVxVy allfdistribu(meshSpXYVxVy);
+    // Place the pages of the distribution function on the NUMA nodes of the threads using them
+    first_touch(get_field(allfdistribu));
+    SingleModePerturbInitialization const init = SingleModePerturbInitialization::
+            init_from_input(allfequilibrium, idx_range_kinsp, conf_voicexx);
+    init(allfdistribu);
+
+    // --> Algorithm info
+    double const deltat = PCpp_double(conf_voicexx, ".Algorithm.deltat");
+    int const nbiter = static_cast<int>(PCpp_int(conf_voicexx, ".Algorithm.nbiter"));
+
+    // --> Output info
+    double const time_diag = PCpp_double(conf_voicexx, ".Output.time_diag");
+    int const nbstep_diag = int(time_diag / deltat);
+    if (nbstep_diag <= 0) {
+        if (rank == 0) {
+            cerr << "The time between two diagnostics (" << time_diag
+                 << ") must be at least one time step (" << deltat << ")." << endl;
+        }
+        PC_tree_destroy(&conf_pdi);
+        PDI_finalize();
+        PC_tree_destroy(&conf_voicexx);
+        MPI_Finalize();
+        return EXIT_FAILURE;
+    }
+
+    DFieldMemXY electrostatic_potential(mesh_xy);
+    DFieldMemXY electric_field_x(mesh_xy);
+    DFieldMemXY electric_field_y(mesh_xy);
+
+    std::vector<double> electric_energy;
+    std::vector<double> times;
+    steady_clock::time_point start;
+    steady_clock::time_point end;
+    run_with_landau4d_solvers(
+            meshXYVxVy,
+            [&](SplitVlasovSolver const& vlasov, QNSolver const& poisson) {
+                // Create predcorr operator. The electric energy is the only diagnostic of the
+                // component grids so the distribution function is not exposed to PDI.
+                PredCorr const predcorr(vlasov, poisson, 0);
+
+                // Starting the code
+                start = steady_clock::now();
+
+                for (int iter = 0; iter <= nbiter; iter += nbstep_diag) {
+                    poisson(electrostatic_potential,
+                            electric_field_x,
+                            electric_field_y,
+                            get_const_field(allfdistribu));
+                    times.push_back(iter * deltat);
+                    electric_energy.push_back(compute_electric_energy(
+                            get_const_field(electric_field_x),
+                            get_const_field(electric_field_y)));
+                    if (iter < nbiter) {
+                        predcorr(
+                                get_field(allfdistribu),
+                                deltat,
+                                std::min(nbstep_diag, nbiter - iter));
+                    }
+                }
+
+                end = steady_clock::now();
+            });
+
+    std::vector<double> const combined_electric_energy = combine_component_values(
+            electric_energy,
+            component.coefficient,
+            MPI_COMM_WORLD);
+
+    double const local_simulation_time = std::chrono::duration<double>(end - start).count();
+    double simulation_time;
+    MPI_Reduce(
+            &local_simulation_time,
+            &simulation_time,
+            1,
+            MPI_DOUBLE,
+            MPI_MAX,
+            0,
+            MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        std::cout << "Combination of " << components.size() << " component grids\n";
+        std::cout << "time electric_energy\n";
+        for (std::size_t i(0); i < times.size(); ++i) {
+            std::cout << std::setprecision(8) << times[i] << " " << combined_electric_energy[i]
+                      << "\n";
+        }
+        std::cout << "Simulation time: " << simulation_time << "s\n";
+    }
+
+    PC_tree_destroy(&conf_pdi);
+
+    PDI_finalize();
+
+    PC_tree_destroy(&conf_voicexx);
+
+    MPI_Finalize();
+
+    return EXIT_SUCCESS;
+}
@@ -12,14 +12,12 @@
 #include <paraconf.h>
 #include <pdi.h>
 
-#include "bsl_advection_vx.hpp"
-#include "bsl_advection_x.hpp"
 #include "ddc_alias_inline_functions.hpp"
-#include "fft_poisson_solver.hpp"
+#include "first_touch.hpp"
 #include "geometry.hpp"
 #include "input.hpp"
+#include "landau4d_solvers.hpp"
 #include "maxwellianequilibrium.hpp"
-#include "neumann_spline_quadrature.hpp"
 #include "output.hpp"
 #include "paraconfpp.hpp"
 #include "params.yaml.hpp"
@@ -29,7 +27,6 @@
 #include "singlemodeperturbinitialization.hpp"
 #include "species_info.hpp"
 #include "species_init.hpp"
-#include "spline_interpolator.hpp"
 #include "splitvlasovsolver.hpp"
 
 using std::cerr;
@@ -69,8 +66,6 @@ int main(int argc, char** argv)
             GridVy,
             BSplinesVy,
             SplineInterpPointsVy>(conf_voicexx, "vy");
-    IdxRangeXY const mesh_xy(mesh_x, mesh_y);
-    IdxRangeVxVy mesh_vxvy(mesh_vx, mesh_vy);
     IdxRangeXYVxVy const meshXYVxVy(mesh_x, mesh_y, mesh_vx, mesh_vy);
 
     IdxRangeSp const idx_range_kinsp = init_species(conf_voicexx);
@@ -78,22 +73,44 @@ int main(int argc, char** argv)
     IdxRangeSpVxVy const meshSpVxVy(idx_range_kinsp, mesh_vx, mesh_vy);
     IdxRangeSpXYVxVy const meshSpXYVxVy(idx_range_kinsp, meshXYVxVy);
 
-    SplineXBuilder const builder_x(meshXYVxVy);
-    SplineYBuilder const builder_y(meshXYVxVy);
-    SplineVxBuilder const builder_vx(meshXYVxVy);
-    SplineVyBuilder const builder_vy(meshXYVxVy);
-    SplineVxBuilder_1d const builder_vx_1d(mesh_vx);
-    SplineVyBuilder_1d const builder_vy_1d(mesh_vy);
-
     // Initialization of the distribution function
     DFieldMemSpVxVy allfequilibrium(meshSpVxVy);
     MaxwellianEquilibrium const init_fequilibrium
             = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_voicexx);
     init_fequilibrium(allfequilibrium);
-    DFieldMemSpXYVxVy allfdistribu(meshSpXYVxVy);
+    bool float_storage(false);
+    if (!PC_status(PCpp_get(conf_voicexx, ".Algorithm.float_storage"))) {
+        float_storage = PCpp_bool(conf_voicexx, ".Algorithm.float_storage");
+    }
+    // Only the distribution function with the requested precision is allocated
+    DFieldMemSpXYVxVy allfdistribu(float_storage ? IdxRangeSpXYVxVy() : meshSpXYVxVy);
+    FieldMemSpXYVxVy<float> allfdistribu_float(float_storage ? meshSpXYVxVy : IdxRangeSpXYVxVy());
     SingleModePerturbInitialization const init = SingleModePerturbInitialization::
             init_from_input(allfequilibrium, idx_range_kinsp, conf_voicexx);
-    init(allfdistribu);
+    if (float_storage) {
+        // Place the pages of the distribution function on the NUMA nodes of the threads using them
+        first_touch(get_field(allfdistribu_float));
+        // Initialise one species at a time in a double precision buffer so the whole
+        // distribution function is never stored in double precision
+        FieldSpXYVxVy<float> const allfdistribu_float_field = get_field(allfdistribu_float);
+        for (IdxSp const isp : idx_range_kinsp) {
+            IdxRangeSpXYVxVy const idx_range_slice(IdxRangeSp(isp, IdxStepSp(1)), meshXYVxVy);
+            DFieldMemSpXYVxVy fdistribu_alloc(idx_range_slice);
+            DFieldSpXYVxVy const fdistribu = get_field(fdistribu_alloc);
+            init(fdistribu);
+            ddc::parallel_for_each(
+                    Kokkos::DefaultExecutionSpace(),
+                    idx_range_slice,
+                    KOKKOS_LAMBDA(IdxSpXYVxVy const ispxyvxvy) {
+                        allfdistribu_float_field(ispxyvxvy)
+                                = static_cast<float>(fdistribu(ispxyvxvy));
+                    });
+        }
+    } else {
+        // Place the pages of the distribution function on the NUMA nodes of the threads using them
+        first_touch(get_field(allfdistribu));
+        init(get_field(allfdistribu));
+    }
     auto allfequilibrium_host = ddc::create_mirror_view_and_copy(get_field(allfequilibrium));
 
     // --> Algorithm info
@@ -104,78 +121,44 @@ int main(int argc, char** argv)
     double const time_diag = PCpp_double(conf_voicexx, ".Output.time_diag");
     int const nbstep_diag = int(time_diag / deltat);
 
-    // Create spline evaluator
-    ddc::PeriodicExtrapolationRule<X> bv_x_min;
-    ddc::PeriodicExtrapolationRule<X> bv_x_max;
-    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
-
-    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
-
-    ddc::PeriodicExtrapolationRule<Y> bv_y_min;
-    ddc::PeriodicExtrapolationRule<Y> bv_y_max;
-    SplineYEvaluator const spline_y_evaluator(bv_y_min, bv_y_max);
-
-    PreallocatableSplineInterpolator const spline_y_interpolator(builder_y, spline_y_evaluator);
-
-    ddc::ConstantExtrapolationRule<Vx> bv_vx_min(ddc::coordinate(mesh_vx.front()));
-    ddc::ConstantExtrapolationRule<Vx> bv_vx_max(ddc::coordinate(mesh_vx.back()));
-    SplineVxEvaluator const spline_vx_evaluator(bv_vx_min, bv_vx_max);
-
-    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
-
-    ddc::ConstantExtrapolationRule<Vy> bv_vy_min(ddc::coordinate(mesh_vy.front()));
-    ddc::ConstantExtrapolationRule<Vy> bv_vy_max(ddc::coordinate(mesh_vy.back()));
-    SplineVyEvaluator const spline_vy_evaluator(bv_vy_min, bv_vy_max);
-
-    PreallocatableSplineInterpolator const spline_vy_interpolator(builder_vy, spline_vy_evaluator);
-
-    // Create advection operator
-    BslAdvectionSpatial<GeometryXYVxVy, GridX> const advection_x(spline_x_interpolator);
-    BslAdvectionSpatial<GeometryXYVxVy, GridY> const advection_y(spline_y_interpolator);
-    BslAdvectionVelocity<GeometryXYVxVy, GridVx> const advection_vx(spline_vx_interpolator);
-    BslAdvectionVelocity<GeometryXYVxVy, GridVy> const advection_vy(spline_vy_interpolator);
-
-    SplitVlasovSolver const vlasov(advection_x, advection_y, advection_vx, advection_vy);
-
-    DFieldMemVxVy const quadrature_coeffs(
-            neumann_spline_quadrature_coefficients<
-                    Kokkos::DefaultExecutionSpace>(mesh_vxvy, builder_vx_1d, builder_vy_1d));
-
-    FFTPoissonSolver<IdxRangeXY, IdxRangeXY, Kokkos::DefaultExecutionSpace> fft_poisson_solver(
-            mesh_xy);
-    ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
-    QNSolver const poisson(fft_poisson_solver, rhs);
-
-    // Create predcorr operator
-    PredCorr const predcorr(vlasov, poisson);
-
-    // Starting the code
-    ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
-    ddc::expose_to_pdi("Ny_spline_cells", ddc::discrete_space<BSplinesY>().ncells());
-    ddc::expose_to_pdi("Nvx_spline_cells", ddc::discrete_space<BSplinesVx>().ncells());
-    ddc::expose_to_pdi("Nvy_spline_cells", ddc::discrete_space<BSplinesVy>().ncells());
-    expose_mesh_to_pdi("MeshX", mesh_x);
-    expose_mesh_to_pdi("MeshY", mesh_y);
-    expose_mesh_to_pdi("MeshVx", mesh_vx);
-    expose_mesh_to_pdi("MeshVy", mesh_vy);
-    ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
-    ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
-    ddc::expose_to_pdi(
-            "fdistribu_charges",
-            ddc::discrete_space<Species>().charges()[idx_range_kinsp]);
-    ddc::expose_to_pdi(
-            "fdistribu_masses",
-            ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
-    ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
-
-    steady_clock::time_point const start = steady_clock::now();
-
-    predcorr(get_field(allfdistribu), deltat, nbiter);
-
-    steady_clock::time_point const end = steady_clock::now();
-
-    double const simulation_time = std::chrono::duration<double>(end - start).count();
-    std::cout << "Simulation time: " << simulation_time << "s\n";
+    run_with_landau4d_solvers(
+            meshXYVxVy,
+            [&](SplitVlasovSolver const& vlasov, QNSolver const& poisson) {
+                // Create predcorr operator
+                PredCorr const predcorr(vlasov, poisson, nbstep_diag);
+
+                // Starting the code
+                ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
+                ddc::expose_to_pdi("Ny_spline_cells", ddc::discrete_space<BSplinesY>().ncells());
+                ddc::expose_to_pdi("Nvx_spline_cells", ddc::discrete_space<BSplinesVx>().ncells());
+                ddc::expose_to_pdi("Nvy_spline_cells", ddc::discrete_space<BSplinesVy>().ncells());
+                expose_mesh_to_pdi("MeshX", mesh_x);
+                expose_mesh_to_pdi("MeshY", mesh_y);
+                expose_mesh_to_pdi("MeshVx", mesh_vx);
+                expose_mesh_to_pdi("MeshVy", mesh_vy);
+                ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+                ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
+                ddc::expose_to_pdi(
+                        "fdistribu_charges",
+                        ddc::discrete_space<Species>().charges()[idx_range_kinsp]);
+                ddc::expose_to_pdi(
+                        "fdistribu_masses",
+                        ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
+                ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
+
+                steady_clock::time_point const start = steady_clock::now();
+
+                if (float_storage) {
+                    predcorr(get_field(allfdistribu_float), deltat, nbiter);
+                } else {
+                    predcorr(get_field(allfdistribu), deltat, nbiter);
+                }
+
+                steady_clock::time_point const end = steady_clock::now();
+
+                double const simulation_time = std::chrono::duration<double>(end - start).count();
+                std::cout << "Simulation time: " << simulation_time << "s\n";
+            });
 
     PC_tree_destroy(&conf_pdi);
 
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <ddc/ddc.hpp>
+
+#include "bsl_advection_xyvxvy.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "qnsolver.hpp"
+#include "spline_interpolator.hpp"
+#include "splitvlasovsolver.hpp"
+
+/**
+ * @brief Build the Vlasov and Poisson solvers of a Landau damping simulation and run a function
+ * which uses them.
+ *
+ * The advections use splines which are periodic in space and extrapolated by a constant in
+ * velocity, and the Poisson equation is solved with FFTs. The solvers hold references to each
+ * other so they are built on the stack of this function and only exist while the function runs.
+ *
+ * @param[in] meshXYVxVy The index range of the phase space.
+ * @param[in] run A function called as run(vlasov, poisson) with the SplitVlasovSolver and the
+ *                QNSolver.
+ */
+template <class Function>
+void run_with_landau4d_solvers(IdxRangeXYVxVy const meshXYVxVy, Function&& run)
+{
+    IdxRangeXY const mesh_xy(meshXYVxVy);
+    IdxRangeVx const mesh_vx(meshXYVxVy);
+    IdxRangeVy const mesh_vy(meshXYVxVy);
+    IdxRangeVxVy const mesh_vxvy(mesh_vx, mesh_vy);
+
+    SplineXBuilder const builder_x(meshXYVxVy);
+    SplineYBuilder const builder_y(meshXYVxVy);
+    SplineVxBuilder const builder_vx(meshXYVxVy);
+    SplineVyBuilder const builder_vy(meshXYVxVy);
+    SplineVxBuilder_1d const builder_vx_1d(mesh_vx);
+    SplineVyBuilder_1d const builder_vy_1d(mesh_vy);
+
+    // Create spline evaluator
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    ddc::PeriodicExtrapolationRule<Y> bv_y_min;
+    ddc::PeriodicExtrapolationRule<Y> bv_y_max;
+    SplineYEvaluator const spline_y_evaluator(bv_y_min, bv_y_max);
+
+    PreallocatableSplineInterpolator const spline_y_interpolator(builder_y, spline_y_evaluator);
+
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_min(ddc::coordinate(mesh_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_max(ddc::coordinate(mesh_vx.back()));
+    SplineVxEvaluator const spline_vx_evaluator(bv_vx_min, bv_vx_max);
+
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_min(ddc::coordinate(mesh_vy.front()));
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_max(ddc::coordinate(mesh_vy.back()));
+    SplineVyEvaluator const spline_vy_evaluator(bv_vy_min, bv_vy_max);
+
+    PreallocatableSplineInterpolator const spline_vy_interpolator(builder_vy, spline_vy_evaluator);
+
+    // Create advection operator
+    BslAdvectionX const advection_x(spline_x_interpolator);
+    BslAdvectionY const advection_y(spline_y_interpolator);
+    BslAdvectionVx const advection_vx(spline_vx_interpolator);
+    BslAdvectionVy const advection_vy(spline_vy_interpolator);
+
+    SplitVlasovSolver const vlasov(advection_x, advection_y, advection_vx, advection_vy);
+
+    DFieldMemVxVy const quadrature_coeffs(
+            neumann_spline_quadrature_coefficients<
+                    Kokkos::DefaultExecutionSpace>(mesh_vxvy, builder_vx_1d, builder_vy_1d));
+
+    FFTPoissonSolver<IdxRangeXY, IdxRangeXY, Kokkos::DefaultExecutionSpace> fft_poisson_solver(
+            mesh_xy);
+    ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
+    QNSolver const poisson(fft_poisson_solver, rhs);
+
+    run(vlasov, poisson);
+}
@@ -28,6 +28,7 @@ SpeciesInfo:
 Algorithm:
   deltat: 0.12
   nbiter: 140
+  float_storage: false
 
 Output:
   time_diag: 0.24
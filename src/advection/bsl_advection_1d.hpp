@@ -9,6 +9,7 @@
 #include "ddc_helper.hpp"
 #include "euler.hpp"
 #include "iinterpolator.hpp"
+#include "workspace_arena.hpp"
 
 
 /**
@@ -74,8 +75,8 @@ private:
     using IdxRangeInterest = IdxRange<GridInterest>;
     using IdxInterest = typename IdxRangeInterest::discrete_element_type;
 
-    // Type for the feet and advection field:
-    using FeetFieldMem = FieldMem<CoordInterest, IdxRangeAdvection>;
+    // Type for the feet and advection field (the temporaries are allocated from the workspace):
+    using FeetFieldMem = WorkspaceFieldMem<CoordInterest, IdxRangeAdvection>;
     using FeetField = typename FeetFieldMem::span_type;
     using FeetConstField = typename FeetFieldMem::view_type;
 
@@ -86,7 +87,7 @@ private:
 
     // Type for spline representation of the advection field
     using IdxRangeBSAdvection = typename AdvectionFieldBuilder::batched_spline_domain_type;
-    using AdvecFieldSplineMem = DFieldMem<IdxRangeBSAdvection>;
+    using AdvecFieldSplineMem = DWorkspaceFieldMem<IdxRangeBSAdvection>;
     using AdvecFieldSplineCoeffs = DField<IdxRangeBSAdvection>;
 
     // Type for the derivatives of the advection field
@@ -106,7 +107,7 @@ private:
 
     // Type for the derivatives of the function
     using IdxRangeFunctionDeriv = typename FunctionInterpolatorType::batched_derivs_idx_range_type;
-    using FunctionDerivFieldMem = DFieldMem<IdxRangeFunctionDeriv>;
+    using FunctionDerivFieldMem = DWorkspaceFieldMem<IdxRangeFunctionDeriv>;
 
     FunctionPreallocatableInterpolatorType const& m_function_interpolator;
 
@@ -170,6 +171,8 @@ public:
             = std::nullopt) const
     {
         Kokkos::Profiling::pushRegion("BslAdvection1D");
+        WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+                get_workspace_arena());
 
         // Get index ranges and operators .............................................................
         IdxRangeFunction const idx_range_function = get_idx_range(allfdistribu);
@@ -247,7 +250,7 @@ public:
             To interpolate the function we want to advect, we build for the feet a Field defined 
             on the index range where the function is defined. 
         */
-        FieldMem<CoordInterest, IdxRangeFunction> feet_alloc(idx_range_function);
+        WorkspaceFieldMem<CoordInterest, IdxRangeFunction> feet_alloc(idx_range_function);
         Field<CoordInterest, IdxRangeFunction> feet = get_field(feet_alloc);
         ddc::parallel_for_each(
                 Kokkos::DefaultExecutionSpace(),
@@ -262,8 +265,8 @@ public:
         function_interpolator(
                 allfdistribu,
                 feet,
-                function_derivatives_min,
-                function_derivatives_max);
+                get_const_field(function_derivatives_min),
+                get_const_field(function_derivatives_max));
 
 
         Kokkos::Profiling::popRegion();
@@ -8,6 +8,7 @@
 #include "iadvectionvx.hpp"
 #include "iinterpolator.hpp"
 #include "species_info.hpp"
+#include "workspace_arena.hpp"
 
 /**
  * @brief A class which computes the velocity advection along the dimension of interest GridV. Working for every cartesian geometry.
@@ -45,6 +46,8 @@ public:
 
     ~BslAdvectionVelocity() override = default;
 
+    using IAdvectionVelocity<Geometry, GridV>::operator();
+
     /**
      * @brief Advects fdistribu along GridV for a duration dt.
      * @param[in, out] allfdistribu Reference to the whole distribution function for one species, allocated on the device (ie it lets the choice of the location depend on the build configuration).
@@ -62,26 +65,28 @@ public:
 
 
         Kokkos::Profiling::pushRegion("BslAdvectionVelocity");
+        WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+                get_workspace_arena());
         IdxRangeFdistribu const idx_range = get_idx_range(allfdistribu);
         IdxRange<GridV> const idx_range_v = ddc::select<GridV>(idx_range);
         IdxRange<Species> const idx_range_sp = ddc::select<Species>(idx_range);
 
-        FieldMem<double, typename InterpolatorType::batched_derivs_idx_range_type> derivs_min(
-                m_interpolator_v.batched_derivs_idx_range_xmin(
-                        ddc::remove_dims_of<Species>(idx_range)));
-        FieldMem<double, typename InterpolatorType::batched_derivs_idx_range_type> derivs_max(
-                m_interpolator_v.batched_derivs_idx_range_xmax(
-                        ddc::remove_dims_of<Species>(idx_range)));
-        ddc::parallel_fill(derivs_min, 0.);
-        ddc::parallel_fill(derivs_max, 0.);
-
         // pre-allocate some memory to prevent allocation later in loop
         IdxRangeSpaceVelocity batched_feet_idx_range(idx_range);
-        FieldMem<Coord<DimV>, IdxRangeSpaceVelocity> feet_coords_alloc(batched_feet_idx_range);
+        WorkspaceFieldMem<Coord<DimV>, IdxRangeSpaceVelocity> feet_coords_alloc(
+                batched_feet_idx_range);
         Field<Coord<DimV>, IdxRangeSpaceVelocity> feet_coords(get_field(feet_coords_alloc));
-        std::unique_ptr<InterpolatorType> const interpolator_v_ptr = m_interpolator_v.preallocate();
+        std::unique_ptr<InterpolatorType> const interpolator_v_ptr
+                = m_interpolator_v.preallocate(batched_feet_idx_range);
         InterpolatorType const& interpolator_v = *interpolator_v_ptr;
 
+        DWorkspaceFieldMem<typename InterpolatorType::batched_derivs_idx_range_type> derivs_min(
+                interpolator_v.batched_derivs_idx_range_xmin(batched_feet_idx_range));
+        DWorkspaceFieldMem<typename InterpolatorType::batched_derivs_idx_range_type> derivs_max(
+                interpolator_v.batched_derivs_idx_range_xmax(batched_feet_idx_range));
+        ddc::parallel_fill(derivs_min, 0.);
+        ddc::parallel_fill(derivs_max, 0.);
+
         IdxRangeSpatial const idx_range_spatial(get_idx_range(allfdistribu));
 
         IdxRangeBatch batch_idx_range(idx_range);
@@ -7,6 +7,7 @@
 #include "iadvectionx.hpp"
 #include "iinterpolator.hpp"
 #include "species_info.hpp"
+#include "workspace_arena.hpp"
 
 /**
  * @brief A class which computes the spatial advection along the dimension of interest GridX. Working for every cartesian geometry. 
@@ -45,6 +46,8 @@ public:
 
     ~BslAdvectionSpatial() override = default;
 
+    using IAdvectionSpatial<Geometry, GridX>::operator();
+
     /**
      * @brief Advects fdistribu along GridX for a duration dt.
      * @param[in, out] allfdistribu Reference to the whole distribution function for one species, allocated on the device (ie it lets the choice of the location depend on the build configuration).
@@ -59,6 +62,8 @@ public:
         using IdxBatch = typename IdxRangeBatch::discrete_element_type;
 
         Kokkos::Profiling::pushRegion("BslAdvectionSpatial");
+        WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+                get_workspace_arena());
         IdxRangeFdistrib const idx_range = get_idx_range(allfdistribu);
         IdxRange<GridX> const x_idx_range = ddc::select<GridX>(idx_range);
         IdxRange<GridV> const v_idx_range = ddc::select<GridV>(idx_range);
@@ -66,9 +71,11 @@ public:
 
         // pre-allocate some memory to prevent allocation later in loop
         IdxRangeSpaceVelocity batched_feet_idx_range(idx_range);
-        FieldMem<Coord<DimX>, IdxRangeSpaceVelocity> feet_coords_alloc(batched_feet_idx_range);
+        WorkspaceFieldMem<Coord<DimX>, IdxRangeSpaceVelocity> feet_coords_alloc(
+                batched_feet_idx_range);
         Field<Coord<DimX>, IdxRangeSpaceVelocity> feet_coords(get_field(feet_coords_alloc));
-        std::unique_ptr<InterpolatorType> const interpolator_x_ptr = m_interpolator_x.preallocate();
+        std::unique_ptr<InterpolatorType> const interpolator_x_ptr
+                = m_interpolator_x.preallocate(batched_feet_idx_range);
         InterpolatorType const& interpolator_x = *interpolator_x_ptr;
 
         IdxRangeBatch batch_idx_range(idx_range);
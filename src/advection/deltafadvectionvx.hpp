@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <optional>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
+#include "iadvectionvx.hpp"
+#include "species_info.hpp"
+
+/**
+ * @brief A class which computes the velocity advection of the perturbation @f$ \delta f = f - f_{eq} @f$
+ * of a distribution function around an equilibrium @f$ f_{eq} @f$ which only depends on the
+ * species and the velocity.
+ *
+ * The advection operator is linear so the advection of the full distribution function can be
+ * written as:
+ * @f$ A(f) = A(\delta f) + f_{eq} + (A(f_{eq}) - f_{eq}) @f$.
+ * The perturbation is therefore advected with the wrapped operator and the (small) variation of
+ * the equilibrium @f$ A(f_{eq}) - f_{eq} @f$ is added to it. The full distribution function is
+ * never stored so the round-off error is proportional to the amplitude of the perturbation
+ * rather than to the amplitude of the equilibrium.
+ *
+ * The equilibrium does not depend on the spatial coordinates so its spline coefficients are
+ * computed once at construction. The advected equilibrium is then evaluated at the feet of the
+ * characteristics (the same feet as in BslAdvectionVelocity) in the kernel which adds it to the
+ * perturbation. No phase-space temporary is allocated and the equilibrium is not advected with
+ * the wrapped operator.
+ *
+ * The spatial advection does not need a similar treatment as the equilibrium does not depend
+ * on the spatial coordinates.
+ *
+ * @tparam Geometry The geometry of the distribution function.
+ * @tparam GridV The velocity dimension along which the advection is carried out.
+ * @tparam SplineBuilderV A spline builder along GridV on the (species, velocity) index range.
+ * @tparam SplineEvaluatorV A spline evaluator matching SplineBuilderV.
+ */
+template <class Geometry, class GridV, class SplineBuilderV, class SplineEvaluatorV>
+class DeltaFAdvectionVelocity : public IAdvectionVelocity<Geometry, GridV>
+{
+    using IdxRangeFdistribu = typename Geometry::IdxRangeFdistribu;
+    using IdxRangeSpatial = typename Geometry::IdxRangeSpatial;
+    using IdxSpatial = typename IdxRangeSpatial::discrete_element_type;
+    using IdxRangeSpVelocity
+            = ddc::cartesian_prod_t<IdxRange<Species>, typename Geometry::IdxRangeVelocity>;
+    using IdxSpVelocity = typename IdxRangeSpVelocity::discrete_element_type;
+    using IdxV = Idx<GridV>;
+    using DimV = typename GridV::continuous_dimension_type;
+    using DerivV = ddc::Deriv<DimV>;
+    using IdxRangeSpVelocityDerivs = ddc::replace_dim_of_t<IdxRangeSpVelocity, GridV, DerivV>;
+    using IdxRangeCoefs = typename SplineBuilderV::batched_spline_domain_type;
+    using IdxCoefsBatch =
+            typename ddc::remove_dims_of_t<IdxRangeSpVelocity, GridV>::discrete_element_type;
+
+private:
+    IAdvectionVelocity<Geometry, GridV> const& m_advection_v;
+
+    SplineEvaluatorV m_spline_evaluator;
+
+    DConstField<IdxRangeSpVelocity> m_fequilibrium;
+
+    // The spline coefficients of the equilibrium along GridV
+    DFieldMem<IdxRangeCoefs> m_fequilibrium_coefs;
+
+public:
+    /**
+     * @brief Constructor
+     * @param[in] advection_v The advection operator along the GridV direction used for the full distribution function.
+     * @param[in] spline_builder A builder used to compute the spline coefficients of the equilibrium along GridV.
+     * @param[in] spline_evaluator An evaluator used to evaluate the equilibrium at the feet of the characteristics.
+     * @param[in] allfequilibrium The equilibrium distribution function of each kinetic species, allocated on the device.
+     */
+    DeltaFAdvectionVelocity(
+            IAdvectionVelocity<Geometry, GridV> const& advection_v,
+            SplineBuilderV const& spline_builder,
+            SplineEvaluatorV const& spline_evaluator,
+            DConstField<IdxRangeSpVelocity> allfequilibrium)
+        : m_advection_v(advection_v)
+        , m_spline_evaluator(spline_evaluator)
+        , m_fequilibrium(allfequilibrium)
+        , m_fequilibrium_coefs(spline_builder.batched_spline_domain())
+    {
+        // The derivatives of the equilibrium vanish at the boundaries of the velocity grid
+        IdxRangeSpVelocity const idx_range = get_idx_range(allfequilibrium);
+        DFieldMem<IdxRangeSpVelocityDerivs> derivs_min(ddc::replace_dim_of<GridV, DerivV>(
+                idx_range,
+                IdxRange<DerivV>(Idx<DerivV>(1), IdxStep<DerivV>(SplineBuilderV::s_nbc_xmin))));
+        DFieldMem<IdxRangeSpVelocityDerivs> derivs_max(ddc::replace_dim_of<GridV, DerivV>(
+                idx_range,
+                IdxRange<DerivV>(Idx<DerivV>(1), IdxStep<DerivV>(SplineBuilderV::s_nbc_xmax))));
+        ddc::parallel_fill(derivs_min, 0.);
+        ddc::parallel_fill(derivs_max, 0.);
+        spline_builder(
+                get_field(m_fequilibrium_coefs),
+                allfequilibrium,
+                std::optional(get_const_field(derivs_min)),
+                std::optional(get_const_field(derivs_max)));
+    }
+
+    ~DeltaFAdvectionVelocity() override = default;
+
+    using IAdvectionVelocity<Geometry, GridV>::operator();
+
+    /**
+     * @brief Advects the perturbation of the distribution function along GridV for a duration dt.
+     * @param[in, out] allfdistribu Reference to the perturbation @f$ f - f_{eq} @f$ of the whole distribution function, allocated on the device.
+     * @param[in] electric_field Reference to the electric field which derives from electrostatic potential, allocated on the device.
+     * @param[in] dt Time step
+     * @return A reference to the allfdistribu array containing the perturbation at the updated time t+dt.
+     */
+    Field<double, IdxRangeFdistribu> operator()(
+            Field<double, IdxRangeFdistribu> const allfdistribu,
+            Field<const double, IdxRangeSpatial> const electric_field,
+            double const dt) const override
+    {
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistribu, Species>;
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+
+        Kokkos::Profiling::pushRegion("DeltaFAdvectionVelocity");
+        m_advection_v(allfdistribu, electric_field, dt);
+
+        IdxRangeFdistribu const idx_range = get_idx_range(allfdistribu);
+        IdxRangeBatch const batch_idx_range(idx_range);
+        DConstField<IdxRangeSpVelocity> const fequilibrium = m_fequilibrium;
+        DConstField<IdxRangeCoefs> const fequilibrium_coefs = get_const_field(m_fequilibrium_coefs);
+        SplineEvaluatorV const spline_evaluator = m_spline_evaluator;
+
+        ddc::for_each(ddc::select<Species>(idx_range), [&](IdxSp const isp) {
+            double const charge_proxy = charge(isp);
+            double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+            ddc::parallel_for_each(
+                    Kokkos::DefaultExecutionSpace(),
+                    batch_idx_range,
+                    KOKKOS_LAMBDA(IdxBatch const ib) {
+                        IdxSpatial const ix(ib);
+                        IdxSpVelocity const ispv(isp, ib);
+                        // The foot of the characteristic computed by BslAdvectionVelocity
+                        double const dvx
+                                = charge_proxy * sqrt_me_on_mspecies * dt * electric_field(ix);
+                        Coord<DimV> const foot(ddc::coordinate(IdxV(ib)) - dvx);
+                        double const fequilibrium_advected = spline_evaluator(
+                                foot,
+                                fequilibrium_coefs[IdxCoefsBatch(ispv)]);
+                        allfdistribu(isp, ib) += fequilibrium_advected - fequilibrium(ispv);
+                    });
+        });
+
+        Kokkos::Profiling::popRegion();
+        return allfdistribu;
+    }
+};
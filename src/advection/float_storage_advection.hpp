@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "double_precision_blocks.hpp"
+#include "species_info.hpp"
+
+namespace detail {
+/**
+ * @brief Apply a double precision advection to a distribution function stored in single precision.
+ *
+ * The distribution function is treated one species and one block at a time. The blocks are
+ * slices of the first batch dimension (the first dimension which is neither the species nor the
+ * advected dimension) so each block contains whole lines along the advected dimension. Each block
+ * is copied into a double precision buffer, advected in place and stored back in single precision
+ * (see apply_on_double_precision_blocks).
+ *
+ * @tparam GridAdvected The dimension along which the distribution function is advected.
+ * @param[in, out] allfdistribu The distribution function stored in single precision.
+ * @param[in] advect A function which advects a block of a double precision distribution function in place.
+ * @param[in] n_blocks The number of blocks into which the batch dimension is split.
+ */
+template <class GridAdvected, class IdxRangeFdistribu, class AdvectionFunction>
+void advect_with_double_precision_blocks(
+        Field<float, IdxRangeFdistribu> const allfdistribu,
+        AdvectionFunction&& advect,
+        std::size_t const n_blocks = 8)
+{
+    using GridBlock = ddc::type_seq_element_t<
+            0,
+            ddc::to_type_seq_t<ddc::remove_dims_of_t<IdxRangeFdistribu, Species, GridAdvected>>>;
+    using IdxRangeNoSpecies = ddc::remove_dims_of_t<IdxRangeFdistribu, Species>;
+
+    IdxRangeFdistribu const idx_range = get_idx_range(allfdistribu);
+    IdxRangeNoSpecies const idx_range_no_sp(idx_range);
+
+    for (IdxSp const isp : ddc::select<Species>(idx_range)) {
+        apply_on_double_precision_blocks<GridBlock>(
+                allfdistribu,
+                IdxRangeFdistribu(IdxRangeSp(isp, IdxStepSp(1)), idx_range_no_sp),
+                advect,
+                n_blocks);
+    }
+}
+} // namespace detail
@@ -5,6 +5,7 @@
 
 #include "ddc_aliases.hpp"
 #include "ddc_helper.hpp"
+#include "float_storage_advection.hpp"
 
 /**
  * @brief A class which provides an advection operator.
@@ -31,4 +32,31 @@ public:
             DField<typename Geometry::IdxRangeFdistribu> allfdistribu,
             DConstField<typename Geometry::IdxRangeSpatial> electric_field,
             double dt) const = 0;
+
+    /**
+     * @brief operates a transport of a distribution function stored in single precision.
+     *
+     * The distribution function is advected block by block in double precision by the
+     * double precision operator before being stored back in single precision. The double
+     * precision operator must therefore accept a distribution function defined on a block
+     * of the index range.
+     *
+     * @param[in, out] allfdistribu Reference to an array containing the value of the distribution function.
+     * @param[in] electric_field The electric field which derives from electrostatic potential and is the advection speed.
+     * @param[in] dt Time step.
+     *
+     * @return A reference to an array containing the value of distribution the function at the updated time t+dt.
+     */
+    virtual Field<float, typename Geometry::IdxRangeFdistribu> operator()(
+            Field<float, typename Geometry::IdxRangeFdistribu> allfdistribu,
+            DConstField<typename Geometry::IdxRangeSpatial> electric_field,
+            double dt) const
+    {
+        detail::advect_with_double_precision_blocks<GridV>(
+                allfdistribu,
+                [&](DField<typename Geometry::IdxRangeFdistribu> fdistribu) {
+                    (*this)(fdistribu, electric_field, dt);
+                });
+        return allfdistribu;
+    }
 };
@@ -4,6 +4,7 @@
 #include <ddc/ddc.hpp>
 
 #include "ddc_aliases.hpp"
+#include "float_storage_advection.hpp"
 
 /**
  * @brief A class which provides an advection operator.
@@ -27,4 +28,29 @@ public:
     virtual DField<typename Geometry::IdxRangeFdistribu> operator()(
             DField<typename Geometry::IdxRangeFdistribu> allfdistribu,
             double dt) const = 0;
+
+    /**
+     * @brief operates a transport of a distribution function stored in single precision.
+     *
+     * The distribution function is advected block by block in double precision by the
+     * double precision operator before being stored back in single precision. The double
+     * precision operator must therefore accept a distribution function defined on a block
+     * of the index range.
+     *
+     * @param[in, out] allfdistribu  reference to an array containing the value of distribution the function.
+     * @param[in] dt time step.
+     *
+     * @return A reference to an array containing the value of distribution the function at the updated time T+dt.
+     */
+    virtual Field<float, typename Geometry::IdxRangeFdistribu> operator()(
+            Field<float, typename Geometry::IdxRangeFdistribu> allfdistribu,
+            double dt) const
+    {
+        detail::advect_with_double_precision_blocks<GridX>(
+                allfdistribu,
+                [&](DField<typename Geometry::IdxRangeFdistribu> fdistribu) {
+                    (*this)(fdistribu, dt);
+                });
+        return allfdistribu;
+    }
 };
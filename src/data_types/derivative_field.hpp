@@ -172,6 +172,9 @@ private:
     /// @brief The number of chunks which must be created to describe this object.
     static constexpr int n_fields = base_type::n_fields;
 
+    template <class, class, class, class>
+    friend class DerivField;
+
 private:
     /** @brief Get the subindex range to be extracted from a DerivFieldMem to build the internal_chunk at position ArrayIndex
      * along dimension Tag.
@@ -226,6 +229,38 @@ private:
                 MemorySpace>(field.data_handle(), kokkos_layout);
     }
 
+    /**
+     * @brief Get a 1D Kokkos view on all the data when the internal fields are stored
+     * contiguously.
+     */
+    auto get_contiguous_kokkos_view() const
+    {
+        assert(base_type::internal_fields_are_contiguous());
+        return Kokkos::View<ElementType*, MemorySpace, Kokkos::MemoryUnmanaged>(
+                base_type::internal_fields[0].data_handle(),
+                base_type::internal_fields_size());
+    }
+
+    /**
+     * @brief Check if the data can be copied from src with a single copy. This is the case if
+     * the internal fields of both objects are contiguous and are laid out in the same way.
+     */
+    template <class OElementType, class OLayoutStridedPolicy, class OMemorySpace>
+    bool can_copy_contiguously(
+            DerivField<OElementType, index_range_type, OLayoutStridedPolicy, OMemorySpace> const&
+                    src) const
+    {
+        if (!base_type::internal_fields_are_contiguous() || !src.internal_fields_are_contiguous()) {
+            return false;
+        }
+        for (int i(0); i < n_fields; ++i) {
+            if (base_type::internal_fields[i].mapping() != src.internal_fields[i].mapping()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
 public:
     /**
      * @brief Copy-construct a DerivField
@@ -318,12 +353,19 @@ public:
     /**
      * @brief Copy the source DerivField into this DerivField using Kokkos::deep_copy. 
      *
+     * If the internal fields of both DerivFields are stored contiguously in the same way (e.g.
+     * when copying between two DerivFieldMems) then a single copy is carried out.
+     *
      * @param src The DerivField containing the data to be copied.
      */
     template <class OElementType, class OLayoutStridedPolicy, class OMemorySpace>
     void deepcopy(
             DerivField<OElementType, index_range_type, OLayoutStridedPolicy, OMemorySpace> src)
     {
+        if (can_copy_contiguously(src)) {
+            Kokkos::deep_copy(get_contiguous_kokkos_view(), src.get_contiguous_kokkos_view());
+            return;
+        }
         for (int i(0); i < n_fields; ++i) {
             auto kokkos_span = get_kokkos_view_from_internal_chunk(i);
             auto src_kokkos_span = src.get_kokkos_view_from_internal_chunk(i);
@@ -334,6 +376,9 @@ public:
     /**
      * @brief Copy the source DerivField into this DerivField using Kokkos::deep_copy.
      *
+     * If the internal fields of both DerivFields are stored contiguously in the same way (e.g.
+     * when copying between two DerivFieldMems) then a single copy is carried out.
+     *
      * @param execution_space The execution space on which the copy will be carried out.
      * @param src The DerivField containing the data to be copied.
      */
@@ -342,6 +387,13 @@ public:
             ExecSpace const& execution_space,
             DerivField<OElementType, index_range_type, OLayoutStridedPolicy, OMemorySpace> src)
     {
+        if (can_copy_contiguously(src)) {
+            Kokkos::deep_copy(
+                    execution_space,
+                    get_contiguous_kokkos_view(),
+                    src.get_contiguous_kokkos_view());
+            return;
+        }
         for (int i(0); i < n_fields; ++i) {
             auto kokkos_span = get_kokkos_view_from_internal_chunk(i);
             auto src_kokkos_span = src.get_kokkos_view_from_internal_chunk(i);
@@ -158,6 +158,43 @@ protected:
     to_subidx_range_collection<physical_deriv_grids> m_cross_derivative_idx_range;
 
 protected:
+    /**
+     * @brief Check if the internal fields are stored one after the other in a single contiguous
+     * block of memory. This is the case for a DerivFieldMem and for a DerivField which views all
+     * the data of a DerivFieldMem.
+     *
+     * @returns True if the internal fields are stored contiguously, false otherwise.
+     */
+    KOKKOS_FUNCTION bool internal_fields_are_contiguous() const
+    {
+        for (int i(0); i < n_fields; ++i) {
+            if (!internal_fields[i].is_exhaustive()) {
+                return false;
+            }
+        }
+        for (int i(0); i < n_fields - 1; ++i) {
+            if (internal_fields[i].data_handle() + internal_fields[i].size()
+                != internal_fields[i + 1].data_handle()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get the total number of elements stored in the internal fields.
+     *
+     * @returns The number of elements.
+     */
+    KOKKOS_FUNCTION std::size_t internal_fields_size() const
+    {
+        std::size_t size(0);
+        for (int i(0); i < n_fields; ++i) {
+            size += internal_fields[i].size();
+        }
+        return size;
+    }
+
     /**
      * @brief An internal function which provides the index of an element inside the internal_fields.
      * An Idx describes the element of interest. If information about the derivatives is
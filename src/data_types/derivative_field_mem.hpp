@@ -21,6 +21,13 @@ template <class ElementType, class SupportType, int NDerivs, class Allocator>
 inline constexpr bool
         enable_deriv_field<DerivFieldMem<ElementType, SupportType, NDerivs, Allocator>> = true;
 
+namespace detail {
+/// @brief The discrete dimension indexing the single allocation of a DerivFieldMem.
+struct DerivFieldMemBufferGrid
+{
+};
+} // namespace detail
+
 
 /**
  * @brief A class which holds a chunk of memory describing a field and its derivatives.
@@ -28,6 +35,9 @@ inline constexpr bool
  * The values of the field and the derivatives may be defined on different index ranges, but
  * the underlying mesh must be the same for both.
  *
+ * All the internal fields are stored one after the other in a single allocation so the
+ * data can be copied or communicated with a single operation.
+ *
  * @anchor DerivFieldMemImplementation
  *
  * @tparam ElementType The type of the elements inside the chunks.
@@ -139,6 +149,13 @@ private:
     /// @brief The number of chunks which must be created to describe this object.
     static constexpr int n_fields = base_type::n_fields;
 
+    /// @brief The type of the single allocation containing all the internal fields.
+    using buffer_type
+            = FieldMem<element_type, IdxRange<detail::DerivFieldMemBufferGrid>, allocator_type>;
+
+    /// @brief The allocation containing all the internal fields.
+    buffer_type m_buffer;
+
 private:
     /// @brief A function to get the index range along direction Tag for the ArrayIndex-th element of internal_fields.
     template <std::size_t ArrayIndex, class Tag>
@@ -209,15 +226,18 @@ private:
         }
     }
 
+    /// @brief Get the number of elements in the internal mdspan at the index ArrayIndex.
+    template <std::size_t ArrayIndex>
+    std::size_t get_internal_mdspan_size()
+    {
+        return ((get_mdspan_size<DDims, ArrayIndex>()) * ...);
+    }
+
     /// @brief Make the internal mdspan that will be saved in internal_fields at the index ArrayIndex.
     template <std::size_t ArrayIndex>
     std::enable_if_t<std::is_constructible_v<mapping_type, extents_type>, internal_mdspan_type>
-    make_internal_mdspan(
-            ddc::KokkosAllocator<element_type, typename chunk_type::memory_space> allocator)
+    make_internal_mdspan(element_type* ptr)
     {
-        std::size_t alloc_size(((get_mdspan_size<DDims, ArrayIndex>()) * ...));
-        element_type* ptr = allocator.allocate("", alloc_size);
-
         extents_type extents_r(get_mdspan_size<DDims, ArrayIndex>()...);
         mapping_type mapping_r(extents_r);
 
@@ -227,11 +247,30 @@ private:
         return internal_mdspan_type(ptr, mapping_s);
     }
 
-    /// @brief Initialise the chunks inside internal_fields.
+    /**
+     * @brief Initialise the chunks inside internal_fields.
+     *
+     * A single buffer is allocated and the chunks are placed one after the other inside it.
+     */
     template <std::size_t... ArrayIndex>
     void initialise_chunks(allocator_type allocator, std::index_sequence<ArrayIndex...>)
     {
-        ((base_type::internal_fields[ArrayIndex] = make_internal_mdspan<ArrayIndex>(allocator)),
+        std::array<std::size_t, n_fields> const sizes {get_internal_mdspan_size<ArrayIndex>()...};
+        std::array<std::size_t, n_fields> offsets {};
+        for (int i(1); i < n_fields; ++i) {
+            offsets[i] = offsets[i - 1] + sizes[i - 1];
+        }
+        std::size_t const buffer_size = offsets[n_fields - 1] + sizes[n_fields - 1];
+
+        m_buffer = buffer_type(
+                IdxRange<detail::DerivFieldMemBufferGrid>(
+                        Idx<detail::DerivFieldMemBufferGrid>(0),
+                        IdxStep<detail::DerivFieldMemBufferGrid>(buffer_size)),
+                allocator);
+        element_type* const ptr = m_buffer.data_handle();
+
+        ((base_type::internal_fields[ArrayIndex]
+          = make_internal_mdspan<ArrayIndex>(ptr + offsets[ArrayIndex])),
          ...);
     }
 
@@ -324,6 +363,32 @@ public:
         return base_type::get_internal_field(elem)();
     }
 
+    /**
+     * @brief Get a 1D Kokkos view on the single allocation containing the values and all the
+     * derivatives. This can be used to copy or communicate all the data in one operation.
+     *
+     * This function is designed to match the equivalent function in DDC.
+     *
+     * @returns A 1D Kokkos view on the allocation.
+     */
+    auto allocation_kokkos_view()
+    {
+        return m_buffer.allocation_kokkos_view();
+    }
+
+    /**
+     * @brief Get a 1D Kokkos view on the single allocation containing the values and all the
+     * derivatives. This can be used to copy or communicate all the data in one operation.
+     *
+     * This function is designed to match the equivalent function in DDC.
+     *
+     * @returns A constant 1D Kokkos view on the allocation.
+     */
+    auto allocation_kokkos_view() const
+    {
+        return m_buffer.allocation_kokkos_view();
+    }
+
     /**
      * @brief Get a constant DerivField of this field.
      *
@@ -108,9 +108,9 @@ private:
     template <class, class, class, class, class>
     friend class VectorField;
 
-    template <class OElementType, class Allocator, std::size_t... Is>
+    template <class OElementType, class Allocator, class ComponentLayout, std::size_t... Is>
     KOKKOS_FUNCTION constexpr VectorField(
-            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator>& other,
+            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator, ComponentLayout>& other,
             std::index_sequence<Is...> const&) noexcept
         : base_type((field_type(ddcHelper::get<ddc::type_seq_element_t<Is, NDTag>>(other)))...)
     {
@@ -125,9 +125,11 @@ private:
             std::size_t... Is,
             class SFINAEElementType = ElementType,
             class = std::enable_if_t<std::is_const_v<SFINAEElementType>>,
-            class Allocator>
+            class Allocator,
+            class ComponentLayout>
     KOKKOS_FUNCTION constexpr VectorField(
-            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator> const& other,
+            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator, ComponentLayout> const&
+                    other,
             std::index_sequence<Is...> const&) noexcept
         : base_type((field_type(ddcHelper::get<ddc::type_seq_element_t<Is, NDTag>>(other)))...)
     {
@@ -194,9 +196,10 @@ public:
     /** Constructs a new VectorField from a VectorFieldMem, yields a new view to the same data
      * @param other the VectorFieldMem to view
      */
-    template <class OElementType, class Allocator>
+    template <class OElementType, class Allocator, class ComponentLayout>
     KOKKOS_FUNCTION constexpr VectorField(
-            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator>& other) noexcept
+            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator, ComponentLayout>&
+                    other) noexcept
         : VectorField(other, std::make_index_sequence<base_type::NDims> {})
     {
     }
@@ -209,9 +212,11 @@ public:
             class OElementType,
             class SFINAEElementType = ElementType,
             class = std::enable_if_t<std::is_const_v<SFINAEElementType>>,
-            class Allocator>
+            class Allocator,
+            class ComponentLayout>
     KOKKOS_FUNCTION constexpr VectorField(
-            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator> const& other) noexcept
+            VectorFieldMem<OElementType, IdxRangeType, NDTag, Allocator, ComponentLayout> const&
+                    other) noexcept
         : VectorField(other, std::make_index_sequence<base_type::NDims> {})
     {
     }
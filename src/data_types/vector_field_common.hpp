@@ -8,6 +8,30 @@
 template <class FieldType, class NDTypeSeq>
 class VectorFieldCommon;
 
+/**
+ * @brief A tag indicating that the components of a VectorFieldMem are stored in separate
+ * allocations (structure of arrays).
+ */
+struct SeparateComponents
+{
+};
+
+/**
+ * @brief A tag indicating that the components of a VectorFieldMem are interleaved in a single
+ * allocation (array of structures). The components of the vector at a given index are
+ * therefore contiguous in memory.
+ */
+struct InterleavedComponents
+{
+};
+
+namespace detail {
+/// @brief The dimension indexing the components of an interleaved vector field.
+struct VectorComponentGrid
+{
+};
+} // namespace detail
+
 template <class T>
 inline constexpr bool enable_field = false;
 
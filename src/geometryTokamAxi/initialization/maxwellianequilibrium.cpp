@@ -13,28 +13,40 @@ MaxwellianEquilibrium::MaxwellianEquilibrium(
     , m_temperature_eq(get_idx_range(temperature_eq_host))
     , m_mean_velocity_eq(get_idx_range(mean_velocity_eq_host))
     , m_magnetic_field(get_idx_range(magnetic_field_host))
+    , m_prefactor(get_idx_range(density_eq_host))
+    , m_inv_temperature(get_idx_range(temperature_eq_host))
 {
     ddc::parallel_deepcopy(m_density_eq, density_eq_host);
     ddc::parallel_deepcopy(m_temperature_eq, temperature_eq_host);
     ddc::parallel_deepcopy(m_mean_velocity_eq, mean_velocity_eq_host);
     ddc::parallel_deepcopy(m_magnetic_field, magnetic_field_host);
+
+    // Precompute the quantities which only depend on (species, r, theta)
+    DConstFieldSpTor2D const density = get_const_field(m_density_eq);
+    DConstFieldSpTor2D const temperature = get_const_field(m_temperature_eq);
+    DFieldSpTor2D const prefactor = get_field(m_prefactor);
+    DFieldSpTor2D const inv_temperature = get_field(m_inv_temperature);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(m_prefactor),
+            KOKKOS_LAMBDA(IdxSpTor2D const isptor2d) {
+                double const inv_2piT = 1. / (2. * M_PI * temperature(isptor2d));
+                prefactor(isptor2d) = Kokkos::sqrt(inv_2piT) * inv_2piT * density(isptor2d);
+                inv_temperature(isptor2d) = 1. / temperature(isptor2d);
+            });
 }
 
 DFieldSpV2DTor2D MaxwellianEquilibrium::operator()(DFieldSpV2DTor2D const allfequilibrium) const
 {
-    IdxRangeSp const idxrange_sp = get_idx_range<Species>(allfequilibrium);
-    IdxRangeV2DTor2D const idxrange_v2dtor2d
-            = get_idx_range<GridVpar, GridMu, GridR, GridTheta>(allfequilibrium);
+    MaxwellianEvaluator const maxwellian = get_evaluator();
 
-    // Initialization of the maxwellian
-    ddc::for_each(idxrange_sp, [&](IdxSp const isp) {
-        compute_maxwellian(
-                allfequilibrium[isp],
-                m_density_eq[isp],
-                m_temperature_eq[isp],
-                m_mean_velocity_eq[isp],
-                m_magnetic_field);
-    });
+    // Initialization of the maxwellian for all species at once
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfequilibrium),
+            KOKKOS_LAMBDA(IdxSpV2DTor2D const ispv2dtor2d) {
+                allfequilibrium(ispv2dtor2d) = maxwellian(ispv2dtor2d);
+            });
     return allfequilibrium;
 }
 
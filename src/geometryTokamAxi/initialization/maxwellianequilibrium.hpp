@@ -6,6 +6,66 @@
 #include "iequilibrium.hpp"
 #include "species_info.hpp"
 
+/**
+ * @brief A function object which evaluates the normalized Maxwellian equilibrium at any index of
+ * the phase space (species, vpar, mu, r, theta).
+ *
+ * Only 2D profiles are stored so this object can be used inside kernels (sources, Krook operators,
+ * delta-f diagnostics, etc.) instead of a phase-space sized equilibrium distribution function.
+ */
+class MaxwellianEvaluator
+{
+    // n(r,theta) * (2*PI*T(r,theta))**(-1.5) for all kinetic species
+    DConstFieldSpTor2D m_prefactor;
+
+    // 1 / T(r,theta) for all kinetic species
+    DConstFieldSpTor2D m_inv_temperature;
+
+    // Upar(r,theta) for all kinetic species
+    DConstFieldSpTor2D m_mean_velocity;
+
+    // B(r,theta)
+    DConstFieldTor2D m_magnetic_field;
+
+public:
+    /**
+     * @brief The constructor for the MaxwellianEvaluator class.
+     * @param[in] prefactor The prefactor n*(2*PI*T)**(-1.5) of the Maxwellian.
+     * @param[in] inv_temperature The inverse of the temperature of the Maxwellian.
+     * @param[in] mean_velocity The mean velocity of the Maxwellian.
+     * @param[in] magnetic_field The magnetic field.
+     */
+    MaxwellianEvaluator(
+            DConstFieldSpTor2D prefactor,
+            DConstFieldSpTor2D inv_temperature,
+            DConstFieldSpTor2D mean_velocity,
+            DConstFieldTor2D magnetic_field)
+        : m_prefactor(prefactor)
+        , m_inv_temperature(inv_temperature)
+        , m_mean_velocity(mean_velocity)
+        , m_magnetic_field(magnetic_field)
+    {
+    }
+
+    /**
+     * @brief Evaluate the Maxwellian at a point of the phase space.
+     * @param[in] ispv2dtor2d The index of the point.
+     * @return The value of the Maxwellian at this point.
+     */
+    KOKKOS_FUNCTION double operator()(IdxSpV2DTor2D const ispv2dtor2d) const
+    {
+        IdxSpTor2D const isptor2d(ispv2dtor2d);
+        IdxTor2D const itor2d(ispv2dtor2d);
+        double const vpar = ddc::coordinate(ddc::select<GridVpar>(ispv2dtor2d));
+        double const mu = ddc::coordinate(ddc::select<GridMu>(ispv2dtor2d));
+        double const vpar_minus_Upar = vpar - m_mean_velocity(isptor2d);
+        double const energy = (0.5 * vpar_minus_Upar * vpar_minus_Upar
+                               + mu * m_magnetic_field(itor2d))
+                              * m_inv_temperature(isptor2d);
+        return m_prefactor(isptor2d) * Kokkos::exp(-energy);
+    }
+};
+
 /// Equilibrium operator as normalized Maxwellian. This initializes all species.
 class MaxwellianEquilibrium : public IEquilibrium
 {
@@ -22,6 +82,12 @@ private:
     // magnetic field
     DFieldMemTor2D m_magnetic_field;
 
+    // n*(2*PI*T)**(-1.5) of all kinetic species
+    DFieldMemSpTor2D m_prefactor;
+
+    // inverse of the equilibrium temperature of all kinetic species
+    DFieldMemSpTor2D m_inv_temperature;
+
 public:
     /**
      * @brief The constructor for the MaxwellianEquilibrium class.
@@ -40,11 +106,27 @@ public:
 
     /**
      * @brief Initializes allfequilibrium as a Maxwellian.
+     * All species are initialised in a single kernel.
      * @param[out] allfequilibrium A Field containing a Maxwellian distribution function.
      * @return A Field containing a Maxwellian distribution function.
      */
     DFieldSpV2DTor2D operator()(DFieldSpV2DTor2D allfequilibrium) const override;
 
+    /**
+     * @brief Get a function object which evaluates the Maxwellian at any index of the phase space.
+     * This avoids storing the equilibrium distribution function.
+     * The returned object refers to data owned by this class so it must not outlive it.
+     * @return The function object evaluating the Maxwellian.
+     */
+    MaxwellianEvaluator get_evaluator() const
+    {
+        return MaxwellianEvaluator(
+                get_const_field(m_prefactor),
+                get_const_field(m_inv_temperature),
+                get_const_field(m_mean_velocity_eq),
+                get_const_field(m_magnetic_field));
+    }
+
 
     /**
      * @brief Compute a Maxwellian distribution function.
@@ -17,29 +17,37 @@ MaxwellianEquilibrium::MaxwellianEquilibrium(
     , m_temperature_eq(std::move(temperature_eq))
     , m_mean_velocity_eq(std::move(mean_velocity_eq))
     , m_magnetic_field(magnetic_field)
+    , m_prefactor(get_idx_range(m_mass))
+    , m_inv_temperature(get_idx_range(m_mass))
+    , m_mean_velocity_eq_device(get_idx_range(m_mass))
 {
+    // Precompute the quantities which only depend on the species
+    IdxRangeSp const idxrange_sp = get_idx_range(m_mass);
+    host_t<DFieldMemSp> prefactor_host(idxrange_sp);
+    host_t<DFieldMemSp> inv_temperature_host(idxrange_sp);
+    for (IdxSp const isp : idxrange_sp) {
+        prefactor_host(isp) = MaxwellianEvaluator::
+                compute_prefactor(m_mass(isp), m_density_eq(isp), m_temperature_eq(isp));
+        inv_temperature_host(isp) = 1. / m_temperature_eq(isp);
+    }
+    ddc::parallel_deepcopy(get_field(m_prefactor), get_const_field(prefactor_host));
+    ddc::parallel_deepcopy(get_field(m_inv_temperature), get_const_field(inv_temperature_host));
+    ddc::parallel_deepcopy(
+            get_field(m_mean_velocity_eq_device),
+            get_const_field(m_mean_velocity_eq));
 }
 
 DFieldSpVparMu MaxwellianEquilibrium::operator()(DFieldSpVparMu const allfequilibrium) const
 {
-    IdxRangeSp const idxrange_sp = get_idx_range<Species>(allfequilibrium);
-    IdxRangeVparMu const idxrange_vparmu = get_idx_range<GridVpar, GridMu>(allfequilibrium);
-
-    // Initialization of the maxwellian
-    DFieldMemVparMu maxwellian_alloc(idxrange_vparmu);
-    DFieldVparMu maxwellian = get_field(maxwellian_alloc);
-    double const magnetic_field(1.0);
-    ddc::for_each(idxrange_sp, [&](IdxSp const isp) {
-        compute_maxwellian(
-                maxwellian,
-                m_mass(isp),
-                m_density_eq(isp),
-                m_temperature_eq(isp),
-                m_mean_velocity_eq(isp),
-                magnetic_field);
+    MaxwellianEvaluator const maxwellian = get_evaluator();
 
-        ddc::parallel_deepcopy(allfequilibrium[isp], maxwellian);
-    });
+    // Initialization of the maxwellian for all species at once
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfequilibrium),
+            KOKKOS_LAMBDA(IdxSpVparMu const ispvparmu) {
+                allfequilibrium(ispvparmu) = maxwellian(ispvparmu);
+            });
     return allfequilibrium;
 }
 
@@ -78,23 +86,20 @@ void MaxwellianEquilibrium::compute_maxwellian(
         double const mean_velocity,
         double const magnetic_field)
 {
-    double const mass_on_2piT = mass / (2. * M_PI * temperature);
-    double const coeff_maxw = Kokkos::sqrt(mass_on_2piT) * mass_on_2piT;
+    double const prefactor = MaxwellianEvaluator::compute_prefactor(mass, density, temperature);
+    double const inv_temperature = 1. / temperature;
     IdxRangeVparMu const idxrange_vparmu = get_idx_range<GridVpar, GridMu>(fMaxwellian);
 
-    // Compute fM(vpar,mu) = (2*PI*T)**1.5*n*exp(-energy) with
-    //  - n the density, T the temperature and Upar the mean velocity
-    //  - B the magnetic field and
-    //  - energy = (0.5*(vpar-Upar)**2+mu*B)/T
     ddc::parallel_for_each(
             Kokkos::DefaultExecutionSpace(),
             idxrange_vparmu,
             KOKKOS_LAMBDA(IdxVparMu const ivparmu) {
-                double const vpar = ddc::coordinate(ddc::select<GridVpar>(ivparmu));
-                double const mu = ddc::coordinate(ddc::select<GridMu>(ivparmu));
-                double const energy = (0.5 * (vpar - mean_velocity) * (vpar - mean_velocity)
-                                       + mu * magnetic_field)
-                                      / temperature;
-                fMaxwellian(ivparmu) = coeff_maxw * density * Kokkos::exp(-energy);
+                fMaxwellian(ivparmu) = MaxwellianEvaluator::maxwellian(
+                        prefactor,
+                        inv_temperature,
+                        mean_velocity,
+                        magnetic_field,
+                        ddc::coordinate(ddc::select<GridVpar>(ivparmu)),
+                        ddc::coordinate(ddc::select<GridMu>(ivparmu)));
             });
 }
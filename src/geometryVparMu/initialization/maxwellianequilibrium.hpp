@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <cmath>
 
 #include <paraconf.h>
 
@@ -9,6 +10,105 @@
 #include "paraconfpp.hpp"
 #include "species_info.hpp"
 
+/**
+ * @brief A function object which evaluates the Maxwellian equilibrium at any index of the
+ * phase space (species, vpar, mu).
+ *
+ * Only species-dependent coefficients are stored so this object can be used inside kernels
+ * instead of a phase-space sized equilibrium distribution function.
+ */
+class MaxwellianEvaluator
+{
+    // n*(m/(2*PI*T))**1.5 for all kinetic species
+    DConstFieldSp m_prefactor;
+
+    // 1 / T for all kinetic species
+    DConstFieldSp m_inv_temperature;
+
+    // mean velocity of all kinetic species
+    DConstFieldSp m_mean_velocity;
+
+    // magnetic field
+    double m_magnetic_field;
+
+public:
+    /**
+     * @brief The constructor for the MaxwellianEvaluator class.
+     * @param[in] prefactor The prefactor n*(m/(2*PI*T))**1.5 of the Maxwellian.
+     * @param[in] inv_temperature The inverse of the temperature of the Maxwellian.
+     * @param[in] mean_velocity The mean velocity of the Maxwellian.
+     * @param[in] magnetic_field The magnetic field.
+     */
+    MaxwellianEvaluator(
+            DConstFieldSp prefactor,
+            DConstFieldSp inv_temperature,
+            DConstFieldSp mean_velocity,
+            double magnetic_field)
+        : m_prefactor(prefactor)
+        , m_inv_temperature(inv_temperature)
+        , m_mean_velocity(mean_velocity)
+        , m_magnetic_field(magnetic_field)
+    {
+    }
+
+    /**
+     * @brief Evaluate the Maxwellian at a point of the phase space.
+     * @param[in] ispvparmu The index of the point.
+     * @return The value of the Maxwellian at this point.
+     */
+    KOKKOS_FUNCTION double operator()(IdxSpVparMu const ispvparmu) const
+    {
+        IdxSp const isp(ispvparmu);
+        return maxwellian(
+                m_prefactor(isp),
+                m_inv_temperature(isp),
+                m_mean_velocity(isp),
+                m_magnetic_field,
+                ddc::coordinate(ddc::select<GridVpar>(ispvparmu)),
+                ddc::coordinate(ddc::select<GridMu>(ispvparmu)));
+    }
+
+    /**
+     * @brief Compute the prefactor n*(m/(2*PI*T))**1.5 of a Maxwellian.
+     * @param[in] mass The mass of the species.
+     * @param[in] density The density of the Maxwellian.
+     * @param[in] temperature The temperature of the Maxwellian.
+     * @return The prefactor of the Maxwellian.
+     */
+    KOKKOS_FUNCTION static double compute_prefactor(
+            double const mass,
+            double const density,
+            double const temperature)
+    {
+        double const mass_on_2piT = mass / (2. * M_PI * temperature);
+        return Kokkos::sqrt(mass_on_2piT) * mass_on_2piT * density;
+    }
+
+    /**
+     * @brief Evaluate the Maxwellian prefactor*exp(-E) with E = (0.5*(vpar-Upar)**2+mu*B)/T.
+     * @param[in] prefactor The prefactor n*(m/(2*PI*T))**1.5 of the Maxwellian.
+     * @param[in] inv_temperature The inverse of the temperature T of the Maxwellian.
+     * @param[in] mean_velocity The mean velocity Upar of the Maxwellian.
+     * @param[in] magnetic_field The magnetic field B.
+     * @param[in] vpar The parallel velocity.
+     * @param[in] mu The magnetic moment.
+     * @return The value of the Maxwellian.
+     */
+    KOKKOS_FUNCTION static double maxwellian(
+            double const prefactor,
+            double const inv_temperature,
+            double const mean_velocity,
+            double const magnetic_field,
+            double const vpar,
+            double const mu)
+    {
+        double const vpar_minus_Upar = vpar - mean_velocity;
+        double const energy = (0.5 * vpar_minus_Upar * vpar_minus_Upar + mu * magnetic_field)
+                              * inv_temperature;
+        return prefactor * Kokkos::exp(-energy);
+    }
+};
+
 /// Equilibrium operator as Maxwellian. This initializes all species.
 class MaxwellianEquilibrium : public IEquilibrium
 {
@@ -28,6 +128,15 @@ private:
     // magnetic field
     double m_magnetic_field;
 
+    // n*(m/(2*PI*T))**1.5 of all kinetic species
+    DFieldMemSp m_prefactor;
+
+    // inverse of the equilibrium temperature of all kinetic species
+    DFieldMemSp m_inv_temperature;
+
+    // equilibrium mean velocity of all kinetic species, stored on the device
+    DFieldMemSp m_mean_velocity_eq_device;
+
 public:
     /**
      * @brief The constructor for the MaxwellianEquilibrium class.
@@ -58,14 +167,31 @@ public:
 
     /**
      * @brief Initializes allfequilibrium as a Maxwellian.
+     * All species are initialised in a single kernel.
      * @param[out] allfequilibrium A Field containing a Maxwellian distribution function.
      * @return A Field containing a Maxwellian distribution function.
      */
     DFieldSpVparMu operator()(DFieldSpVparMu allfequilibrium) const override;
 
+    /**
+     * @brief Get a function object which evaluates the Maxwellian at any index of the phase space.
+     * This avoids storing the equilibrium distribution function.
+     * The returned object refers to data owned by this class so it must not outlive it.
+     * @return The function object evaluating the Maxwellian.
+     */
+    MaxwellianEvaluator get_evaluator() const
+    {
+        return MaxwellianEvaluator(
+                get_const_field(m_prefactor),
+                get_const_field(m_inv_temperature),
+                get_const_field(m_mean_velocity_eq_device),
+                m_magnetic_field);
+    }
+
 
     /**
      * @brief Compute a Maxwellian distribution function.
+     * The Maxwellian is evaluated with MaxwellianEvaluator::maxwellian.
      * The Maxwellian distribution function is defined as 
      * Compute $fM(v,mu) = (2*PI*T)**1.5*n*exp(-E)$ with
      *  - $n$ the density, $T$ the temperature and $u$ the mean velocity
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+#include "bsl_advection_xvx.hpp"
+
+template class SplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+template class SplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+template class PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+template class PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+template class PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
+template class PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
+template class BslAdvectionSpatial<GeometryXVx, GridX>;
+template class BslAdvectionVelocity<GeometryXVx, GridVx>;
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <ddc/ddc.hpp>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "geometry.hpp"
+#include "spline_interpolator.hpp"
+
+#ifdef PERIODIC_RDIMX
+/// The extrapolation rule used along X by the spline evaluator.
+using SplineXExtrapolationRule = ddc::PeriodicExtrapolationRule<X>;
+#else
+/// The extrapolation rule used along X by the spline evaluator.
+using SplineXExtrapolationRule = ddc::ConstantExtrapolationRule<X>;
+#endif
+
+/// The extrapolation rule used along Vx by the spline evaluator.
+using SplineVxExtrapolationRule = ddc::ConstantExtrapolationRule<Vx>;
+
+/// The spline interpolator along X built from SplineXBuilder and SplineXEvaluator.
+using SplineInterpolatorX = SplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+
+/// The spline interpolator along Vx built from SplineVxBuilder and SplineVxEvaluator.
+using SplineInterpolatorVx = SplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+
+/// The class which creates instances of SplineInterpolatorX.
+using PreallocatableSplineInterpolatorX = PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+
+/// The class which creates instances of SplineInterpolatorVx.
+using PreallocatableSplineInterpolatorVx = PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+
+/// The preallocatable spline interpolator along X built from SplineXBuilderGinkgo.
+using PreallocatableSplineInterpolatorXGinkgo = PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
+
+/// The preallocatable spline interpolator along Vx built from SplineVxBuilderGinkgo.
+using PreallocatableSplineInterpolatorVxGinkgo = PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
+
+/// The semi-Lagrangian advection along X.
+using BslAdvectionX = BslAdvectionSpatial<GeometryXVx, GridX>;
+
+/// The semi-Lagrangian advection along Vx.
+using BslAdvectionVx = BslAdvectionVelocity<GeometryXVx, GridVx>;
+
+// These classes are instantiated once in bsl_advection_xvx.cpp
+extern template class SplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+extern template class SplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+extern template class PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+extern template class PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridVx>;
+extern template class PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
+extern template class PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
+extern template class BslAdvectionSpatial<GeometryXVx, GridX>;
+extern template class BslAdvectionVelocity<GeometryXVx, GridVx>;
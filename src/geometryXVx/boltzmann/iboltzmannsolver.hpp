@@ -23,4 +23,19 @@ public:
      */
     virtual DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX efield, double dt)
             const = 0;
+
+    /**
+     * @brief Operator for solving the Boltzmann equation on one timestep for a distribution
+     * function stored in single precision.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving 
+     *                              the Boltzmann equation on one timestep.
+     * @param[in] efield The electric field computed at every spatial position.
+     * @param[in] dt The timestep.
+     * @return The distribution function after solving the Boltzmann equation.
+     */
+    virtual FieldSpXVx<float> operator()(
+            FieldSpXVx<float> allfdistribu,
+            DConstFieldX efield,
+            double dt) const = 0;
 };
@@ -16,8 +16,9 @@ SplitRightHandSideSolver::SplitRightHandSideSolver(
 {
 }
 
-DFieldSpXVx SplitRightHandSideSolver::operator()(
-        DFieldSpXVx const allfdistribu,
+template <class ElementType>
+void SplitRightHandSideSolver::apply_splitting(
+        FieldSpXVx<ElementType> const allfdistribu,
         DConstFieldX const electric_field,
         double const dt) const
 {
@@ -28,6 +29,22 @@ DFieldSpXVx SplitRightHandSideSolver::operator()(
     for (auto rhsit = m_rhs.rbegin(); rhsit != m_rhs.rend(); ++rhsit) {
         (*rhsit)(allfdistribu, dt / 2.);
     }
+}
+
+DFieldSpXVx SplitRightHandSideSolver::operator()(
+        DFieldSpXVx const allfdistribu,
+        DConstFieldX const electric_field,
+        double const dt) const
+{
+    apply_splitting(allfdistribu, electric_field, dt);
+    return allfdistribu;
+}
 
+FieldSpXVx<float> SplitRightHandSideSolver::operator()(
+        FieldSpXVx<float> const allfdistribu,
+        DConstFieldX const electric_field,
+        double const dt) const
+{
+    apply_splitting(allfdistribu, electric_field, dt);
     return allfdistribu;
 }
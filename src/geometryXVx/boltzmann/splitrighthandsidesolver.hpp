@@ -28,6 +28,13 @@ class SplitRightHandSideSolver : public IBoltzmannSolver
     /** Member vector containing the source terms. */
     std::vector<std::reference_wrapper<IRightHandSide const>> m_rhs;
 
+    // Apply the splitting to a distribution function stored with any precision.
+    template <class ElementType>
+    void apply_splitting(
+            FieldSpXVx<ElementType> allfdistribu,
+            DConstFieldX electric_field,
+            double dt) const;
+
 public:
     /**
      * @brief Creates an instance of the split boltzmann solver class.
@@ -53,4 +60,19 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX electric_field, double dt)
             const override;
+
+    /**
+     * @brief Solves a Boltzmann equation on a timestep dt for a distribution function stored in
+     * single precision. The sources and the advections are computed in double precision.
+     * @param[in, out] allfdistribu On input: the initial value of the distribution function.
+     *                              On output: the value of the distribution function after solving 
+     *                              the Boltzmann equation.
+     * @param[in] electric_field The electric field computed at all spatial positions. 
+     * @param[in] dt The timestep. 
+     * @return The distribution function after solving the Boltzmann equation.
+     */
+    FieldSpXVx<float> operator()(
+            FieldSpXVx<float> allfdistribu,
+            DConstFieldX electric_field,
+            double dt) const override;
 };
@@ -12,13 +12,31 @@ SplitVlasovSolver::SplitVlasovSolver(
 {
 }
 
-DFieldSpXVx SplitVlasovSolver::operator()(
-        DFieldSpXVx const allfdistribu,
+template <class ElementType>
+void SplitVlasovSolver::apply_splitting(
+        FieldSpXVx<ElementType> const allfdistribu,
         DConstFieldX const electric_field,
         double const dt) const
 {
     m_advec_x(allfdistribu, dt / 2);
     m_advec_vx(allfdistribu, electric_field, dt);
     m_advec_x(allfdistribu, dt / 2);
+}
+
+DFieldSpXVx SplitVlasovSolver::operator()(
+        DFieldSpXVx const allfdistribu,
+        DConstFieldX const electric_field,
+        double const dt) const
+{
+    apply_splitting(allfdistribu, electric_field, dt);
+    return allfdistribu;
+}
+
+FieldSpXVx<float> SplitVlasovSolver::operator()(
+        FieldSpXVx<float> const allfdistribu,
+        DConstFieldX const electric_field,
+        double const dt) const
+{
+    apply_splitting(allfdistribu, electric_field, dt);
     return allfdistribu;
 }
@@ -29,6 +29,13 @@ class SplitVlasovSolver : public IBoltzmannSolver
     /** Member advection operator in the vx direction*/
     IAdvectionVelocity<GeometryXVx, GridVx> const& m_advec_vx;
 
+    // Apply the splitting to a distribution function stored with any precision.
+    template <class ElementType>
+    void apply_splitting(
+            FieldSpXVx<ElementType> allfdistribu,
+            DConstFieldX electric_field,
+            double dt) const;
+
 public:
     /**
      * @brief Creates an instance of the split vlasov solver class.
@@ -52,4 +59,19 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX electric_field, double dt)
             const override;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt for a distribution function stored in
+     * single precision. Each advection is carried out in double precision.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving 
+     *                              the Vlasov equation.
+     * @param[in] electric_field The electric field computed at all spatial positions. 
+     * @param[in] dt The timestep. 
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    FieldSpXVx<float> operator()(
+            FieldSpXVx<float> allfdistribu,
+            DConstFieldX electric_field,
+            double dt) const override;
 };
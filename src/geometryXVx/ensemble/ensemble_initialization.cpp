@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_helper.hpp"
+#include "ensemble_initialization.hpp"
+
+EnsembleSingleModePerturbInitialization::EnsembleSingleModePerturbInitialization(
+        DConstFieldEnsSpVx fequilibrium,
+        host_t<IFieldMemSp> init_perturb_mode,
+        host_t<DFieldMemEnsSp> init_perturb_amplitude)
+    : m_fequilibrium(fequilibrium)
+    , m_init_perturb_mode(std::move(init_perturb_mode))
+    , m_init_perturb_amplitude(std::move(init_perturb_amplitude))
+{
+}
+
+DFieldSpEnsXVx EnsembleSingleModePerturbInitialization::operator()(
+        DFieldSpEnsXVx const allfdistribu) const
+{
+    IdxRangeSpEnsXVx const idx_range = get_idx_range(allfdistribu);
+    IdxRangeX const gridx = ddc::select<GridX>(idx_range);
+    double const Lx = ddcHelper::total_interval_length(gridx);
+
+    auto perturb_mode_alloc = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_init_perturb_mode));
+    auto perturb_amplitude_alloc = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_init_perturb_amplitude));
+    ConstFieldSp<int> const perturb_mode = get_const_field(perturb_mode_alloc);
+    DConstField<IdxRangeEnsSp> const perturb_amplitude = get_const_field(perturb_amplitude_alloc);
+    DConstFieldEnsSpVx const fequilibrium = m_fequilibrium;
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(IdxSpEnsXVx const ispensxvx) {
+                IdxSp const isp = ddc::select<Species>(ispensxvx);
+                IdxEns const iens = ddc::select<GridEnsemble>(ispensxvx);
+                IdxX const ix = ddc::select<GridX>(ispensxvx);
+                IdxVx const ivx = ddc::select<GridVx>(ispensxvx);
+                double const kx = perturb_mode(isp) * 2. * M_PI / Lx;
+                double const perturbation
+                        = perturb_amplitude(iens, isp) * Kokkos::cos(kx * ddc::coordinate(ix));
+                double fdistribu_val = fequilibrium(iens, isp, ivx) * (1. + perturbation);
+                if (fdistribu_val < 1.e-60) {
+                    fdistribu_val = 1.e-60;
+                }
+                allfdistribu(ispensxvx) = fdistribu_val;
+            });
+    return allfdistribu;
+}
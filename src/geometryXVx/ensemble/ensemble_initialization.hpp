@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "ddc_aliases.hpp"
+#include "geometry_ensemble.hpp"
+
+/**
+ * @brief A class that initialises the distribution function of all the members of an ensemble
+ * as a perturbed equilibrium.
+ *
+ * Each member has its own equilibrium and its own perturbation amplitudes:
+ * @f$ f(x, v) = f_{eq}(v) (1 + A \cos(k x)) @f$
+ * with @f$ k = 2 \pi m / L_x @f$ where m is the perturbation mode of the species.
+ */
+class EnsembleSingleModePerturbInitialization
+{
+    DConstFieldEnsSpVx m_fequilibrium;
+
+    host_t<IFieldMemSp> m_init_perturb_mode;
+
+    host_t<DFieldMemEnsSp> m_init_perturb_amplitude;
+
+public:
+    /**
+     * @brief Creates an instance of the EnsembleSingleModePerturbInitialization class.
+     * @param[in] fequilibrium The equilibrium distribution function of each member.
+     * @param[in] init_perturb_mode The perturbation mode of each species.
+     * @param[in] init_perturb_amplitude The perturbation amplitude of each species of each member.
+     */
+    EnsembleSingleModePerturbInitialization(
+            DConstFieldEnsSpVx fequilibrium,
+            host_t<IFieldMemSp> init_perturb_mode,
+            host_t<DFieldMemEnsSp> init_perturb_amplitude);
+
+    /**
+     * @brief Initialises the distribution function of all the members.
+     * @param[out] allfdistribu The initialised distribution function.
+     * @return The initialised distribution function.
+     */
+    DFieldSpEnsXVx operator()(DFieldSpEnsXVx allfdistribu) const;
+};
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include "ensemble_predcorr.hpp"
+#include "ensemble_qnsolver.hpp"
+#include "predcorr_steps.hpp"
+
+EnsemblePredCorr::EnsemblePredCorr(
+        IAdvectionSpatial<GeometryEnsXVx, GridX> const& advec_x,
+        IAdvectionVelocity<GeometryEnsXVx, GridVx> const& advec_vx,
+        EnsembleQNSolver const& poisson_solver,
+        int const nbstep_diag)
+    : m_advec_x(advec_x)
+    , m_advec_vx(advec_vx)
+    , m_poisson_solver(poisson_solver)
+    , m_nbstep_diag(nbstep_diag)
+{
+    assert(nbstep_diag >= 0);
+}
+
+void EnsemblePredCorr::solve_vlasov(
+        DFieldSpEnsXVx const allfdistribu,
+        DConstFieldEnsX const electric_field,
+        double const dt) const
+{
+    m_advec_x(allfdistribu, dt / 2);
+    m_advec_vx(allfdistribu, electric_field, dt);
+    m_advec_x(allfdistribu, dt / 2);
+}
+
+void EnsemblePredCorr::save_diagnostics(
+        char const* const event,
+        int const iter,
+        double const time,
+        host_t<DConstFieldSpEnsXVx> const allfdistribu_host,
+        host_t<DConstFieldEnsX> const electrostatic_potential_host) const
+{
+    IdxRangeSpEnsXVx const idx_range = get_idx_range(allfdistribu_host);
+    IdxRangeSpXVx const idx_range_member(idx_range);
+    host_t<DFieldMemSpXVx> member_fdistribu_alloc(idx_range_member);
+    host_t<DFieldMemX> member_potential_alloc(ddc::select<GridX>(idx_range));
+    host_t<DFieldSpXVx> const member_fdistribu = get_field(member_fdistribu_alloc);
+    host_t<DFieldX> const member_potential = get_field(member_potential_alloc);
+    for (IdxEns const iens : ddc::select<GridEnsemble>(idx_range)) {
+        ddc::parallel_for_each(
+                Kokkos::DefaultHostExecutionSpace(),
+                idx_range_member,
+                [=](IdxSpXVx const ispxvx) {
+                    member_fdistribu(ispxvx) = allfdistribu_host(iens, ispxvx);
+                });
+        ddc::parallel_for_each(
+                Kokkos::DefaultHostExecutionSpace(),
+                get_idx_range(member_potential),
+                [=](IdxX const ix) {
+                    member_potential(ix) = electrostatic_potential_host(iens, ix);
+                });
+        ddc::PdiEvent(event)
+                .with("member", int(iens.uid()))
+                .and_with("iter", iter)
+                .and_with("time_saved", time)
+                .and_with("fdistribu", member_fdistribu)
+                .and_with("electrostatic_potential", member_potential);
+    }
+}
+
+DFieldSpEnsXVx EnsemblePredCorr::operator()(
+        DFieldSpEnsXVx const allfdistribu,
+        double const time_start,
+        double const dt,
+        int const steps) const
+{
+    IdxRangeEnsX const idx_range_ens_x = get_idx_range<GridEnsemble, GridX>(allfdistribu);
+
+    // The host copies are only needed to save the diagnostics
+    bool const has_diagnostics = m_nbstep_diag > 0;
+    host_t<DFieldMemSpEnsXVx> allfdistribu_host(
+            has_diagnostics ? get_idx_range(allfdistribu) : IdxRangeSpEnsXVx());
+    host_t<DFieldMemEnsX> electrostatic_potential_host(
+            has_diagnostics ? idx_range_ens_x : IdxRangeEnsX());
+
+    // electrostatic potential and electric field (depending only on the member and x)
+    DFieldMemEnsX electrostatic_potential(idx_range_ens_x);
+
+    DFieldMemEnsX electric_field(idx_range_ens_x);
+
+    // a chunk of the same size as fdistribu
+    DFieldMemSpEnsXVx allfdistribu_half_t(get_idx_range(allfdistribu));
+
+    predictor_corrector_steps(
+            allfdistribu,
+            get_field(allfdistribu_half_t),
+            get_field(electrostatic_potential),
+            get_field(electric_field),
+            [&](DFieldSpEnsXVx const fdistribu,
+                DConstFieldEnsX const efield,
+                double const duration) { solve_vlasov(fdistribu, efield, duration); },
+            m_poisson_solver,
+            [&](char const* const event, int const iter, double const time) {
+                ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+                ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+                save_diagnostics(
+                        event,
+                        iter,
+                        time,
+                        get_const_field(allfdistribu_host),
+                        get_const_field(electrostatic_potential_host));
+            },
+            time_start,
+            dt,
+            steps,
+            m_nbstep_diag);
+
+    return allfdistribu;
+}
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "geometry_ensemble.hpp"
+#include "iadvectionvx.hpp"
+#include "iadvectionx.hpp"
+
+class EnsembleQNSolver;
+
+/**
+ * @brief A class that solves the Vlasov-Poisson systems of all the members of an ensemble
+ * using a predictor-corrector scheme.
+ *
+ * The steps of the scheme are carried out by predictor_corrector_steps, as in PredCorr. The
+ * Vlasov equation is solved with a Strang splitting (advection along x on dt/2, along vx on dt
+ * and along x on dt/2) as in SplitVlasovSolver. All the operators are batched over the members
+ * so each kernel advances all the members at once.
+ *
+ * Every nbstep_diag steps, the distribution function and the electrostatic potential of each
+ * member are exposed to PDI in a separate "iteration" event together with the index of the
+ * member ("member").
+ */
+class EnsemblePredCorr
+{
+private:
+    IAdvectionSpatial<GeometryEnsXVx, GridX> const& m_advec_x;
+
+    IAdvectionVelocity<GeometryEnsXVx, GridVx> const& m_advec_vx;
+
+    EnsembleQNSolver const& m_poisson_solver;
+
+    int m_nbstep_diag;
+
+public:
+    /**
+     * @brief Creates an instance of the ensemble predictor-corrector class.
+     * @param[in] advec_x An advection operator along the x direction for all the members.
+     * @param[in] advec_vx An advection operator along the vx direction for all the members.
+     * @param[in] poisson_solver A solver for the Quasi-Neutrality equations of all the members.
+     * @param[in] nbstep_diag The number of steps between two outputs of the diagnostics. If it
+     *                  is 0 then no diagnostics are saved.
+     */
+    EnsemblePredCorr(
+            IAdvectionSpatial<GeometryEnsXVx, GridX> const& advec_x,
+            IAdvectionVelocity<GeometryEnsXVx, GridVx> const& advec_vx,
+            EnsembleQNSolver const& poisson_solver,
+            int nbstep_diag = 1);
+
+    /**
+     * @brief Solves the Vlasov-Poisson systems.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function of all the members.
+     *                              On output : the value of the distribution function after solving
+     *                              the Vlasov-Poisson systems a given number of iterations.
+     * @param[in] time_start The physical time at the start of the simulation.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed by the predictor-corrector.
+     * @return The distribution function after solving the system.
+     */
+    DFieldSpEnsXVx operator()(
+            DFieldSpEnsXVx allfdistribu,
+            double time_start,
+            double dt,
+            int steps = 1) const;
+
+private:
+    void solve_vlasov(DFieldSpEnsXVx allfdistribu, DConstFieldEnsX electric_field, double dt)
+            const;
+
+    void save_diagnostics(
+            char const* event,
+            int iter,
+            double time,
+            host_t<DConstFieldSpEnsXVx> allfdistribu_host,
+            host_t<DConstFieldEnsX> electrostatic_potential_host) const;
+};
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include "charge_density.hpp"
+#include "ensemble_qnsolver.hpp"
+#include "species_info.hpp"
+#include "workspace_arena.hpp"
+
+EnsembleQNSolver::EnsembleQNSolver(
+        PoissonSolver const& solve_poisson,
+        DConstFieldVx const quadrature_coeffs)
+    : m_solve_poisson(solve_poisson)
+    , m_quadrature(quadrature_coeffs)
+    , m_charges(get_idx_range(ddc::host_discrete_space<Species>().charges()))
+{
+    ddc::parallel_deepcopy(get_field(m_charges), ddc::host_discrete_space<Species>().charges());
+}
+
+void EnsembleQNSolver::compute_charge_density(
+        DFieldEnsX const rho,
+        DConstFieldSpEnsXVx const allfdistribu) const
+{
+    Kokkos::Profiling::pushRegion("EnsembleChargeDensity");
+    ::compute_charge_density(m_quadrature, rho, allfdistribu, get_const_field(m_charges));
+    Kokkos::Profiling::popRegion();
+}
+
+void EnsembleQNSolver::operator()(
+        DFieldEnsX const electrostatic_potential,
+        DFieldEnsX const electric_field,
+        DConstFieldSpEnsXVx const allfdistribu) const
+{
+    Kokkos::Profiling::pushRegion("EnsembleQNSolver");
+    WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+            get_workspace_arena());
+    assert(get_idx_range(electrostatic_potential)
+           == (get_idx_range<GridEnsemble, GridX>(allfdistribu)));
+    DWorkspaceFieldMem<IdxRangeEnsX> rho(get_idx_range(electrostatic_potential));
+
+    compute_charge_density(get_field(rho), allfdistribu);
+
+    m_solve_poisson(electrostatic_potential, electric_field, get_field(rho));
+
+    Kokkos::Profiling::popRegion();
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include "ddc_aliases.hpp"
+#include "geometry_ensemble.hpp"
+#include "ipoisson_solver.hpp"
+#include "quadrature.hpp"
+#include "species_info.hpp"
+
+/**
+ * @brief An operator which solves the Quasi-Neutrality equation for all the members of an
+ * ensemble at once.
+ *
+ * The charge density of each member is computed by integrating the distribution function
+ * over the velocity (with the same kernel as ChargeDensityCalculator) and the Poisson equation
+ * @f$ - \frac{d^2 \phi}{dx^2} = \rho @f$
+ * is solved by a Poisson solver batched over the members.
+ */
+class EnsembleQNSolver
+{
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeX,
+            IdxRangeEnsX,
+            std::experimental::layout_right,
+            typename Kokkos::DefaultExecutionSpace::memory_space>;
+    PoissonSolver const& m_solve_poisson;
+    Quadrature<IdxRangeVx, IdxRangeEnsXVx> m_quadrature;
+    // The charges of all the species, copied to the device once
+    DFieldMemSp m_charges;
+
+public:
+    /**
+     * Construct the EnsembleQNSolver operator.
+     * The species must be initialised as their charges are copied to the device.
+     *
+     * @param solve_poisson The operator which solves the Poisson equation of all the members.
+     * @param quadrature_coeffs The coefficients of the quadrature used to integrate over the velocity.
+     */
+    EnsembleQNSolver(PoissonSolver const& solve_poisson, DConstFieldVx quadrature_coeffs);
+
+    /**
+     * The operator which solves the equation using the method described by the class.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential of each member.
+     * @param[out] electric_field The electric field of each member.
+     * @param[in] allfdistribu The distribution function of all the members.
+     */
+    void operator()(
+            DFieldEnsX electrostatic_potential,
+            DFieldEnsX electric_field,
+            DConstFieldSpEnsXVx allfdistribu) const;
+
+    /**
+     * Compute the charge density of each member.
+     *
+     * @param[out] rho The charge density of each member.
+     * @param[in] allfdistribu The distribution function of all the members.
+     */
+    void compute_charge_density(DFieldEnsX rho, DConstFieldSpEnsXVx allfdistribu) const;
+};
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "bsl_advection_xvx.hpp"
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "spline_interpolator.hpp"
+
+/**
+ * @brief A discrete dimension indexing the members of an ensemble of independent simulations.
+ *
+ * The members share the same mesh but may have different physical parameters.
+ */
+struct GridEnsemble
+{
+};
+
+using IdxEns = Idx<GridEnsemble>;
+using IdxStepEns = IdxStep<GridEnsemble>;
+using IdxRangeEns = IdxRange<GridEnsemble>;
+
+using IdxEnsX = Idx<GridEnsemble, GridX>;
+using IdxEnsSp = Idx<GridEnsemble, Species>;
+using IdxEnsSpVx = Idx<GridEnsemble, Species, GridVx>;
+using IdxSpEnsXVx = Idx<Species, GridEnsemble, GridX, GridVx>;
+
+using IdxRangeEnsX = IdxRange<GridEnsemble, GridX>;
+using IdxRangeEnsSp = IdxRange<GridEnsemble, Species>;
+using IdxRangeEnsSpVx = IdxRange<GridEnsemble, Species, GridVx>;
+using IdxRangeEnsXVx = IdxRange<GridEnsemble, GridX, GridVx>;
+using IdxRangeSpEnsXVx = IdxRange<Species, GridEnsemble, GridX, GridVx>;
+
+using DFieldMemEnsX = DFieldMem<IdxRangeEnsX>;
+using DFieldMemEnsSp = DFieldMem<IdxRangeEnsSp>;
+using DFieldMemEnsSpVx = DFieldMem<IdxRangeEnsSpVx>;
+using DFieldMemSpEnsXVx = DFieldMem<IdxRangeSpEnsXVx>;
+
+using DFieldEnsX = DField<IdxRangeEnsX>;
+using DFieldEnsSpVx = DField<IdxRangeEnsSpVx>;
+using DFieldSpEnsXVx = DField<IdxRangeSpEnsXVx>;
+
+using DConstFieldEnsX = DConstField<IdxRangeEnsX>;
+using DConstFieldEnsSpVx = DConstField<IdxRangeEnsSpVx>;
+using DConstFieldSpEnsXVx = DConstField<IdxRangeSpEnsXVx>;
+
+/**
+ * @brief A class providing aliases for useful subindex ranges of an ensemble of (x, vx)
+ * simulations. It is used as template parameter for generic dimensionality-agnostic operators
+ * such as advections.
+ *
+ * The ensemble dimension is treated as a batch dimension of the spatial index range so that
+ * each member has its own electric field. The species remain the leading dimension of the
+ * distribution function so that the distribution function of one species is contiguous in
+ * memory.
+ */
+class GeometryEnsXVx
+{
+public:
+    /**
+     * @brief A templated type giving the velocity discretised dimension type associated to a spatial discretised dimension type.
+     */
+    template <class T>
+    using velocity_dim_for = std::conditional_t<std::is_same_v<T, GridX>, GridVx, void>;
+
+    /**
+     * @brief A templated type giving the spatial discretised dimension type associated to a velocity discretised dimension type.
+     */
+    template <class T>
+    using spatial_dim_for = std::conditional_t<std::is_same_v<T, GridVx>, GridX, void>;
+
+    /**
+     * @brief An alias for the spatial discrete index range type (batched over the members).
+     */
+    using IdxRangeSpatial = IdxRangeEnsX;
+
+    /**
+     * @brief An alias for the velocity discrete index range type.
+     */
+    using IdxRangeVelocity = IdxRangeVx;
+
+    /**
+     * @brief An alias for the whole distribution function discrete index range type.
+     */
+    using IdxRangeFdistribu = IdxRangeSpEnsXVx;
+};
+
+/// The spline builder along X batched over the members of the ensemble.
+using SplineXBuilderEns = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        GridX,
+        SplineXBoundary,
+        SplineXBoundary,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+
+/// The spline evaluator along X batched over the members of the ensemble.
+using SplineXEvaluatorEns = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        GridX,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+
+/// The spline builder along Vx batched over the members of the ensemble.
+using SplineVxBuilderEns = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+
+/// The spline evaluator along Vx batched over the members of the ensemble.
+using SplineVxEvaluatorEns = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+
+/// The interpolator along X batched over the members of the ensemble.
+using PreallocatableSplineInterpolatorXEns = PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+
+/// The interpolator along Vx batched over the members of the ensemble.
+using PreallocatableSplineInterpolatorVxEns = PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+
+/// The semi-Lagrangian advection along X of all the members of the ensemble.
+using BslAdvectionEnsX = BslAdvectionSpatial<GeometryEnsXVx, GridX>;
+
+/// The semi-Lagrangian advection along Vx of all the members of the ensemble.
+using BslAdvectionEnsVx = BslAdvectionVelocity<GeometryEnsXVx, GridVx>;
@@ -59,8 +59,16 @@ using CoordXVx = Coord<X, Vx>;
 int constexpr BSDegreeX = 3;
 int constexpr BSDegreeVx = 3;
 
+#ifdef NON_UNIFORM_BSPLINES_X
+bool constexpr BsplineOnUniformCellsX = false;
+#else
 bool constexpr BsplineOnUniformCellsX = true;
+#endif
+#ifdef NON_UNIFORM_BSPLINES_VX
+bool constexpr BsplineOnUniformCellsVx = false;
+#else
 bool constexpr BsplineOnUniformCellsVx = true;
+#endif
 
 struct BSplinesX
     : std::conditional_t<
@@ -102,6 +110,16 @@ using SplineXBuilder = ddc::SplineBuilder<
         ddc::SplineSolver::LAPACK,
         GridX,
         GridVx>;
+using SplineXBuilderGinkgo = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        GridX,
+        SplineXBoundary,
+        SplineXBoundary,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
 using SplineXEvaluator = ddc::SplineEvaluator<
         Kokkos::DefaultExecutionSpace,
         Kokkos::DefaultExecutionSpace::memory_space,
@@ -126,6 +144,16 @@ using SplineVxBuilder = ddc::SplineBuilder<
         ddc::SplineSolver::LAPACK,
         GridX,
         GridVx>;
+using SplineVxBuilderGinkgo = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        ddc::SplineSolver::GINKGO,
+        GridX,
+        GridVx>;
 using SplineVxEvaluator = ddc::SplineEvaluator<
         Kokkos::DefaultExecutionSpace,
         Kokkos::DefaultExecutionSpace::memory_space,
@@ -174,6 +202,25 @@ using SplineVxEvaluator_1d = ddc::SplineEvaluator<
         ddc::ConstantExtrapolationRule<Vx>,
         ddc::ConstantExtrapolationRule<Vx>,
         GridVx>;
+using SplineSpVxBuilder = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        ddc::SplineSolver::LAPACK,
+        Species,
+        GridVx>;
+using SplineSpVxEvaluator = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        ddc::ConstantExtrapolationRule<Vx>,
+        ddc::ConstantExtrapolationRule<Vx>,
+        Species,
+        GridVx>;
 
 struct GridMom : Moments
 {
@@ -37,4 +37,14 @@ public:
      * @return rho The charge density.
      */
     DFieldX operator()(DFieldX rho, DConstFieldSpXVx allfdistribu) const final;
+
+    /**
+     * @brief Computes the charge density rho from a distribution function stored in single
+     * precision. The integrals are accumulated in double precision.
+     * @param[in, out] rho
+     * @param[in] allfdistribu 
+     *
+     * @return rho The charge density.
+     */
+    DFieldX operator()(DFieldX rho, ConstFieldSpXVx<float> allfdistribu) const final;
 };
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include "deltafchargedensitycalculator.hpp"
+
+DeltaFChargeDensityCalculator::DeltaFChargeDensityCalculator(
+        IChargeDensityCalculator const& charge_density_calculator,
+        DConstFieldVx const coeffs,
+        DConstFieldSpVx const allfequilibrium)
+    : m_charge_density_calculator(charge_density_calculator)
+    , m_equilibrium_charge_density(0.0)
+{
+    auto coeffs_host = ddc::create_mirror_view_and_copy(coeffs);
+    auto allfequilibrium_host = ddc::create_mirror_view_and_copy(allfequilibrium);
+    ddc::for_each(get_idx_range(allfequilibrium_host), [&](IdxSpVx const ispvx) {
+        IdxSp const isp = ddc::select<Species>(ispvx);
+        IdxVx const ivx = ddc::select<GridVx>(ispvx);
+        m_equilibrium_charge_density
+                += charge(isp) * coeffs_host(ivx) * allfequilibrium_host(ispvx);
+    });
+}
+
+namespace {
+/**
+ * Compute the charge density of the perturbation with the wrapped operator and add the
+ * charge density of the equilibrium.
+ */
+template <class ElementType>
+void compute_delta_f_charge_density(
+        IChargeDensityCalculator const& charge_density_calculator,
+        double const equilibrium_charge_density,
+        DFieldX const rho,
+        ConstFieldSpXVx<ElementType> const allfdistribu)
+{
+    Kokkos::Profiling::pushRegion("DeltaFChargeDensityCalculator");
+
+    charge_density_calculator(rho, allfdistribu);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(rho),
+            KOKKOS_LAMBDA(IdxX ix) { rho(ix) += equilibrium_charge_density; });
+
+    Kokkos::Profiling::popRegion();
+}
+} // namespace
+
+DFieldX DeltaFChargeDensityCalculator::operator()(
+        DFieldX const rho,
+        DConstFieldSpXVx const allfdistribu) const
+{
+    compute_delta_f_charge_density(
+            m_charge_density_calculator,
+            m_equilibrium_charge_density,
+            rho,
+            allfdistribu);
+    return rho;
+}
+
+DFieldX DeltaFChargeDensityCalculator::operator()(
+        DFieldX const rho,
+        ConstFieldSpXVx<float> const allfdistribu) const
+{
+    compute_delta_f_charge_density(
+            m_charge_density_calculator,
+            m_equilibrium_charge_density,
+            rho,
+            allfdistribu);
+    return rho;
+}
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <ddc/ddc.hpp>
+
+#include "geometry.hpp"
+#include "ichargedensitycalculator.hpp"
+
+/**
+ * @brief A class which computes the charge density when the distribution function is stored
+ * as a perturbation @f$ \delta f_s = f_s - f_{eq,s} @f$ around an equilibrium.
+ *
+ * The charge density is linear in the distribution function so it is calculated as:
+ * @f$ \rho(x) = \rho[\delta f](x) + \sum_s \int_{v} q_s f_{eq,s}(v) dv @f$
+ * where @f$ \rho[\delta f] @f$ is calculated by the wrapped charge density calculator.
+ * The equilibrium does not depend on x so its contribution is a constant which is calculated
+ * once at construction.
+ */
+class DeltaFChargeDensityCalculator : public IChargeDensityCalculator
+{
+private:
+    IChargeDensityCalculator const& m_charge_density_calculator;
+
+    // The charge density of the equilibrium distribution function
+    double m_equilibrium_charge_density;
+
+public:
+    /**
+     * @brief Create a DeltaFChargeDensityCalculator object.
+     * @param[in] charge_density_calculator
+     *            The operator which calculates the charge density of a full distribution function.
+     * @param[in] coeffs
+     *            The coefficients of the quadrature used to integrate the equilibrium.
+     * @param[in] allfequilibrium
+     *            The equilibrium distribution function of each kinetic species.
+     */
+    DeltaFChargeDensityCalculator(
+            IChargeDensityCalculator const& charge_density_calculator,
+            DConstFieldVx coeffs,
+            DConstFieldSpVx allfequilibrium);
+
+    /**
+     * @brief Computes the charge density rho from the perturbation of the distribution function.
+     * @param[in, out] rho The charge density.
+     * @param[in] allfdistribu The perturbation @f$ f - f_{eq} @f$ of the distribution function.
+     *
+     * @return rho The charge density.
+     */
+    DFieldX operator()(DFieldX rho, DConstFieldSpXVx allfdistribu) const final;
+
+    /**
+     * @brief Computes the charge density rho from the perturbation of the distribution function
+     * stored in single precision.
+     * @param[in, out] rho The charge density.
+     * @param[in] allfdistribu The perturbation @f$ f - f_{eq} @f$ of the distribution function.
+     *
+     * @return rho The charge density.
+     */
+    DFieldX operator()(DFieldX rho, ConstFieldSpXVx<float> allfdistribu) const final;
+};
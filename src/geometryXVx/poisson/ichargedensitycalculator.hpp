@@ -24,4 +24,15 @@ public:
      * @return rho The charge density.
      */
     virtual DFieldX operator()(DFieldX rho, DConstFieldSpXVx allfdistribu) const = 0;
+
+    /**
+     * Calculate the charge density rho from a distribution function stored in single precision.
+     * The integrals are accumulated in double precision.
+     *
+     * @param[out] rho The charge density.
+     * @param[in] allfdistribu The distribution function.
+     *
+     * @return rho The charge density.
+     */
+    virtual DFieldX operator()(DFieldX rho, ConstFieldSpXVx<float> allfdistribu) const = 0;
 };
@@ -28,4 +28,17 @@ public:
             DFieldX electrostatic_potential,
             DFieldX electric_field,
             DConstFieldSpXVx allfdistribu) const = 0;
+
+    /**
+     * The operator which solves the equation for a distribution function stored in single
+     * precision.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field The electric field, the derivative of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    virtual void operator()(
+            DFieldX electrostatic_potential,
+            DFieldX electric_field,
+            ConstFieldSpXVx<float> allfdistribu) const = 0;
 };
@@ -8,3 +8,10 @@ void NullQNSolver::operator()(
         DConstFieldSpXVx const allfdistribu) const
 {
 }
+
+void NullQNSolver::operator()(
+        DFieldX const electrostatic_potential,
+        DFieldX const electric_field,
+        ConstFieldSpXVx<float> const allfdistribu) const
+{
+}
@@ -28,4 +28,16 @@ public:
             DFieldX const electrostatic_potential,
             DFieldX const electric_field,
             DConstFieldSpXVx const allfdistribu) const override;
+
+    /**
+     * The operator which does not solves the equation.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field The electric field, the derivative of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void operator()(
+            DFieldX const electrostatic_potential,
+            DFieldX const electric_field,
+            ConstFieldSpXVx<float> const allfdistribu) const override;
 };
@@ -9,6 +9,7 @@
 
 #include "geometry.hpp"
 #include "qnsolver.hpp"
+#include "workspace_arena.hpp"
 
 QNSolver::QNSolver(PoissonSolver const& solve_poisson, IChargeDensityCalculator const& compute_rho)
     : m_solve_poisson(solve_poisson)
@@ -20,12 +21,31 @@ void QNSolver::operator()(
         DFieldX const electrostatic_potential,
         DFieldX const electric_field,
         DConstFieldSpXVx const allfdistribu) const
+{
+    solve(electrostatic_potential, electric_field, allfdistribu);
+}
+
+void QNSolver::operator()(
+        DFieldX const electrostatic_potential,
+        DFieldX const electric_field,
+        ConstFieldSpXVx<float> const allfdistribu) const
+{
+    solve(electrostatic_potential, electric_field, allfdistribu);
+}
+
+template <class ElementType>
+void QNSolver::solve(
+        DFieldX const electrostatic_potential,
+        DFieldX const electric_field,
+        ConstFieldSpXVx<ElementType> const allfdistribu) const
 {
     Kokkos::Profiling::pushRegion("QNSolver");
+    WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+            get_workspace_arena());
     assert(get_idx_range(electrostatic_potential) == get_idx_range<GridX>(allfdistribu));
     IdxRangeX const idx_range_x = get_idx_range(electrostatic_potential);
     // Compute the RHS of the Quasi-Neutrality equation.
-    DFieldMemX rho(idx_range_x);
+    DWorkspaceFieldMem<IdxRangeX> rho(idx_range_x);
 
     m_compute_rho(rho, allfdistribu);
 
@@ -28,6 +28,13 @@ class QNSolver : public IQNSolver
     PoissonSolver const& m_solve_poisson;
     IChargeDensityCalculator const& m_compute_rho;
 
+    // Solve the equation for a distribution function stored with any precision.
+    template <class ElementType>
+    void solve(
+            DFieldX electrostatic_potential,
+            DFieldX electric_field,
+            ConstFieldSpXVx<ElementType> allfdistribu) const;
+
 public:
     /**
      * Construct the FftQNSolver operator.
@@ -50,4 +57,17 @@ public:
             DFieldX electrostatic_potential,
             DFieldX electric_field,
             DConstFieldSpXVx allfdistribu) const override;
+
+    /**
+     * The operator which solves the equation for a distribution function stored in single
+     * precision.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field The electric field, the derivative of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void operator()(
+            DFieldX electrostatic_potential,
+            DFieldX electric_field,
+            ConstFieldSpXVx<float> allfdistribu) const override;
 };
@@ -66,7 +66,7 @@ void CollisionsInter::get_derivative(DFieldSpXVx const df, DConstFieldSpXVx cons
 
     //Collision frequencies, momentum and energy exchange terms
     DFieldMemSpX nustar_profile(grid_sp_x);
-    ddc::parallel_deepcopy(nustar_profile, m_nustar_profile);
+    ddc::parallel_deepcopy(nustar_profile, m_nustar_profile[grid_sp_x]);
     DFieldMemSpX collfreq_ab(grid_sp_x);
     DFieldMemSpX momentum_exchange_ab_f(grid_sp_x);
     DFieldMemSpX energy_exchange_ab_f(grid_sp_x);
@@ -39,6 +39,8 @@ public:
 
     ~CollisionsInter() = default;
 
+    using IRightHandSide::operator();
+
     /**
      * @brief Update the distribution function for inter-species collision.
      *
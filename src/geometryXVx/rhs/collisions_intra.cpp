@@ -7,6 +7,7 @@
 #include "collisions_intra.hpp"
 #include "collisions_utils.hpp"
 #include "fluid_moments.hpp"
+#include "workspace_arena.hpp"
 
 template <class TargetDim>
 KOKKOS_FUNCTION Idx<TargetDim> CollisionsIntra::to_index(Idx<GridVx> const& index)
@@ -79,10 +80,16 @@ std::enable_if_t<ddc::is_uniform_point_sampling_v<VDim>> CollisionsIntra::
                     init(v0 - step / 2, vN + step / 2, IdxStep<GhostedVxStaggered>(ncells + 2)));
 }
 
-CollisionsIntra::CollisionsIntra(IdxRangeSpXVx const& mesh, double nustar0)
+CollisionsIntra::CollisionsIntra(
+        IdxRangeSpXVx const& mesh,
+        double nustar0,
+        int tile_size,
+        double tile_threshold)
     : m_nustar0(nustar0)
     , m_fthresh(1.e-30)
     , m_nustar_profile_alloc(ddc::select<Species, GridX>(mesh))
+    , m_quadrature_coeffs_alloc(trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+              ddc::select<GridVx>(mesh)))
     , m_gridvx_ghosted(Idx<GhostedVx>(0), IdxStep<GhostedVx>(ddc::select<GridVx>(mesh).size() + 2))
     , m_gridvx_ghosted_staggered(
               Idx<GhostedVxStaggered>(0),
@@ -92,7 +99,8 @@ CollisionsIntra::CollisionsIntra(IdxRangeSpXVx const& mesh, double nustar0)
               ddc::select<Species>(mesh),
               ddc::select<GridX>(mesh),
               m_gridvx_ghosted_staggered)
-
+    , m_tile_size(tile_size)
+    , m_tile_threshold(tile_threshold)
 {
     // validity checks
     if (ddc::select<Species>(mesh).size() != 2) {
@@ -101,6 +109,9 @@ CollisionsIntra::CollisionsIntra(IdxRangeSpXVx const& mesh, double nustar0)
     if (m_nustar0 == 0.) {
         throw std::invalid_argument("Collision operator should not be used with nustar0=0.");
     }
+    if (m_tile_size < 0) {
+        throw std::invalid_argument("The tile size of the collision operator must be positive.");
+    }
 
     build_ghosted_staggered_vx_point_sampling(ddc::select<GridVx>(mesh));
 
@@ -126,6 +137,54 @@ IdxRange<Species, GridX, CollisionsIntra::GhostedVx> const& CollisionsIntra::get
     return m_mesh_ghosted;
 }
 
+int CollisionsIntra::get_tile_size() const
+{
+    return m_tile_size;
+}
+
+KOKKOS_FUNCTION void CollisionsIntra::matrix_row_coefficients(
+        double& AA,
+        double& BB,
+        double& CC,
+        IdxVx const ivx,
+        double const Dcoll,
+        double const Dcoll_staggered,
+        double const Dcoll_staggered_prev,
+        double const Nucoll_prev,
+        double const Nucoll,
+        double const Nucoll_next,
+        double const deltat)
+{
+    IdxVx_ghosted ivx_ghosted(to_index<GhostedVx>(ivx));
+    IdxVx_ghosted ivx_next_ghosted(ivx_ghosted + 1);
+    IdxVx_ghosted ivx_prev_ghosted(ivx_ghosted - 1);
+
+    double const dv_i = ddc::coordinate(ivx_next_ghosted) - ddc::coordinate(ivx_ghosted);
+    double const delta_i
+            = dv_i / (ddc::coordinate(ivx_ghosted) - ddc::coordinate(ivx_prev_ghosted));
+
+    double const alpha_i = deltat / (dv_i * dv_i * (1. + delta_i));
+    double const beta_i = deltat / (2. * dv_i * (1. + delta_i));
+
+    double const coeffa = alpha_i
+                                  * (Dcoll_staggered_prev * delta_i * delta_i * delta_i
+                                     - Dcoll * delta_i * delta_i * (delta_i - 1.))
+                          + beta_i * Nucoll_prev * delta_i * delta_i;
+
+    double const coeffb = -alpha_i
+                                  * (-Dcoll_staggered
+                                     - Dcoll_staggered_prev * delta_i * delta_i * delta_i
+                                     + Dcoll * (delta_i - 1.) * (delta_i * delta_i - 1.))
+                          + beta_i * Nucoll * (delta_i * delta_i - 1.);
+
+    double const coeffc = alpha_i * (Dcoll_staggered + Dcoll * (delta_i - 1.))
+                          - beta_i * Nucoll_next;
+
+    AA = -coeffa;
+    BB = 1. + coeffb;
+    CC = -coeffc;
+}
+
 void CollisionsIntra::compute_matrix_coeff(
         DFieldSpXVx AA,
         DFieldSpXVx BB,
@@ -139,49 +198,24 @@ void CollisionsIntra::compute_matrix_coeff(
             Kokkos::DefaultExecutionSpace(),
             get_idx_range(AA),
             KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
-                IdxSp const isp = ddc::select<Species>(ispxvx);
-                IdxX const ix = ddc::select<GridX>(ispxvx);
+                IdxSpX const ispx(ispxvx);
                 IdxVx const ivx = ddc::select<GridVx>(ispxvx);
 
                 IdxVx_ghosted ivx_ghosted(to_index<GhostedVx>(ivx));
                 IdxVx_ghosted_staggered ivx_ghosted_staggered(to_index<GhostedVxStaggered>(ivx));
-                IdxVx_ghosted ivx_next_ghosted(ivx_ghosted + 1);
-                IdxVx_ghosted ivx_prev_ghosted(ivx_ghosted - 1);
-                IdxVx_ghosted_staggered ivx_prev_ghosted_staggered(ivx_ghosted_staggered - 1);
-
-                double const dv_i
-                        = ddc::coordinate(ivx_next_ghosted) - ddc::coordinate(ivx_ghosted);
-                double const delta_i
-                        = dv_i / (ddc::coordinate(ivx_ghosted) - ddc::coordinate(ivx_prev_ghosted));
-
-                double const alpha_i = deltat / (dv_i * dv_i * (1. + delta_i));
-                double const beta_i = deltat / (2. * dv_i * (1. + delta_i));
-
-                double const coeffa
-                        = alpha_i
-                                  * (Dcoll_staggered(isp, ix, ivx_prev_ghosted_staggered) * delta_i
-                                             * delta_i * delta_i
-                                     - Dcoll(isp, ix, ivx_ghosted) * delta_i * delta_i
-                                               * (delta_i - 1.))
-                          + beta_i * Nucoll(isp, ix, ivx_prev_ghosted) * delta_i * delta_i;
-
-                double const coeffb
-                        = -alpha_i
-                                  * (-Dcoll_staggered(isp, ix, ivx_ghosted_staggered)
-                                     - Dcoll_staggered(isp, ix, ivx_prev_ghosted_staggered)
-                                               * delta_i * delta_i * delta_i
-                                     + Dcoll(isp, ix, ivx_ghosted) * (delta_i - 1.)
-                                               * (delta_i * delta_i - 1.))
-                          + beta_i * Nucoll(isp, ix, ivx_ghosted) * (delta_i * delta_i - 1.);
-
-                double const coeffc = alpha_i
-                                              * (Dcoll_staggered(isp, ix, ivx_ghosted_staggered)
-                                                 + Dcoll(isp, ix, ivx_ghosted) * (delta_i - 1.))
-                                      - beta_i * Nucoll(isp, ix, ivx_next_ghosted);
-
-                AA(ispxvx) = -coeffa;
-                BB(ispxvx) = 1. + coeffb;
-                CC(ispxvx) = -coeffc;
+
+                matrix_row_coefficients(
+                        AA(ispxvx),
+                        BB(ispxvx),
+                        CC(ispxvx),
+                        ivx,
+                        Dcoll(ispx, ivx_ghosted),
+                        Dcoll_staggered(ispx, ivx_ghosted_staggered),
+                        Dcoll_staggered(ispx, ivx_ghosted_staggered - 1),
+                        Nucoll(ispx, ivx_ghosted - 1),
+                        Nucoll(ispx, ivx_ghosted),
+                        Nucoll(ispx, ivx_ghosted + 1),
+                        deltat);
             });
 }
 
@@ -249,22 +283,25 @@ void CollisionsIntra::compute_rhs_vector(
 DFieldSpXVx CollisionsIntra::operator()(DFieldSpXVx allfdistribu, double dt) const
 {
     Kokkos::Profiling::pushRegion("CollisionsIntra");
-    auto allfdistribu_alloc = ddc::create_mirror_view_and_copy(allfdistribu);
-    host_t<DFieldSpXVx> allfdistribu_host = get_field(allfdistribu_alloc);
+    if (m_tile_size > 0) {
+        apply_on_active_tiles(allfdistribu, dt);
+        Kokkos::Profiling::popRegion();
+        return allfdistribu;
+    }
+
+    WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+            get_workspace_arena());
 
     IdxRangeSpX grid_sp_x(get_idx_range<Species, GridX>(allfdistribu));
     // density and temperature
-    DFieldMemSpX density_alloc(grid_sp_x);
-    DFieldMemSpX fluid_velocity_alloc(grid_sp_x);
-    DFieldMemSpX temperature_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> density_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> fluid_velocity_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> temperature_alloc(grid_sp_x);
     DFieldSpX density = get_field(density_alloc);
     DFieldSpX fluid_velocity = get_field(fluid_velocity_alloc);
     DFieldSpX temperature = get_field(temperature_alloc);
 
-    DFieldMemVx const quadrature_coeffs_alloc(
-            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
-                    get_idx_range<GridVx>(allfdistribu)));
-    DConstFieldVx quadrature_coeffs = get_const_field(quadrature_coeffs_alloc);
+    DConstFieldVx quadrature_coeffs = get_const_field(m_quadrature_coeffs_alloc);
 
     //Moments computation
     ddc::parallel_fill(density, 0.);
@@ -287,41 +324,46 @@ DFieldSpXVx CollisionsIntra::operator()(DFieldSpXVx allfdistribu, double dt) con
             });
 
     // collision frequency
-    DFieldMemSpX collfreq_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> collfreq_alloc(grid_sp_x);
     DFieldSpX collfreq = get_field(collfreq_alloc);
-    DFieldMemSpX nustar_profile(grid_sp_x);
-    ddc::parallel_deepcopy(nustar_profile, m_nustar_profile);
-    compute_collfreq(collfreq, nustar_profile, density, temperature);
+    compute_collfreq(collfreq, get_const_field(m_nustar_profile_alloc), density, temperature);
+
+    // The operator may be applied to a part of the spatial index range
+    IdxRangeSpXVx_ghosted const mesh_ghosted(grid_sp_x, m_gridvx_ghosted);
+    IdxRangeSpXVx_ghosted_staggered const mesh_ghosted_staggered(
+            grid_sp_x,
+            m_gridvx_ghosted_staggered);
 
     // diffusion coefficient
-    DFieldMem<IdxRangeSpXVx_ghosted> Dcoll_alloc(m_mesh_ghosted);
+    DWorkspaceFieldMem<IdxRangeSpXVx_ghosted> Dcoll_alloc(mesh_ghosted);
     DField<IdxRangeSpXVx_ghosted> Dcoll = get_field(Dcoll_alloc);
     compute_Dcoll<GhostedVx>(Dcoll, collfreq, density, temperature);
 
-    DFieldMem<IdxRangeSpXVx_ghosted> dvDcoll_alloc(m_mesh_ghosted);
+    DWorkspaceFieldMem<IdxRangeSpXVx_ghosted> dvDcoll_alloc(mesh_ghosted);
     DField<IdxRangeSpXVx_ghosted> dvDcoll = get_field(dvDcoll_alloc);
     compute_dvDcoll<GhostedVx>(dvDcoll, collfreq, density, temperature);
 
-    DFieldMem<IdxRangeSpXVx_ghosted_staggered> Dcoll_staggered_alloc(m_mesh_ghosted_staggered);
+    DWorkspaceFieldMem<IdxRangeSpXVx_ghosted_staggered> Dcoll_staggered_alloc(
+            mesh_ghosted_staggered);
     DField<IdxRangeSpXVx_ghosted_staggered> Dcoll_staggered = get_field(Dcoll_staggered_alloc);
     compute_Dcoll<GhostedVxStaggered>(Dcoll_staggered, collfreq, density, temperature);
 
     // kernel maxwellian fluid moments
-    DFieldMemSpX Vcoll_alloc(grid_sp_x);
-    DFieldMemSpX Tcoll_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> Vcoll_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> Tcoll_alloc(grid_sp_x);
     DFieldSpX Vcoll = get_field(Vcoll_alloc);
     DFieldSpX Tcoll = get_field(Tcoll_alloc);
     compute_Vcoll_Tcoll<GhostedVx>(Vcoll, Tcoll, allfdistribu, Dcoll, dvDcoll);
 
     // convection coefficient Nucoll
-    DFieldMem<IdxRangeSpXVx_ghosted> Nucoll_alloc(m_mesh_ghosted);
+    DWorkspaceFieldMem<IdxRangeSpXVx_ghosted> Nucoll_alloc(mesh_ghosted);
     DField<IdxRangeSpXVx_ghosted> Nucoll = get_field(Nucoll_alloc);
     compute_Nucoll<GhostedVx>(Nucoll, Dcoll, Vcoll, Tcoll);
 
     // matrix coefficients
-    DFieldMemSpXVx AA_alloc(get_idx_range(allfdistribu));
-    DFieldMemSpXVx BB_alloc(get_idx_range(allfdistribu));
-    DFieldMemSpXVx CC_alloc(get_idx_range(allfdistribu));
+    DWorkspaceFieldMem<IdxRangeSpXVx> AA_alloc(get_idx_range(allfdistribu));
+    DWorkspaceFieldMem<IdxRangeSpXVx> BB_alloc(get_idx_range(allfdistribu));
+    DWorkspaceFieldMem<IdxRangeSpXVx> CC_alloc(get_idx_range(allfdistribu));
     DFieldSpXVx AA = get_field(AA_alloc);
     DFieldSpXVx BB = get_field(BB_alloc);
     DFieldSpXVx CC = get_field(CC_alloc);
@@ -329,7 +371,7 @@ DFieldSpXVx CollisionsIntra::operator()(DFieldSpXVx allfdistribu, double dt) con
 
 
     // rhs vector coefficient
-    DFieldMemSpXVx RR_alloc(get_idx_range(allfdistribu));
+    DWorkspaceFieldMem<IdxRangeSpXVx> RR_alloc(get_idx_range(allfdistribu));
     DFieldSpXVx RR = get_field(RR_alloc);
     compute_rhs_vector(RR, AA, BB, CC, allfdistribu, m_fthresh);
 
@@ -356,3 +398,234 @@ DFieldSpXVx CollisionsIntra::operator()(DFieldSpXVx allfdistribu, double dt) con
     Kokkos::Profiling::popRegion();
     return allfdistribu;
 }
+
+void CollisionsIntra::apply_on_active_tiles(DFieldSpXVx const allfdistribu, double const dt) const
+{
+    using GridVxTile = PhaseSpaceTileMap::GridVxTile;
+    using IdxRangeSpXVxTile = PhaseSpaceTileMap::IdxRangeSpXVxTile;
+    using IdxSpXVxTile = PhaseSpaceTileMap::IdxSpXVxTile;
+
+    WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+            get_workspace_arena());
+
+    IdxRangeSpX const grid_sp_x(get_idx_range<Species, GridX>(allfdistribu));
+    IdxRangeVx const gridvx(get_idx_range<GridVx>(allfdistribu));
+    IdxRange<GridVxTile> const idx_range_tiles(
+            Idx<GridVxTile>(0),
+            IdxStep<GridVxTile>((gridvx.size() + m_tile_size - 1) / m_tile_size));
+    IdxRangeSpXVxTile const tile_idx_range(grid_sp_x, idx_range_tiles);
+
+    DWorkspaceFieldMem<IdxRangeSpX> density_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> temperature_alloc(grid_sp_x);
+    WorkspaceFieldMem<bool, IdxRangeSpXVxTile> occupied_alloc(tile_idx_range);
+    WorkspaceFieldMem<bool, IdxRangeSpXVxTile> active_alloc(tile_idx_range);
+    DFieldSpX const density = get_field(density_alloc);
+    DFieldSpX const temperature = get_field(temperature_alloc);
+    Field<bool, IdxRangeSpXVxTile> const occupied = get_field(occupied_alloc);
+    Field<bool, IdxRangeSpXVxTile> const active = get_field(active_alloc);
+
+    PhaseSpaceTileMap::View const tiles(get_const_field(active), gridvx, m_tile_size);
+    DConstFieldVx const quadrature_coeffs = get_const_field(m_quadrature_coeffs_alloc);
+    double const threshold = m_tile_threshold;
+
+    // Moments computation, the tiles where f is negligible are found in the same pass
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            grid_sp_x,
+            KOKKOS_LAMBDA(IdxSpX const ispx) {
+                double density_loc(0);
+                double particle_flux(0);
+                double momentum_flux(0);
+                for (Idx<GridVxTile> const itile : idx_range_tiles) {
+                    double max_abs_f = 0.;
+                    for (IdxVx const ivx : tiles.tile_idx_range(itile)) {
+                        CoordVx const coordv = ddc::coordinate(ivx);
+                        double const val(quadrature_coeffs(ivx) * allfdistribu(ispx, ivx));
+                        density_loc += val;
+                        particle_flux += val * coordv;
+                        momentum_flux += val * coordv * coordv;
+                        max_abs_f = Kokkos::max(max_abs_f, Kokkos::abs(allfdistribu(ispx, ivx)));
+                    }
+                    occupied(ispx, itile) = max_abs_f >= threshold;
+                }
+                double const fluid_velocity = particle_flux / density_loc;
+                density(ispx) = density_loc;
+                temperature(ispx) = (momentum_flux - particle_flux * fluid_velocity) / density_loc;
+            });
+
+    // The finite difference stencil couples neighbouring velocity points
+    PhaseSpaceTileMap::dilate(active, get_const_field(occupied), 0, 1);
+
+    // collision frequency
+    DWorkspaceFieldMem<IdxRangeSpX> collfreq_alloc(grid_sp_x);
+    DFieldSpX const collfreq = get_field(collfreq_alloc);
+    compute_collfreq(collfreq, get_const_field(m_nustar_profile_alloc), density, temperature);
+
+    // kernel maxwellian fluid moments, integrated over the active tiles
+    DWorkspaceFieldMem<IdxRangeSpX> Vcoll_alloc(grid_sp_x);
+    DWorkspaceFieldMem<IdxRangeSpX> Tcoll_alloc(grid_sp_x);
+    DFieldSpX const Vcoll = get_field(Vcoll_alloc);
+    DFieldSpX const Tcoll = get_field(Tcoll_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            grid_sp_x,
+            KOKKOS_LAMBDA(IdxSpX const ispx) {
+                double I0mean(0);
+                double I1mean(0);
+                double I2mean(0);
+                double I3mean(0);
+                double I4mean(0);
+                for (Idx<GridVxTile> const itile : idx_range_tiles) {
+                    if (!active(ispx, itile)) {
+                        continue;
+                    }
+                    for (IdxVx const ivx : tiles.tile_idx_range(itile)) {
+                        double const coordv = ddc::coordinate(to_index<GhostedVx>(ivx));
+                        double const Dcoll = Dcoll_at(coordv, collfreq(ispx), temperature(ispx));
+                        double const dvDcoll
+                                = dvDcoll_at(coordv, collfreq(ispx), temperature(ispx));
+                        double const coeff = quadrature_coeffs(ivx) * allfdistribu(ispx, ivx);
+                        I0mean += coeff * Dcoll;
+                        I1mean += coeff * Dcoll * coordv;
+                        I2mean += coeff * Dcoll * coordv * coordv;
+                        I3mean += coeff * dvDcoll;
+                        I4mean += coeff * (Dcoll + dvDcoll * coordv);
+                    }
+                }
+                double const inv_Pcoll(1. / (I0mean * I4mean - I1mean * I3mean));
+                Vcoll(ispx) = inv_Pcoll * (I1mean * I4mean - I2mean * I3mean);
+                Tcoll(ispx) = inv_Pcoll * (I0mean * I2mean - I1mean * I1mean);
+            });
+
+    // Compact the segments of contiguous active tiles
+    int const n_tiles = tile_idx_range.size();
+    WorkspaceFieldMem<IdxSpXVxTile, IdxRange<GridSegment>> segment_start_alloc(
+            IdxRange<GridSegment>(Idx<GridSegment>(0), IdxStep<GridSegment>(n_tiles)));
+    Field<IdxSpXVxTile, IdxRange<GridSegment>> const segment_start
+            = get_field(segment_start_alloc);
+    IdxRangeSp const idx_range_sp = ddc::select<Species>(grid_sp_x);
+    IdxRangeX const idx_range_x = ddc::select<GridX>(grid_sp_x);
+    int const nx = idx_range_x.size();
+    int const ntiles_per_line = idx_range_tiles.size();
+    int n_segments = 0;
+    Kokkos::parallel_scan(
+            "CollisionsIntra::active_segments",
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, n_tiles),
+            KOKKOS_LAMBDA(int const i, int& offset, bool const final) {
+                int const line = i / ntiles_per_line;
+                Idx<GridVxTile> const itile(i % ntiles_per_line);
+                IdxSpX const
+                        ispx(idx_range_sp.front() + line / nx, idx_range_x.front() + line % nx);
+                bool const starts_segment = active(ispx, itile)
+                                            && (itile == idx_range_tiles.front()
+                                                || !active(ispx, itile - 1));
+                if (starts_segment) {
+                    if (final) {
+                        segment_start(Idx<GridSegment>(offset)) = IdxSpXVxTile(ispx, itile);
+                    }
+                    ++offset;
+                }
+            },
+            n_segments);
+
+    // Solve the Crank-Nicolson system on each segment. The values of the distribution function
+    // on the inactive points next to a segment are fixed and act as boundary conditions.
+    DWorkspaceFieldMem<IdxRangeSpXVx> cprime_alloc(get_idx_range(allfdistribu));
+    DWorkspaceFieldMem<IdxRangeSpXVx> dprime_alloc(get_idx_range(allfdistribu));
+    DFieldSpXVx const cprime = get_field(cprime_alloc);
+    DFieldSpXVx const dprime = get_field(dprime_alloc);
+    double const fthresh = m_fthresh;
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            IdxRange<GridSegment>(Idx<GridSegment>(0), IdxStep<GridSegment>(n_segments)),
+            KOKKOS_LAMBDA(Idx<GridSegment> const isegment) {
+                IdxSpX const ispx(segment_start(isegment));
+                Idx<GridVxTile> const first_tile = ddc::select<GridVxTile>(segment_start(isegment));
+                Idx<GridVxTile> last_tile = first_tile;
+                while (last_tile != idx_range_tiles.back() && active(ispx, last_tile + 1)) {
+                    last_tile = last_tile + 1;
+                }
+                IdxVx const ivx_first = tiles.tile_idx_range(first_tile).front();
+                IdxVx const ivx_last = tiles.tile_idx_range(last_tile).back();
+                int const n_points = (ivx_last - ivx_first).value() + 1;
+
+                double const collfreq_loc = collfreq(ispx);
+                double const temperature_loc = temperature(ispx);
+                double const Vcoll_loc = Vcoll(ispx);
+                double const Tcoll_loc = Tcoll(ispx);
+
+                // The coefficients are evaluated on the fly and shifted from one row to the next
+                IdxVx_ghosted const ivx_first_ghosted(to_index<GhostedVx>(ivx_first));
+                double coordv_prev = ddc::coordinate(ivx_first_ghosted - 1);
+                double coordv = ddc::coordinate(ivx_first_ghosted);
+                double Dcoll_prev = Dcoll_at(coordv_prev, collfreq_loc, temperature_loc);
+                double Dcoll = Dcoll_at(coordv, collfreq_loc, temperature_loc);
+                double Dcoll_staggered_prev = Dcoll_at(
+                        ddc::coordinate(to_index<GhostedVxStaggered>(ivx_first) - 1),
+                        collfreq_loc,
+                        temperature_loc);
+
+                // Forward elimination
+                for (int i = 0; i < n_points; ++i) {
+                    IdxVx const ivx = ivx_first + i;
+                    double const coordv_next = ddc::coordinate(to_index<GhostedVx>(ivx) + 1);
+                    double const Dcoll_next = Dcoll_at(coordv_next, collfreq_loc, temperature_loc);
+                    double const Dcoll_staggered = Dcoll_at(
+                            ddc::coordinate(to_index<GhostedVxStaggered>(ivx)),
+                            collfreq_loc,
+                            temperature_loc);
+
+                    double AA;
+                    double BB;
+                    double CC;
+                    matrix_row_coefficients(
+                            AA,
+                            BB,
+                            CC,
+                            ivx,
+                            Dcoll,
+                            Dcoll_staggered,
+                            Dcoll_staggered_prev,
+                            Nucoll_at(coordv_prev, Dcoll_prev, Vcoll_loc, Tcoll_loc),
+                            Nucoll_at(coordv, Dcoll, Vcoll_loc, Tcoll_loc),
+                            Nucoll_at(coordv_next, Dcoll_next, Vcoll_loc, Tcoll_loc),
+                            dt);
+
+                    double rhs = (2. - BB) * allfdistribu(ispx, ivx);
+                    double diag = BB;
+                    if (i == 0) {
+                        double const f_prev
+                                = ivx == gridvx.front() ? fthresh : allfdistribu(ispx, ivx - 1);
+                        rhs -= 2. * AA * f_prev;
+                    } else {
+                        rhs -= AA * allfdistribu(ispx, ivx - 1);
+                        diag -= AA * cprime(ispx, ivx - 1);
+                        rhs -= AA * dprime(ispx, ivx - 1);
+                    }
+                    if (i == n_points - 1) {
+                        double const f_next
+                                = ivx == gridvx.back() ? fthresh : allfdistribu(ispx, ivx + 1);
+                        rhs -= 2. * CC * f_next;
+                        cprime(ispx, ivx) = 0.;
+                    } else {
+                        rhs -= CC * allfdistribu(ispx, ivx + 1);
+                        cprime(ispx, ivx) = CC / diag;
+                    }
+                    dprime(ispx, ivx) = rhs / diag;
+
+                    coordv_prev = coordv;
+                    coordv = coordv_next;
+                    Dcoll_prev = Dcoll;
+                    Dcoll = Dcoll_next;
+                    Dcoll_staggered_prev = Dcoll_staggered;
+                }
+
+                // Back substitution, the segment is only read by this kernel iteration
+                allfdistribu(ispx, ivx_last) = dprime(ispx, ivx_last);
+                for (int i = n_points - 2; i >= 0; --i) {
+                    IdxVx const ivx = ivx_first + i;
+                    allfdistribu(ispx, ivx)
+                            = dprime(ispx, ivx) - cprime(ispx, ivx) * allfdistribu(ispx, ivx + 1);
+                }
+            });
+}
@@ -10,6 +10,7 @@
 #include "ddc_aliases.hpp"
 #include "geometry.hpp"
 #include "irighthandside.hpp"
+#include "phase_space_tile_map.hpp"
 #include "quadrature.hpp"
 #include "trapezoid_quadrature.hpp"
 
@@ -34,6 +35,14 @@
  * that needs to be resolved at each spatial position of the simulation box. Note that this linear 
  * system depends on the considered spatial position. 
  * 
+ * If a tile size is provided, the velocity grid of each (species, x) line is split into tiles
+ * (see PhaseSpaceTileMap) and the tiles where the distribution function is negligible are
+ * found at each call, together with the moments. The active tiles are dilated by one tile along
+ * vx and grouped into segments of contiguous active tiles. The linear system is only assembled
+ * and solved on these segments (one tridiagonal solve per segment), using the values of the
+ * distribution function on the neighbouring inactive points as boundary conditions. The
+ * distribution function is left unchanged on the inactive tiles.
+ *
  * The complete description of the operator can be found in [rhs docs](https://github.com/gyselax/gyselalibxx/blob/main/doc/geometryXVx/collisions_intra_inter.pdf).
  */
 class CollisionsIntra : public IRightHandSide
@@ -101,10 +110,29 @@ private:
     std::enable_if_t<ddc::is_uniform_point_sampling_v<VDim>>
     build_ghosted_staggered_vx_point_sampling(IdxRange<VDim> const& idx_range);
 
+    /// The discrete dimension indexing the segments of contiguous active tiles.
+    struct GridSegment
+    {
+    };
+
+    KOKKOS_FUNCTION static void matrix_row_coefficients(
+            double& AA,
+            double& BB,
+            double& CC,
+            Idx<GridVx> ivx,
+            double Dcoll,
+            double Dcoll_staggered,
+            double Dcoll_staggered_prev,
+            double Nucoll_prev,
+            double Nucoll,
+            double Nucoll_next,
+            double deltat);
+
     double m_nustar0;
     double m_fthresh;
     DFieldMemSpX m_nustar_profile_alloc;
     DFieldSpX m_nustar_profile;
+    DFieldMemVx m_quadrature_coeffs_alloc;
 
     IdxRange<GhostedVx> m_gridvx_ghosted;
     IdxRange<GhostedVxStaggered> m_gridvx_ghosted_staggered;
@@ -112,17 +140,31 @@ private:
     IdxRangeSpXVx_ghosted m_mesh_ghosted;
     IdxRangeSpXVx_ghosted_staggered m_mesh_ghosted_staggered;
 
+    int m_tile_size;
+    double m_tile_threshold;
+
 public:
     /**
      * @brief The constructor for the operator.
      *
      * @param[in] mesh The index range on which the operator will act.
      * @param[in] nustar0 The normalized collisionality.
+     * @param[in] tile_size The number of velocity points in the tiles which are skipped when
+     *                  the distribution function is negligible. The tiles are not used if it
+     *                  is equal to 0.
+     * @param[in] tile_threshold The value of the distribution function below which a tile is
+     *                  skipped.
      */
-    CollisionsIntra(IdxRangeSpXVx const& mesh, double nustar0);
+    CollisionsIntra(
+            IdxRangeSpXVx const& mesh,
+            double nustar0,
+            int tile_size = 0,
+            double tile_threshold = 1.e-30);
 
     ~CollisionsIntra() = default;
 
+    using IRightHandSide::operator();
+
     /**
      * @brief Update the distribution function for intra-species collision.
      *
@@ -166,6 +208,13 @@ public:
      */
     IdxRange<Species, GridX, GhostedVx> const& get_mesh_ghosted() const;
 
+    /**
+     * @brief Get the number of velocity points in the tiles.
+     *
+     * @return The tile size. The tiles are not used if it is equal to 0.
+     */
+    int get_tile_size() const;
+
     /**
      * @brief Compute the right-hand-side of the collision operator linear system.
      * @param[inout] RR A vector representing the right-hand-side of the system.
@@ -213,4 +262,14 @@ public:
             host_t<DConstFieldVx> AA,
             host_t<DConstFieldVx> BB,
             host_t<DConstFieldVx> CC) const;
+
+    /**
+     * @brief Apply the collision operator on the active tiles only.
+     *
+     * This method is called by operator() when the operator uses tiles.
+     *
+     * @param[inout] allfdistribu The distribution function.
+     * @param[in] dt The time step over which the collisions occur.
+     */
+    void apply_on_active_tiles(DFieldSpXVx allfdistribu, double dt) const;
 };
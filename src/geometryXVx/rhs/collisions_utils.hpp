@@ -29,6 +29,85 @@ void compute_collfreq(
         DConstFieldSpX density,
         DConstFieldSpX temperature);
 
+/**
+* @brief Compute the intra species collision operator diffusion coefficient at a given velocity.
+* @param[in] coordv The velocity.
+* @param[in] collfreq The collision frequency of the species.
+* @param[in] temperature The temperature of the species.
+* @return The diffusion coefficient.
+*/
+KOKKOS_INLINE_FUNCTION double Dcoll_at(
+        double const coordv,
+        double const collfreq,
+        double const temperature)
+{
+    double const vT(Kokkos::sqrt(2. * temperature));
+    double const v_norm(Kokkos::fabs(coordv) / vT);
+    double const tol = 1.e-15;
+    if (v_norm > tol) {
+        double const coeff(2. / Kokkos::sqrt(M_PI));
+        double const AD(3. * Kokkos::sqrt(2. * M_PI) / 4. * temperature * collfreq);
+        double const inv_v_norm(1. / v_norm);
+        double const phi(Kokkos::erf(v_norm));
+        double const phi_prime(coeff * Kokkos::exp(-v_norm * v_norm));
+        double const psi((phi - v_norm * phi_prime) * 0.5 * inv_v_norm * inv_v_norm);
+
+        return AD * (phi - psi) * inv_v_norm;
+    } else {
+        return Kokkos::sqrt(2) * temperature * collfreq;
+    }
+}
+
+/**
+* @brief Compute the velocity derivative of the collision operator diffusion coefficient at a
+* given velocity.
+* @param[in] coordv The velocity.
+* @param[in] collfreq The collision frequency of the species.
+* @param[in] temperature The temperature of the species.
+* @return The derivative of the diffusion coefficient.
+*/
+KOKKOS_INLINE_FUNCTION double dvDcoll_at(
+        double const coordv,
+        double const collfreq,
+        double const temperature)
+{
+    double const vT(Kokkos::sqrt(2. * temperature));
+    double const v_norm(Kokkos::fabs(coordv) / vT);
+    double const tol = 1.e-15;
+    if (v_norm > tol) {
+        double const coeff(2. / Kokkos::sqrt(M_PI));
+        double const AD(3. * Kokkos::sqrt(2. * M_PI) / 4. * temperature * collfreq);
+        double const inv_v_norm(1. / v_norm);
+        double const phi(Kokkos::erf(v_norm));
+        double const phi_prime(coeff * Kokkos::exp(-v_norm * v_norm));
+        double const psi((phi - v_norm * phi_prime) * 0.5 * inv_v_norm * inv_v_norm);
+
+        double const sign(coordv / Kokkos::fabs(coordv));
+
+        return sign * AD / Kokkos::sqrt(2 * temperature) * inv_v_norm * inv_v_norm
+               * (3 * psi - phi);
+    } else {
+        return 0.;
+    }
+}
+
+/**
+* @brief Compute the intra species collision operator advection coefficient at a given velocity.
+* @param[in] coordv The velocity.
+* @param[in] Dcoll The diffusion coefficient at this velocity.
+* @param[in] Vcoll The Vcoll coefficient of the species.
+* @param[in] Tcoll The Tcoll coefficient of the species.
+* @return The advection coefficient.
+*/
+KOKKOS_INLINE_FUNCTION double Nucoll_at(
+        double const coordv,
+        double const Dcoll,
+        double const Vcoll,
+        double const Tcoll)
+{
+    return -Dcoll * (coordv - Vcoll) / Tcoll;
+}
+
 /**
 * @brief Compute the intra species collision operator diffusion coefficient.
 * @param[inout] Dcoll A Field representing the diffusion coefficient.
@@ -47,29 +126,11 @@ void compute_Dcoll(
             Kokkos::DefaultExecutionSpace(),
             get_idx_range(Dcoll),
             KOKKOS_LAMBDA(Idx<Species, GridX, LocalGridVx> const ispxdimvx) {
-                double const vT(
-                        Kokkos::sqrt(2. * temperature(ddc::select<Species, GridX>(ispxdimvx))));
-                double const v_norm(
-                        Kokkos::fabs(ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx))) / vT);
-                double const tol = 1.e-15;
-                if (v_norm > tol) {
-                    double const coeff(2. / Kokkos::sqrt(M_PI));
-                    double const AD(
-                            3. * Kokkos::sqrt(2. * M_PI) / 4.
-                            * temperature(ddc::select<Species, GridX>(ispxdimvx))
-                            * collfreq(ddc::select<Species, GridX>(ispxdimvx)));
-                    double const inv_v_norm(1. / v_norm);
-                    double const phi(Kokkos::erf(v_norm));
-                    double const phi_prime(coeff * Kokkos::exp(-v_norm * v_norm));
-                    double const psi((phi - v_norm * phi_prime) * 0.5 * inv_v_norm * inv_v_norm);
-
-                    Dcoll(ispxdimvx) = AD * (phi - psi) * inv_v_norm;
-
-                } else {
-                    Dcoll(ispxdimvx) = Kokkos::sqrt(2)
-                                       * temperature(ddc::select<Species, GridX>(ispxdimvx))
-                                       * collfreq(ddc::select<Species, GridX>(ispxdimvx));
-                }
+                IdxSpX const ispx(ddc::select<Species, GridX>(ispxdimvx));
+                Dcoll(ispxdimvx) = Dcoll_at(
+                        ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx)),
+                        collfreq(ispx),
+                        temperature(ispx));
             });
 }
 
@@ -91,35 +152,11 @@ void compute_dvDcoll(
             Kokkos::DefaultExecutionSpace(),
             get_idx_range(dvDcoll),
             KOKKOS_LAMBDA(Idx<Species, GridX, LocalGridVx> const ispxdimvx) {
-                double const vT(
-                        Kokkos::sqrt(2. * temperature(ddc::select<Species, GridX>(ispxdimvx))));
-                double const v_norm(
-                        Kokkos::fabs(ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx))) / vT);
-                double const tol = 1.e-15;
-                if (v_norm > tol) {
-                    double const coeff(2. / Kokkos::sqrt(M_PI));
-                    double const AD(
-                            3. * Kokkos::sqrt(2. * M_PI) / 4.
-                            * temperature(ddc::select<Species, GridX>(ispxdimvx))
-                            * collfreq(ddc::select<Species, GridX>(ispxdimvx)));
-                    double const inv_v_norm(1. / v_norm);
-                    double const phi(Kokkos::erf(v_norm));
-                    double const phi_prime(coeff * Kokkos::exp(-v_norm * v_norm));
-                    double const psi((phi - v_norm * phi_prime) * 0.5 * inv_v_norm * inv_v_norm);
-
-                    double const sign(
-                            ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx))
-                            / Kokkos::fabs(ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx))));
-
-                    dvDcoll(ispxdimvx)
-                            = sign * AD
-                              / Kokkos::sqrt(
-                                      2 * temperature(ddc::select<Species, GridX>(ispxdimvx)))
-                              * inv_v_norm * inv_v_norm * (3 * psi - phi);
-
-                } else {
-                    dvDcoll(ispxdimvx) = 0.;
-                }
+                IdxSpX const ispx(ddc::select<Species, GridX>(ispxdimvx));
+                dvDcoll(ispxdimvx) = dvDcoll_at(
+                        ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx)),
+                        collfreq(ispx),
+                        temperature(ispx));
             });
 }
 
@@ -245,10 +282,12 @@ void compute_Nucoll(
             Kokkos::DefaultExecutionSpace(),
             get_idx_range(Dcoll),
             KOKKOS_LAMBDA(Idx<Species, GridX, LocalGridVx> const ispxdimvx) {
-                double const coordv(ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx)));
-                Nucoll(ispxdimvx) = -Dcoll(ispxdimvx)
-                                    * (coordv - Vcoll(ddc::select<Species, GridX>(ispxdimvx)))
-                                    / Tcoll(ddc::select<Species, GridX>(ispxdimvx));
+                IdxSpX const ispx(ddc::select<Species, GridX>(ispxdimvx));
+                Nucoll(ispxdimvx) = Nucoll_at(
+                        ddc::coordinate(ddc::select<LocalGridVx>(ispxdimvx)),
+                        Dcoll(ispxdimvx),
+                        Vcoll(ispx),
+                        Tcoll(ispx));
             });
 }
 
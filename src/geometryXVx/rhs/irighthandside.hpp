@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "double_precision_blocks.hpp"
 #include "geometry.hpp"
 
 /**
@@ -29,4 +30,28 @@ public:
      * @return The distribution function after solving the source evolution equation.
      */
     virtual DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double dt) const = 0;
+
+    /**
+     * @brief Operator for applying the source term on a distribution function stored in single
+     * precision.
+     *
+     * The sources only couple points at the same spatial position. The distribution function
+     * is therefore treated in blocks along the x direction: each block is copied into a double
+     * precision buffer, the double precision operator is applied to it and the result is stored
+     * back in single precision.
+     *
+     * @param[in, out] allfdistribu On input: the initial value of the distribution function.
+     *                              On output: the value of the distribution function after solving 
+     *                              the source evolution equation on one timestep.
+     * @param[in] dt The timestep.
+     * @return The distribution function after solving the source evolution equation.
+     */
+    virtual FieldSpXVx<float> operator()(FieldSpXVx<float> allfdistribu, double dt) const
+    {
+        detail::apply_on_double_precision_blocks<GridX>(
+                allfdistribu,
+                get_idx_range(allfdistribu),
+                [&](DFieldSpXVx fdistribu) { (*this)(fdistribu, dt); });
+        return allfdistribu;
+    }
 };
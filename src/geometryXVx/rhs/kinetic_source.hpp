@@ -62,6 +62,8 @@ public:
 
     ~KineticSource() override = default;
 
+    using IRightHandSide::operator();
+
     /**
      * @brief Update the distribution function following the KineticSource operator. 
      *
@@ -64,6 +64,8 @@ public:
 
     ~KrookSourceAdaptive() override = default;
 
+    using IRightHandSide::operator();
+
     /**
      * @brief Update the distribution function following the KrookSourceAdaptive operator. 
      *
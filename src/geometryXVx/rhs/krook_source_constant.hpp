@@ -62,6 +62,8 @@ public:
 
     ~KrookSourceConstant() override = default;
 
+    using IRightHandSide::operator();
+
     /**
      * @brief Update the distribution function following the KrookSourceConstant operator. 
      *
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <memory>
+
+#include <ddc/ddc.hpp>
+
+#include "predcorr.hpp"
+#include "xvx_solver_autotuner.hpp"
+
+XVxSolverAutotuner::XVxSolverAutotuner(
+        IdxRangeXVx const mesh_xvx,
+        int const lagrange_degree,
+        int const n_warmup_steps,
+        double const tolerance)
+    : m_mesh_xvx(mesh_xvx)
+    , m_lagrange_degree(lagrange_degree)
+    , m_n_warmup_steps(n_warmup_steps)
+    , m_tolerance(tolerance)
+{
+    assert(n_warmup_steps > 1);
+}
+
+std::vector<XVxSolverTiming> XVxSolverAutotuner::time_configurations(
+        DConstFieldSpXVx const allfdistribu,
+        double const dt) const
+{
+    IdxRangeSpXVx const idx_range = get_idx_range(allfdistribu);
+    DFieldMemSpXVx fdistribu_reference(idx_range);
+    DFieldMemSpXVx fdistribu_alloc(idx_range);
+    DFieldSpXVx const fdistribu = get_field(fdistribu_alloc);
+    DConstFieldSpXVx const fdistribu_ref = get_const_field(fdistribu_reference);
+
+    std::vector<XVxSolverTiming> timings;
+    for (XVxSolverConfiguration const& configuration : admissible_configurations()) {
+        XVxSolvers const solvers(configuration, m_mesh_xvx, m_lagrange_degree);
+        PredCorr const predcorr(solvers.vlasov_solver(), solvers.qn_solver(), 0);
+
+        ddc::parallel_deepcopy(fdistribu, allfdistribu);
+        // The first step includes the allocations and the setup of the solvers
+        predcorr(fdistribu, 0., dt, 1);
+        Kokkos::fence();
+        std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+        predcorr(fdistribu, dt, dt, m_n_warmup_steps - 1);
+        Kokkos::fence();
+        std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now();
+        double const time_per_step
+                = std::chrono::duration<double>(end - start).count() / (m_n_warmup_steps - 1);
+
+        if (timings.empty()) {
+            ddc::parallel_deepcopy(fdistribu_reference, fdistribu);
+        }
+        double const max_difference = ddc::parallel_transform_reduce(
+                Kokkos::DefaultExecutionSpace(),
+                idx_range,
+                0.,
+                ddc::reducer::max<double>(),
+                KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                    return Kokkos::fabs(fdistribu(ispxvx) - fdistribu_ref(ispxvx));
+                });
+        double const max_reference = ddc::parallel_transform_reduce(
+                Kokkos::DefaultExecutionSpace(),
+                idx_range,
+                0.,
+                ddc::reducer::max<double>(),
+                KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                    return Kokkos::fabs(fdistribu_ref(ispxvx));
+                });
+        timings.push_back({configuration, time_per_step, max_difference / max_reference});
+    }
+    return timings;
+}
+
+XVxSolverConfiguration XVxSolverAutotuner::select(std::vector<XVxSolverTiming> const& timings) const
+{
+    assert(!timings.empty());
+    // The reference is always accepted
+    XVxSolverTiming best = timings.front();
+    for (XVxSolverTiming const& timing : timings) {
+        if (timing.relative_error <= m_tolerance && timing.time_per_step < best.time_per_step) {
+            best = timing;
+        }
+    }
+    return best.configuration;
+}
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <vector>
+
+#include "geometry.hpp"
+#include "xvx_solvers.hpp"
+
+/**
+ * @brief The performance and the accuracy measured by the autotuner for a solver configuration.
+ */
+struct XVxSolverTiming
+{
+    /// The solver configuration.
+    XVxSolverConfiguration configuration;
+    /// The average duration of a time step in seconds.
+    double time_per_step;
+    /// The relative difference with the reference configuration after the warm-up steps.
+    double relative_error;
+};
+
+/**
+ * @brief A class which chooses the fastest solver configuration for a simulation.
+ *
+ * Each admissible configuration (see admissible_configurations) advances a copy of the initial
+ * distribution function by a few time steps of a predictor-corrector scheme. The first of
+ * these steps is not timed as it includes the allocations and the setup of the solvers. The
+ * result of each configuration is compared with the result of the reference configuration
+ * (which only uses splines). The fastest configuration whose relative difference with the
+ * reference is below the tolerance is selected.
+ */
+class XVxSolverAutotuner
+{
+    IdxRangeXVx m_mesh_xvx;
+
+    int m_lagrange_degree;
+
+    int m_n_warmup_steps;
+
+    double m_tolerance;
+
+public:
+    /**
+     * @brief Create an autotuner.
+     * @param[in] mesh_xvx The (x, vx) index range on which the distribution function is defined.
+     * @param[in] lagrange_degree The degree of the Lagrange polynomials.
+     * @param[in] n_warmup_steps The number of time steps carried out with each configuration.
+     * @param[in] tolerance The largest relative difference with the reference configuration
+     *                  which is accepted.
+     */
+    XVxSolverAutotuner(
+            IdxRangeXVx mesh_xvx,
+            int lagrange_degree,
+            int n_warmup_steps = 4,
+            double tolerance = 1e-3);
+
+    /**
+     * @brief Time all the admissible configurations.
+     * @param[in] allfdistribu The initial distribution function. It is not modified.
+     * @param[in] dt The time step.
+     * @return The measurements for each configuration (the reference is the first).
+     */
+    std::vector<XVxSolverTiming> time_configurations(DConstFieldSpXVx allfdistribu, double dt)
+            const;
+
+    /**
+     * @brief Choose the fastest configuration which is accurate enough.
+     * @param[in] timings The measurements returned by time_configurations.
+     * @return The chosen configuration.
+     */
+    XVxSolverConfiguration select(std::vector<XVxSolverTiming> const& timings) const;
+};
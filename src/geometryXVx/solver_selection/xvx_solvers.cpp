@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: MIT
+#include <cassert>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+#ifdef PERIODIC_RDIMX
+#include <ddc/kernels/fft.hpp>
+#endif
+
+#include "fem_1d_poisson_solver.hpp"
+#ifdef PERIODIC_RDIMX
+#include "fft_poisson_solver.hpp"
+#endif
+#include "neumann_spline_quadrature.hpp"
+#include "xvx_solvers.hpp"
+
+namespace {
+
+SplineXExtrapolationRule make_x_extrapolation_rule([[maybe_unused]] IdxX const ix)
+{
+#ifdef PERIODIC_RDIMX
+    return SplineXExtrapolationRule();
+#else
+    return SplineXExtrapolationRule(ddc::coordinate(ix));
+#endif
+}
+
+SplineVxExtrapolationRule make_vx_extrapolation_rule(IdxVx const ivx)
+{
+    return SplineVxExtrapolationRule(ddc::coordinate(ivx));
+}
+
+} // namespace
+
+InterpolatorChoice interpolator_choice_from_string(std::string const& name)
+{
+    if (name == "spline") {
+        return InterpolatorChoice::Spline;
+    } else if (name == "lagrange") {
+        return InterpolatorChoice::Lagrange;
+    } else {
+        throw std::runtime_error("Unknown interpolator : " + name);
+    }
+}
+
+PoissonSolverChoice poisson_solver_choice_from_string(std::string const& name)
+{
+    if (name == "FFT") {
+        return PoissonSolverChoice::FFT;
+    } else if (name == "FEM") {
+        return PoissonSolverChoice::FEM;
+    } else {
+        throw std::runtime_error("Unknown Poisson solver : " + name);
+    }
+}
+
+std::string to_string(XVxSolverConfiguration const& configuration)
+{
+    auto const interpolator_name = [](InterpolatorChoice const choice) {
+        return choice == InterpolatorChoice::Spline ? "spline" : "lagrange";
+    };
+    return std::string("x: ") + interpolator_name(configuration.interpolator_x)
+           + ", vx: " + interpolator_name(configuration.interpolator_vx) + ", Poisson: "
+           + (configuration.poisson_solver == PoissonSolverChoice::FFT ? "FFT" : "FEM");
+}
+
+bool is_admissible(XVxSolverConfiguration const& configuration)
+{
+    if (X::PERIODIC) {
+        return configuration.interpolator_x == InterpolatorChoice::Spline;
+    } else {
+        return configuration.poisson_solver == PoissonSolverChoice::FEM;
+    }
+}
+
+std::vector<XVxSolverConfiguration> admissible_configurations()
+{
+    std::vector<XVxSolverConfiguration> configurations;
+    // The spline configurations come first so the reference (splines everywhere) is the first
+    for (InterpolatorChoice const interp_x :
+         {InterpolatorChoice::Spline, InterpolatorChoice::Lagrange}) {
+        for (InterpolatorChoice const interp_vx :
+             {InterpolatorChoice::Spline, InterpolatorChoice::Lagrange}) {
+            for (PoissonSolverChoice const poisson :
+                 {PoissonSolverChoice::FFT, PoissonSolverChoice::FEM}) {
+                XVxSolverConfiguration const configuration {interp_x, interp_vx, poisson};
+                if (is_admissible(configuration)) {
+                    configurations.push_back(configuration);
+                }
+            }
+        }
+    }
+    return configurations;
+}
+
+XVxSolvers::XVxSolvers(
+        XVxSolverConfiguration const& configuration,
+        IdxRangeXVx const mesh_xvx,
+        int const lagrange_degree)
+    : m_configuration(configuration)
+    , m_builder_x(mesh_xvx)
+    , m_builder_vx(mesh_xvx)
+    , m_spline_x_evaluator(
+              make_x_extrapolation_rule(ddc::select<GridX>(mesh_xvx).front()),
+              make_x_extrapolation_rule(ddc::select<GridX>(mesh_xvx).back()))
+    , m_spline_vx_evaluator(
+              make_vx_extrapolation_rule(ddc::select<GridVx>(mesh_xvx).front()),
+              make_vx_extrapolation_rule(ddc::select<GridVx>(mesh_xvx).back()))
+    , m_builder_x_poisson(ddc::select<GridX>(mesh_xvx))
+    , m_spline_x_evaluator_poisson(
+              make_x_extrapolation_rule(ddc::select<GridX>(mesh_xvx).front()),
+              make_x_extrapolation_rule(ddc::select<GridX>(mesh_xvx).back()))
+    , m_builder_vx_poisson(ddc::select<GridVx>(mesh_xvx))
+    , m_quadrature_coeffs(neumann_spline_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+              ddc::select<GridVx>(mesh_xvx),
+              m_builder_vx_poisson))
+{
+    if (!is_admissible(configuration)) {
+        throw std::runtime_error(
+                "The solver configuration (" + to_string(configuration)
+                + ") cannot be used with this geometry");
+    }
+
+    // Interpolators and advections
+    if (configuration.interpolator_x == InterpolatorChoice::Spline) {
+        m_interpolator_x = std::make_unique<
+                PreallocatableSplineInterpolatorX>(m_builder_x, m_spline_x_evaluator);
+    } else {
+#ifndef PERIODIC_RDIMX
+        m_lagrange_x = std::make_unique<LagrangeInterpolatorX>(lagrange_degree, IdxStepX(0));
+        m_interpolator_x = std::make_unique<PreallocatableLagrangeInterpolator<
+                GridX,
+                BCond::DIRICHLET,
+                BCond::DIRICHLET,
+                GridX,
+                GridVx>>(*m_lagrange_x);
+#endif
+    }
+    if (configuration.interpolator_vx == InterpolatorChoice::Spline) {
+        m_interpolator_vx = std::make_unique<
+                PreallocatableSplineInterpolatorVx>(m_builder_vx, m_spline_vx_evaluator);
+    } else {
+        m_lagrange_vx = std::make_unique<LagrangeInterpolatorVx>(lagrange_degree, IdxStepVx(0));
+        m_interpolator_vx = std::make_unique<PreallocatableLagrangeInterpolator<
+                GridVx,
+                BCond::DIRICHLET,
+                BCond::DIRICHLET,
+                GridX,
+                GridVx>>(*m_lagrange_vx);
+    }
+    assert(m_interpolator_x && m_interpolator_vx);
+    m_advection_x = std::make_unique<BslAdvectionX>(*m_interpolator_x);
+    m_advection_vx = std::make_unique<BslAdvectionVx>(*m_interpolator_vx);
+    m_vlasov = std::make_unique<SplitVlasovSolver>(*m_advection_x, *m_advection_vx);
+
+    // Poisson solver
+    m_rhs = std::make_unique<ChargeDensityCalculator>(get_const_field(m_quadrature_coeffs));
+    if (configuration.poisson_solver == PoissonSolverChoice::FFT) {
+#ifdef PERIODIC_RDIMX
+        m_poisson_solver = std::make_unique<
+                FFTPoissonSolver<IdxRangeX, IdxRangeX, Kokkos::DefaultExecutionSpace>>(
+                ddc::select<GridX>(mesh_xvx));
+#endif
+    } else {
+        m_poisson_solver = std::make_unique<FEM1DPoissonSolver<
+                SplineXBuilder_1d,
+                SplineXEvaluator_1d>>(m_builder_x_poisson, m_spline_x_evaluator_poisson);
+    }
+    assert(m_poisson_solver);
+    m_qn_solver = std::make_unique<QNSolver>(*m_poisson_solver, *m_rhs);
+}
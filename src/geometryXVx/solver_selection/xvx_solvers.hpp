@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include "Lagrange_interpolator.hpp"
+#include "bsl_advection_xvx.hpp"
+#include "chargedensitycalculator.hpp"
+#include "geometry.hpp"
+#include "iboltzmannsolver.hpp"
+#include "ipoisson_solver.hpp"
+#include "iqnsolver.hpp"
+#include "qnsolver.hpp"
+#include "splitvlasovsolver.hpp"
+
+/// The interpolation methods which can be used by the semi-Lagrangian advections.
+enum class InterpolatorChoice {
+    /// Interpolation with splines (SplineInterpolator).
+    Spline,
+    /// Interpolation with local Lagrange polynomials (LagrangeInterpolator).
+    Lagrange
+};
+
+/// The methods which can be used to solve the Poisson equation.
+enum class PoissonSolverChoice {
+    /// A spectral solver (FFTPoissonSolver). Only available for periodic uniform meshes.
+    FFT,
+    /// A finite element solver (FEM1DPoissonSolver).
+    FEM
+};
+
+/**
+ * @brief A set of choices describing the operators used to solve a Vlasov-Poisson system.
+ */
+struct XVxSolverConfiguration
+{
+    /// The interpolation method used by the advection along x.
+    InterpolatorChoice interpolator_x;
+    /// The interpolation method used by the advection along vx.
+    InterpolatorChoice interpolator_vx;
+    /// The method used to solve the Poisson equation.
+    PoissonSolverChoice poisson_solver;
+};
+
+/**
+ * @brief Get the interpolation method described by a string (as found in an input file).
+ * @param[in] name The name of the method: "spline" or "lagrange".
+ * @return The interpolation method.
+ */
+InterpolatorChoice interpolator_choice_from_string(std::string const& name);
+
+/**
+ * @brief Get the Poisson solver described by a string (as found in an input file).
+ * @param[in] name The name of the solver: "FFT" or "FEM".
+ * @return The Poisson solver.
+ */
+PoissonSolverChoice poisson_solver_choice_from_string(std::string const& name);
+
+/**
+ * @brief Get a string describing a solver configuration (e.g. to print it).
+ * @param[in] configuration The solver configuration.
+ * @return The description of the configuration.
+ */
+std::string to_string(XVxSolverConfiguration const& configuration);
+
+/**
+ * @brief Check if a solver configuration can be used with the current geometry.
+ *
+ * The Lagrange interpolator does not handle periodic boundary conditions so it can only be
+ * used along x if x is not periodic. The FFT solver can only be used if x is periodic.
+ *
+ * @param[in] configuration The solver configuration.
+ * @return True if the configuration can be used, false otherwise.
+ */
+bool is_admissible(XVxSolverConfiguration const& configuration);
+
+/**
+ * @brief Get all the solver configurations which can be used with the current geometry.
+ *
+ * The first configuration only uses splines and is the most accurate. It is used as a
+ * reference by the autotuner.
+ *
+ * @return The admissible configurations.
+ */
+std::vector<XVxSolverConfiguration> admissible_configurations();
+
+/**
+ * @brief A class which builds and owns the operators needed to solve a Vlasov-Poisson system
+ * in the (x, vx) geometry, following a configuration chosen at runtime.
+ *
+ * The simulations can use the returned IBoltzmannSolver and IQNSolver without knowing which
+ * interpolators or Poisson solver were chosen. As the operators reference each other, objects
+ * of this class can be neither copied nor moved.
+ */
+class XVxSolvers
+{
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeX,
+            IdxRangeX,
+            std::experimental::layout_right,
+            typename Kokkos::DefaultExecutionSpace::memory_space>;
+
+#ifndef PERIODIC_RDIMX
+    using LagrangeInterpolatorX
+            = LagrangeInterpolator<GridX, BCond::DIRICHLET, BCond::DIRICHLET, GridX, GridVx>;
+#endif
+    using LagrangeInterpolatorVx
+            = LagrangeInterpolator<GridVx, BCond::DIRICHLET, BCond::DIRICHLET, GridX, GridVx>;
+
+    XVxSolverConfiguration m_configuration;
+
+    SplineXBuilder m_builder_x;
+    SplineVxBuilder m_builder_vx;
+    SplineXEvaluator m_spline_x_evaluator;
+    SplineVxEvaluator m_spline_vx_evaluator;
+
+    std::unique_ptr<IPreallocatableInterpolator<GridX, GridX, GridVx>> m_interpolator_x;
+    std::unique_ptr<IPreallocatableInterpolator<GridVx, GridX, GridVx>> m_interpolator_vx;
+#ifndef PERIODIC_RDIMX
+    std::unique_ptr<LagrangeInterpolatorX> m_lagrange_x;
+#endif
+    std::unique_ptr<LagrangeInterpolatorVx> m_lagrange_vx;
+
+    std::unique_ptr<BslAdvectionX> m_advection_x;
+    std::unique_ptr<BslAdvectionVx> m_advection_vx;
+    std::unique_ptr<SplitVlasovSolver> m_vlasov;
+
+    SplineXBuilder_1d m_builder_x_poisson;
+    SplineXEvaluator_1d m_spline_x_evaluator_poisson;
+    SplineVxBuilder_1d m_builder_vx_poisson;
+    DFieldMemVx m_quadrature_coeffs;
+    std::unique_ptr<ChargeDensityCalculator> m_rhs;
+    std::unique_ptr<PoissonSolver> m_poisson_solver;
+    std::unique_ptr<QNSolver> m_qn_solver;
+
+public:
+    /**
+     * @brief Build the operators described by a configuration.
+     * @param[in] configuration The solver configuration. It must be admissible.
+     * @param[in] mesh_xvx The (x, vx) index range on which the distribution function is defined.
+     * @param[in] lagrange_degree The degree of the Lagrange polynomials (if they are used).
+     */
+    XVxSolvers(
+            XVxSolverConfiguration const& configuration,
+            IdxRangeXVx mesh_xvx,
+            int lagrange_degree = 3);
+
+    XVxSolvers(XVxSolvers const&) = delete;
+
+    XVxSolvers(XVxSolvers&&) = delete;
+
+    XVxSolvers& operator=(XVxSolvers const&) = delete;
+
+    XVxSolvers& operator=(XVxSolvers&&) = delete;
+
+    ~XVxSolvers() = default;
+
+    /**
+     * @brief Get the configuration of the operators.
+     * @return The solver configuration.
+     */
+    XVxSolverConfiguration configuration() const
+    {
+        return m_configuration;
+    }
+
+    /**
+     * @brief Get the operator which solves the Vlasov equation.
+     * @return A reference to the Vlasov solver.
+     */
+    IBoltzmannSolver const& vlasov_solver() const
+    {
+        return *m_vlasov;
+    }
+
+    /**
+     * @brief Get the operator which solves the Quasi-Neutrality equation.
+     * @return A reference to the Quasi-Neutrality solver.
+     */
+    IQNSolver const& qn_solver() const
+    {
+        return *m_qn_solver;
+    }
+};
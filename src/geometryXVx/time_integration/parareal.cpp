@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include "mpitools.hpp"
+#include "parareal.hpp"
+
+namespace {
+
+/**
+ * @brief Get the largest change introduced by the Parareal correction.
+ *
+ * @param[in] coarse_new The coarse propagation of the new state at the start of the slice.
+ * @param[in] fine The fine propagation of the previous state at the start of the slice.
+ * @param[in] coarse_old The coarse propagation of the previous state at the start of the slice.
+ * @param[in] previous_end The previous state at the end of the slice.
+ *
+ * @return The infinity norm of the difference between the new and the previous state at the
+ *          end of the slice.
+ */
+double correction_residual(
+        DConstFieldSpXVx const coarse_new,
+        DConstFieldSpXVx const fine,
+        DConstFieldSpXVx const coarse_old,
+        DConstFieldSpXVx const previous_end)
+{
+    return ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(previous_end),
+            0.,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                return Kokkos::abs(
+                        coarse_new(ispxvx) + fine(ispxvx) - coarse_old(ispxvx)
+                        - previous_end(ispxvx));
+            });
+}
+
+/**
+ * @brief Apply the Parareal correction to the state at the end of the slice.
+ *
+ * @param[out] end The new state at the end of the slice.
+ * @param[in] coarse_new The coarse propagation of the new state at the start of the slice.
+ * @param[in] fine The fine propagation of the previous state at the start of the slice.
+ * @param[in] coarse_old The coarse propagation of the previous state at the start of the slice.
+ */
+void apply_correction(
+        DFieldSpXVx const end,
+        DConstFieldSpXVx const coarse_new,
+        DConstFieldSpXVx const fine,
+        DConstFieldSpXVx const coarse_old)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(end),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                end(ispxvx) = coarse_new(ispxvx) + fine(ispxvx) - coarse_old(ispxvx);
+            });
+}
+
+} // namespace
+
+Parareal::Parareal(
+        ITimeSolver const& coarse_solver,
+        ITimeSolver const& fine_solver,
+        MPI_Comm comm,
+        int const coarse_ratio,
+        int const max_iterations,
+        double const tolerance)
+    : m_coarse_solver(coarse_solver)
+    , m_fine_solver(fine_solver)
+    , m_comm(comm)
+    , m_coarse_ratio(coarse_ratio)
+    , m_max_iterations(max_iterations)
+    , m_tolerance(tolerance)
+{
+    if (coarse_ratio <= 0) {
+        throw std::invalid_argument("The coarse ratio of Parareal must be positive.");
+    }
+    if (max_iterations <= 0) {
+        throw std::invalid_argument("The maximum number of Parareal iterations must be positive.");
+    }
+}
+
+DFieldSpXVx Parareal::operator()(
+        DFieldSpXVx const allfdistribu,
+        double const time_start,
+        double const dt,
+        int const steps) const
+{
+    int comm_size;
+    int rank;
+    MPI_Comm_size(m_comm, &comm_size);
+    MPI_Comm_rank(m_comm, &rank);
+    int const last_rank = comm_size - 1;
+
+    if (steps % comm_size != 0) {
+        throw std::invalid_argument(
+                "The number of steps (" + std::to_string(steps)
+                + ") must be a multiple of the number of Parareal time slices ("
+                + std::to_string(comm_size) + ").");
+    }
+    int const slice_steps = steps / comm_size;
+    if (slice_steps % m_coarse_ratio != 0) {
+        throw std::invalid_argument(
+                "The number of steps in each time slice (" + std::to_string(slice_steps)
+                + ") must be a multiple of the coarse ratio (" + std::to_string(m_coarse_ratio)
+                + ").");
+    }
+
+    Kokkos::Profiling::pushRegion("Parareal");
+    double const wall_time_start = MPI_Wtime();
+    int const coarse_steps = slice_steps / m_coarse_ratio;
+    double const coarse_dt = dt * m_coarse_ratio;
+    double const slice_start = time_start + rank * slice_steps * dt;
+
+    IdxRangeSpXVx const idx_range = get_idx_range(allfdistribu);
+    int const message_size = idx_range.size();
+    MPI_Datatype const message_type = MPI_type_descriptor_t<double>;
+
+    // The state at the start and at the end of the time slice of this rank
+    DFieldMemSpXVx slice_start_alloc(idx_range);
+    DFieldMemSpXVx slice_end_alloc(idx_range);
+    // The coarse propagations of the previous and current states at the start of the slice
+    DFieldMemSpXVx coarse_old_alloc(idx_range);
+    DFieldMemSpXVx coarse_new_alloc(idx_range);
+    DFieldMemSpXVx fine_alloc(idx_range);
+
+    MPI_Request send_request = MPI_REQUEST_NULL;
+
+    auto receive_slice_start = [&]() {
+        if (rank > 0) {
+            Kokkos::fence();
+            MPI_Recv(
+                    slice_start_alloc.data_handle(),
+                    message_size,
+                    message_type,
+                    rank - 1,
+                    0,
+                    m_comm,
+                    MPI_STATUS_IGNORE);
+        }
+    };
+    auto send_slice_end = [&]() {
+        if (rank < last_rank) {
+            Kokkos::fence();
+            MPI_Isend(
+                    slice_end_alloc.data_handle(),
+                    message_size,
+                    message_type,
+                    rank + 1,
+                    0,
+                    m_comm,
+                    &send_request);
+        }
+    };
+
+    // Initial prediction with a sequential sweep of the coarse solver
+    ddc::parallel_deepcopy(slice_start_alloc, allfdistribu);
+    receive_slice_start();
+    ddc::parallel_deepcopy(coarse_old_alloc, slice_start_alloc);
+    m_coarse_solver(get_field(coarse_old_alloc), slice_start, coarse_dt, coarse_steps);
+    ddc::parallel_deepcopy(slice_end_alloc, coarse_old_alloc);
+    send_slice_end();
+
+    // The reduction of the residual of an iteration is carried out during the fine propagation
+    // of the next iteration so that the ranks do not wait for the coarse propagation of the
+    // last slice before starting the next iteration. The convergence is therefore detected one
+    // fine propagation late.
+    double local_residual = 0.;
+    double residual = 0.;
+    MPI_Request residual_request = MPI_REQUEST_NULL;
+    auto wait_for_residual = [&](int const residual_iteration) {
+        MPI_Wait(&residual_request, MPI_STATUS_IGNORE);
+        if (rank == 0) {
+            std::cout << "Parareal iteration " << residual_iteration
+                      << " : residual = " << residual << std::endl;
+        }
+        return residual < m_tolerance;
+    };
+
+    double fine_wall_time = 0.;
+    int n_fine_propagations = 0;
+    int const n_iterations = std::min(m_max_iterations, comm_size);
+    int iteration = 0;
+    while (iteration < n_iterations) {
+        // Fine propagation of all the slices (in parallel)
+        double const fine_wall_time_start = MPI_Wtime();
+        ddc::parallel_deepcopy(fine_alloc, slice_start_alloc);
+        m_fine_solver(get_field(fine_alloc), slice_start, dt, slice_steps);
+        Kokkos::fence();
+        fine_wall_time += MPI_Wtime() - fine_wall_time_start;
+        ++n_fine_propagations;
+
+        if (iteration > 0 && wait_for_residual(iteration)) {
+            break;
+        }
+        ++iteration;
+
+        // Sequential coarse propagation of the corrections
+        receive_slice_start();
+        ddc::parallel_deepcopy(coarse_new_alloc, slice_start_alloc);
+        m_coarse_solver(get_field(coarse_new_alloc), slice_start, coarse_dt, coarse_steps);
+
+        MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+        local_residual = correction_residual(
+                get_const_field(coarse_new_alloc),
+                get_const_field(fine_alloc),
+                get_const_field(coarse_old_alloc),
+                get_const_field(slice_end_alloc));
+        apply_correction(
+                get_field(slice_end_alloc),
+                get_const_field(coarse_new_alloc),
+                get_const_field(fine_alloc),
+                get_const_field(coarse_old_alloc));
+        std::swap(coarse_old_alloc, coarse_new_alloc);
+        send_slice_end();
+
+        MPI_Iallreduce(
+                &local_residual,
+                &residual,
+                1,
+                MPI_DOUBLE,
+                MPI_MAX,
+                m_comm,
+                &residual_request);
+    }
+    if (residual_request != MPI_REQUEST_NULL) {
+        wait_for_residual(iteration);
+    }
+    MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+
+    // The solution is found at the end of the last slice
+    Kokkos::fence();
+    MPI_Bcast(slice_end_alloc.data_handle(), message_size, message_type, last_rank, m_comm);
+    ddc::parallel_deepcopy(allfdistribu, slice_end_alloc);
+    Kokkos::fence();
+
+    // The speedup is measured with respect to a sequential run of the fine solver
+    double const local_wall_time = MPI_Wtime() - wall_time_start;
+    double const local_fine_slice_time = fine_wall_time / n_fine_propagations;
+    double wall_time;
+    double fine_slice_time;
+    MPI_Reduce(&local_wall_time, &wall_time, 1, MPI_DOUBLE, MPI_MAX, 0, m_comm);
+    MPI_Reduce(&local_fine_slice_time, &fine_slice_time, 1, MPI_DOUBLE, MPI_SUM, 0, m_comm);
+    if (rank == 0) {
+        std::cout << "Parareal stopped after " << iteration << " iterations on " << comm_size
+                  << " time slices. Estimated speedup : " << fine_slice_time / wall_time
+                  << std::endl;
+    }
+
+    Kokkos::Profiling::popRegion();
+    return allfdistribu;
+}
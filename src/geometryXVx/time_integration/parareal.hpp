@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <mpi.h>
+
+#include "geometry.hpp"
+#include "itimesolver.hpp"
+
+/**
+ * @brief A class that solves a Boltzmann-Poisson system of equations in parallel in time using
+ * the Parareal algorithm.
+ *
+ * The time interval is split into one time slice per MPI rank. Each iteration of the algorithm
+ * propagates the state at the start of each slice to the end of the slice with the fine
+ * solver, concurrently on all ranks. The coarse solver is then used to propagate the
+ * corrections sequentially from one rank to the next:
+ *
+ * $`U_{n+1}^{k} = G(U_n^{k}) + F(U_n^{k-1}) - G(U_n^{k-1})`$
+ *
+ * where F and G are the fine and coarse propagators. After k iterations the first k slices
+ * are exact so the algorithm always converges in at most as many iterations as there are
+ * ranks. The iterations stop when the largest change of the states at the end of the slices
+ * is smaller than a tolerance. This change is reduced over the ranks during the fine
+ * propagation of the next iteration so the ranks do not wait for each other between two
+ * iterations.
+ *
+ * The coarse solver uses a time step which is coarse_ratio times larger than the fine time step
+ * but it can also use cheaper operators (e.g. lower order interpolators). The solvers should
+ * not save any diagnostics as they are called many times on each time slice (see the nbstep_diag
+ * parameter of PredCorr).
+ *
+ * The distribution function is sent between the ranks directly from the memory space where it
+ * is stored so a GPU-aware MPI is required when running on GPUs.
+ */
+class Parareal : public ITimeSolver
+{
+private:
+    ITimeSolver const& m_coarse_solver;
+
+    ITimeSolver const& m_fine_solver;
+
+    MPI_Comm m_comm;
+
+    int m_coarse_ratio;
+
+    int m_max_iterations;
+
+    double m_tolerance;
+
+public:
+    /**
+     * @brief Creates an instance of the Parareal time integrator.
+     * @param[in] coarse_solver The time integrator used as the coarse propagator.
+     * @param[in] fine_solver The time integrator used as the fine propagator.
+     * @param[in] comm The MPI communicator containing one rank per time slice.
+     * @param[in] coarse_ratio The ratio between the time steps of the coarse and fine solvers.
+     * @param[in] max_iterations The maximum number of Parareal iterations.
+     * @param[in] tolerance The tolerance on the largest change of the states at the end of
+     *                  the time slices below which the iterations are stopped.
+     */
+    Parareal(
+            ITimeSolver const& coarse_solver,
+            ITimeSolver const& fine_solver,
+            MPI_Comm comm,
+            int coarse_ratio,
+            int max_iterations,
+            double tolerance);
+
+    ~Parareal() override = default;
+
+    /**
+     * @brief Solves the Boltzmann-Poisson system.
+     *
+     * The number of steps must be a multiple of the number of MPI ranks and the number of steps
+     * in each time slice must be a multiple of the coarse ratio, otherwise an
+     * std::invalid_argument is thrown. The residual of each iteration and the speedup with
+     * respect to the fine solver are printed by the first rank.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Boltzmann-Poisson system a given number of iterations.
+     * @param[in] time_start The physical time at the start of the simulation.
+     * @param[in] dt The timestep of the fine solver.
+     * @param[in] steps The number of steps of the fine solver.
+     * @return The distribution function after solving the system.
+     */
+    DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double time_start, double dt, int steps = 1)
+            const override;
+};
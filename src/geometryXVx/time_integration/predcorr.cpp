@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: MIT
 
+#include <cassert>
 #include <cmath>
 #include <iostream>
+#include <type_traits>
 
 #include <ddc/ddc.hpp>
 
@@ -9,11 +11,17 @@
 #include <iqnsolver.hpp>
 
 #include "predcorr.hpp"
+#include "predcorr_steps.hpp"
 
-PredCorr::PredCorr(IBoltzmannSolver const& boltzmann_solver, IQNSolver const& poisson_solver)
+PredCorr::PredCorr(
+        IBoltzmannSolver const& boltzmann_solver,
+        IQNSolver const& poisson_solver,
+        int const nbstep_diag)
     : m_boltzmann_solver(boltzmann_solver)
     , m_poisson_solver(poisson_solver)
+    , m_nbstep_diag(nbstep_diag)
 {
+    assert(nbstep_diag >= 0);
 }
 
 DFieldSpXVx PredCorr::operator()(
@@ -22,60 +30,75 @@ DFieldSpXVx PredCorr::operator()(
         double const dt,
         int const steps) const
 {
-    auto allfdistribu_alloc = ddc::create_mirror_view_and_copy(allfdistribu);
-    host_t<DFieldSpXVx> allfdistribu_host = get_field(allfdistribu_alloc);
+    solve(allfdistribu, time_start, dt, steps);
+    return allfdistribu;
+}
+
+FieldSpXVx<float> PredCorr::operator()(
+        FieldSpXVx<float> const allfdistribu,
+        double const time_start,
+        double const dt,
+        int const steps) const
+{
+    solve(allfdistribu, time_start, dt, steps);
+    return allfdistribu;
+}
+
+template <class ElementType>
+void PredCorr::solve(
+        FieldSpXVx<ElementType> const allfdistribu,
+        double const time_start,
+        double const dt,
+        int const steps) const
+{
+    // The host copies are only needed to save the diagnostics
+    bool const save_diagnostics = m_nbstep_diag > 0;
+    host_t<FieldMemSpXVx<ElementType>> allfdistribu_host(
+            save_diagnostics ? get_idx_range(allfdistribu) : IdxRangeSpXVx());
+    host_t<DFieldMemX> electrostatic_potential_host(
+            save_diagnostics ? get_idx_range<GridX>(allfdistribu) : IdxRangeX());
 
     // electrostatic potential and electric field (depending only on x)
-    host_t<DFieldMemX> electrostatic_potential_host(get_idx_range<GridX>(allfdistribu));
     DFieldMemX electrostatic_potential(get_idx_range<GridX>(allfdistribu));
 
     DFieldMemX electric_field(get_idx_range<GridX>(allfdistribu));
 
     // a 2D chunk of the same size as fdistribu
-    host_t<DFieldMemSpXVx> allfdistribu_half_t_host(get_idx_range(allfdistribu));
-    DFieldMemSpXVx allfdistribu_half_t(get_idx_range(allfdistribu));
-
-    m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
-
-    int iter = 0;
-    for (; iter < steps; ++iter) {
-        double const iter_time = time_start + iter * dt;
-
-        // computation of the electrostatic potential at time tn and
-        // the associated electric field
-        m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
-        // copies necessary to PDI
-        ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
-        ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-        ddc::PdiEvent("iteration")
-                .with("iter", iter)
-                .and_with("time_saved", iter_time)
-                .and_with("fdistribu", allfdistribu_host)
-                .and_with("electrostatic_potential", electrostatic_potential_host);
-
-        // copy fdistribu
-        ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu);
-
-        // predictor
-        m_boltzmann_solver(allfdistribu_half_t, electric_field, dt / 2);
-
-        // computation of the electrostatic potential at time tn+1/2
-        // and the associated electric field
-        m_poisson_solver(electrostatic_potential, electric_field, allfdistribu_half_t);
-        // correction on a dt
-        m_boltzmann_solver(allfdistribu, electric_field, dt);
-    }
-
-    double const final_time = time_start + iter * dt;
-    m_poisson_solver(electrostatic_potential, electric_field, allfdistribu);
-    //copies necessary to PDI
-    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
-    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-    ddc::PdiEvent("last_iteration")
-            .with("iter", iter)
-            .and_with("time_saved", final_time)
-            .and_with("fdistribu", allfdistribu_host)
-            .and_with("electrostatic_potential", electrostatic_potential_host);
-
-    return allfdistribu;
+    FieldMemSpXVx<ElementType> allfdistribu_half_t(get_idx_range(allfdistribu));
+
+    predictor_corrector_steps(
+            allfdistribu,
+            get_field(allfdistribu_half_t),
+            get_field(electrostatic_potential),
+            get_field(electric_field),
+            m_boltzmann_solver,
+            m_poisson_solver,
+            [&](char const* const event, int const iter, double const time) {
+                // copies necessary to PDI (these synchronise the host with the device so they
+                // are only carried out when the diagnostics are saved)
+                ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+                ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+                if constexpr (std::is_same_v<ElementType, double>) {
+                    ddc::PdiEvent(event)
+                            .with("iter", iter)
+                            .and_with("time_saved", time)
+                            .and_with("fdistribu", allfdistribu_host)
+                            .and_with("electrostatic_potential", electrostatic_potential_host);
+                } else {
+                    // The outputs are written in double precision
+                    host_t<DFieldMemSpXVx> allfdistribu_output(get_idx_range(allfdistribu));
+                    ddc::for_each(get_idx_range(allfdistribu), [&](IdxSpXVx const ispxvx) {
+                        allfdistribu_output(ispxvx) = allfdistribu_host(ispxvx);
+                    });
+                    ddc::PdiEvent(event)
+                            .with("iter", iter)
+                            .and_with("time_saved", time)
+                            .and_with("fdistribu", allfdistribu_output)
+                            .and_with("electrostatic_potential", electrostatic_potential_host);
+                }
+            },
+            time_start,
+            dt,
+            steps,
+            m_nbstep_diag);
 }
@@ -17,6 +17,10 @@ class IBoltzmannSolver;
  * of a half-timestep. This potential is then used to compute
  * the value of the distribution function at time t+dt, where 
  * dt is the timestep.
+ *
+ * The distribution function and the electrostatic potential are only copied to the host
+ * and exposed to PDI every nbstep_diag steps. The host buffers are not allocated if no
+ * diagnostics are saved.
  */
 class PredCorr : public ITimeSolver
 {
@@ -25,20 +29,33 @@ private:
 
     IQNSolver const& m_poisson_solver;
 
+    int m_nbstep_diag;
+
+    // Solve the system for a distribution function stored with any precision. The outputs are
+    // written in double precision.
+    template <class ElementType>
+    void solve(FieldSpXVx<ElementType> allfdistribu, double time_start, double dt, int steps) const;
+
 public:
     /**
      * @brief Creates an instance of the predictor-corrector class.
      * @param[in] boltzmann_solver A solver for a Boltzmann equation.
      * @param[in] poisson_solver A solver for a Quasi-Neutrality equation.
+     * @param[in] nbstep_diag The number of steps between two outputs of the diagnostics. If it
+     *                  is 0 then no diagnostics are saved (e.g. when the solver is used as a
+     *                  propagator inside another time integrator).
      */
-    PredCorr(IBoltzmannSolver const& boltzmann_solver, IQNSolver const& poisson_solver);
+    PredCorr(
+            IBoltzmannSolver const& boltzmann_solver,
+            IQNSolver const& poisson_solver,
+            int nbstep_diag = 1);
 
     ~PredCorr() override = default;
 
     /**
      * @brief Solves the Boltzmann-Poisson system.
      * @param[in, out] allfdistribu On input : the initial value of the distribution function.
-     *                              On output : the value of the distribution function after solving 
+     *                              On output : the value of the distribution function after solving
      *                              the Boltzmann-Poisson system a given number of iterations.
      * @param[in] time_start The physical time at the start of the simulation.
      * @param[in] dt The timestep.
@@ -47,4 +64,22 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double time_start, double dt, int steps = 1)
             const override;
+
+    /**
+     * @brief Solves the Boltzmann-Poisson system for a distribution function stored in single
+     * precision. The Boltzmann equation, the charge density and the field solve are computed in
+     * double precision. The outputs are written in double precision.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Boltzmann-Poisson system a given number of iterations.
+     * @param[in] time_start The physical time at the start of the simulation.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed by the predictor-corrector.
+     * @return The distribution function after solving the system.
+     */
+    FieldSpXVx<float> operator()(
+            FieldSpXVx<float> allfdistribu,
+            double time_start,
+            double dt,
+            int steps = 1) const;
 };
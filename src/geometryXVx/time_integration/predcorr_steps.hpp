@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+
+/**
+ * @brief Carry out the time steps of the predictor-corrector scheme.
+ *
+ * At each step the electric field computed at time tn is used to advance a copy of the
+ * distribution function on dt/2 (predictor). The electric field computed from this copy at
+ * time tn+1/2 is then used to advance the distribution function on dt (corrector).
+ *
+ * This is the scheme shared by PredCorr and EnsemblePredCorr. The operators only differ by
+ * the dimensions of the fields and by the way the diagnostics are saved.
+ *
+ * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+ *                              On output : the value of the distribution function after the
+ *                              given number of steps.
+ * @param[out] allfdistribu_half_t A buffer with the same index range as allfdistribu.
+ * @param[out] electrostatic_potential A buffer for the electrostatic potential.
+ * @param[out] electric_field A buffer for the electric field.
+ * @param[in] solve_vlasov A callable advancing a distribution function in an electric field
+ *                  for a given duration: solve_vlasov(allfdistribu, electric_field, dt).
+ * @param[in] solve_poisson A callable computing the electrostatic potential and the electric
+ *                  field of a distribution function:
+ *                  solve_poisson(electrostatic_potential, electric_field, allfdistribu).
+ * @param[in] save_diagnostics A callable saving the diagnostics:
+ *                  save_diagnostics(event, iter, time). It is called with the event
+ *                  "iteration" every nbstep_diag steps and with the event "last_iteration"
+ *                  after the last step, once the electrostatic potential has been computed
+ *                  from the distribution function.
+ * @param[in] time_start The physical time at the start of the simulation.
+ * @param[in] dt The timestep.
+ * @param[in] steps The number of iterations to be performed.
+ * @param[in] nbstep_diag The number of steps between two outputs of the diagnostics. If it
+ *                  is 0 then save_diagnostics is never called.
+ */
+template <
+        class FieldFdistribu,
+        class FieldSpatial,
+        class VlasovSolver,
+        class PoissonSolver,
+        class SaveDiagnostics>
+void predictor_corrector_steps(
+        FieldFdistribu const allfdistribu,
+        FieldFdistribu const allfdistribu_half_t,
+        FieldSpatial const electrostatic_potential,
+        FieldSpatial const electric_field,
+        VlasovSolver const& solve_vlasov,
+        PoissonSolver const& solve_poisson,
+        SaveDiagnostics const& save_diagnostics,
+        double const time_start,
+        double const dt,
+        int const steps,
+        int const nbstep_diag)
+{
+    int iter = 0;
+    for (; iter < steps; ++iter) {
+        // computation of the electrostatic potential at time tn and
+        // the associated electric field
+        solve_poisson(electrostatic_potential, electric_field, get_const_field(allfdistribu));
+        if (nbstep_diag > 0 && iter % nbstep_diag == 0) {
+            save_diagnostics("iteration", iter, time_start + iter * dt);
+        }
+
+        // copy fdistribu (asynchronously with respect to the host)
+        ddc::parallel_deepcopy(Kokkos::DefaultExecutionSpace(), allfdistribu_half_t, allfdistribu);
+
+        // predictor
+        solve_vlasov(allfdistribu_half_t, get_const_field(electric_field), dt / 2);
+
+        // computation of the electrostatic potential at time tn+1/2
+        // and the associated electric field
+        solve_poisson(
+                electrostatic_potential,
+                electric_field,
+                get_const_field(allfdistribu_half_t));
+        // correction on a dt
+        solve_vlasov(allfdistribu, get_const_field(electric_field), dt);
+    }
+
+    if (nbstep_diag > 0) {
+        solve_poisson(electrostatic_potential, electric_field, get_const_field(allfdistribu));
+        save_diagnostics("last_iteration", iter, time_start + iter * dt);
+    }
+}
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include "phase_space_tile_map.hpp"
+
+void PhaseSpaceTileMap::dilate(
+        Field<bool, IdxRangeSpXVxTile> const active,
+        ConstField<bool, IdxRangeSpXVxTile> const occupied,
+        int const halo_x,
+        int const halo_tiles)
+{
+    assert(get_idx_range(active) == get_idx_range(occupied));
+    IdxRangeX const idx_range_x = get_idx_range<GridX>(active);
+    int const nx = idx_range_x.size();
+    int const ntiles = get_idx_range<GridVxTile>(active).size();
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(active),
+            KOKKOS_LAMBDA(IdxSpXVxTile const itile) {
+                IdxSp const isp = ddc::select<Species>(itile);
+                int const ix_pos = (ddc::select<GridX>(itile) - idx_range_x.front()).value();
+                int const it_pos = ddc::select<GridVxTile>(itile).uid();
+                int const it_min = Kokkos::max(it_pos - halo_tiles, 0);
+                int const it_max = Kokkos::min(it_pos + halo_tiles, ntiles - 1);
+                bool is_active = false;
+                for (int jx = ix_pos - halo_x; jx <= ix_pos + halo_x && !is_active; ++jx) {
+#ifdef PERIODIC_RDIMX
+                    int const jx_pos = (jx % nx + nx) % nx;
+#else
+                    if (jx < 0 || jx >= nx) {
+                        continue;
+                    }
+                    int const jx_pos = jx;
+#endif
+                    IdxX const jx_idx = idx_range_x.front() + jx_pos;
+                    for (int jt = it_min; jt <= it_max && !is_active; ++jt) {
+                        is_active = occupied(isp, jx_idx, Idx<GridVxTile>(jt));
+                    }
+                }
+                active(itile) = is_active;
+            });
+}
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+
+/**
+ * @brief The tiling of the phase space used to skip the blocks where the distribution function
+ * is negligible.
+ *
+ * The velocity grid of each (species, x) line is split into tiles of tile_size points. A tile
+ * is active if the maximum of |f| on the tile is larger than a threshold. In large parts of
+ * the phase space (the tails of the distribution function, the wall regions of a sheath) the
+ * distribution function is negligible so the operators can skip the inactive tiles.
+ *
+ * The operators find the occupied tiles themselves while they compute the moments of the
+ * distribution function. They then dilate them with dilate() by the distance over which the
+ * operator couples the points, and query the active tiles in a kernel via a View.
+ */
+class PhaseSpaceTileMap
+{
+public:
+    /// @brief The discrete dimension indexing the tiles along the velocity grid.
+    struct GridVxTile
+    {
+    };
+
+    /// @brief The index range of the tiles.
+    using IdxRangeSpXVxTile = IdxRange<Species, GridX, GridVxTile>;
+
+    /// @brief An index of a tile.
+    using IdxSpXVxTile = Idx<Species, GridX, GridVxTile>;
+
+    /**
+     * @brief A light-weight reference to the map which can be captured in a kernel.
+     *
+     * A default-constructed View considers all the tiles as active.
+     */
+    class View
+    {
+        ConstField<bool, IdxRangeSpXVxTile> m_active;
+
+        IdxRangeVx m_idx_range_vx;
+
+        int m_tile_size = 0;
+
+    public:
+        View() = default;
+
+        /**
+         * @brief Create a view of the map.
+         * @param[in] active The field indicating which tiles are active.
+         * @param[in] idx_range_vx The velocity grid.
+         * @param[in] tile_size The number of points in a tile.
+         */
+        View(ConstField<bool, IdxRangeSpXVxTile> active, IdxRangeVx idx_range_vx, int tile_size)
+            : m_active(active)
+            , m_idx_range_vx(idx_range_vx)
+            , m_tile_size(tile_size)
+        {
+        }
+
+        /**
+         * @brief Get the tile containing a point of the phase space.
+         * @param[in] ispxvx The index of the point.
+         * @return The index of the tile.
+         */
+        KOKKOS_FUNCTION IdxSpXVxTile tile(IdxSpXVx ispxvx) const
+        {
+            IdxStepVx const ivx_offset = ddc::select<GridVx>(ispxvx) - m_idx_range_vx.front();
+            return IdxSpXVxTile(
+                    ddc::select<Species>(ispxvx),
+                    ddc::select<GridX>(ispxvx),
+                    Idx<GridVxTile>(ivx_offset.value() / m_tile_size));
+        }
+
+        /**
+         * @brief Get the points of the velocity grid covered by a tile.
+         * @param[in] itile The index of the tile along the velocity grid.
+         * @return The index range of the tile.
+         */
+        KOKKOS_FUNCTION IdxRangeVx tile_idx_range(Idx<GridVxTile> itile) const
+        {
+            IdxVx const ivx_start = m_idx_range_vx.front() + itile.uid() * m_tile_size;
+            int const n_points = Kokkos::min(
+                    m_tile_size,
+                    int((m_idx_range_vx.back() - ivx_start).value()) + 1);
+            return IdxRangeVx(ivx_start, IdxStepVx(n_points));
+        }
+
+        /**
+         * @brief Check if the distribution function must be computed at a point of the phase space.
+         * @param[in] ispxvx The index of the point.
+         * @return True if the point belongs to an active tile.
+         */
+        KOKKOS_FUNCTION bool is_active(IdxSpXVx ispxvx) const
+        {
+            return m_tile_size == 0 || m_active(tile(ispxvx));
+        }
+    };
+
+    /**
+     * @brief Dilate a set of occupied tiles by a halo along x and along the tiles of vx.
+     *
+     * The dilation along x is periodic if the spatial dimension is periodic.
+     *
+     * @param[out] active The tiles which are at most halo_x points along x and halo_tiles tiles
+     *                  along vx away from an occupied tile.
+     * @param[in] occupied The occupied tiles.
+     * @param[in] halo_x The number of points by which the tiles are dilated along x.
+     * @param[in] halo_tiles The number of tiles by which the tiles are dilated along vx.
+     */
+    static void dilate(
+            Field<bool, IdxRangeSpXVxTile> active,
+            ConstField<bool, IdxRangeSpXVxTile> occupied,
+            int halo_x,
+            int halo_tiles);
+};
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+#include "bsl_advection_xyvxvy.hpp"
+
+template class SplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class SplineInterpolator<
+        GridY,
+        BSplinesY,
+        SplineYBoundary,
+        SplineYBoundary,
+        SplineYExtrapolationRule,
+        SplineYExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class SplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class SplineInterpolator<
+        GridVy,
+        BSplinesVy,
+        SplineVyBoundary,
+        SplineVyBoundary,
+        SplineVyExtrapolationRule,
+        SplineVyExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class PreallocatableSplineInterpolator<
+        GridY,
+        BSplinesY,
+        SplineYBoundary,
+        SplineYBoundary,
+        SplineYExtrapolationRule,
+        SplineYExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class PreallocatableSplineInterpolator<
+        GridVy,
+        BSplinesVy,
+        SplineVyBoundary,
+        SplineVyBoundary,
+        SplineVyExtrapolationRule,
+        SplineVyExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+template class BslAdvectionSpatial<GeometryXYVxVy, GridX>;
+template class BslAdvectionSpatial<GeometryXYVxVy, GridY>;
+template class BslAdvectionVelocity<GeometryXYVxVy, GridVx>;
+template class BslAdvectionVelocity<GeometryXYVxVy, GridVy>;
@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <ddc/ddc.hpp>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "geometry.hpp"
+#include "spline_interpolator.hpp"
+
+/// The extrapolation rule used along X by the spline evaluator.
+using SplineXExtrapolationRule = ddc::PeriodicExtrapolationRule<X>;
+
+/// The extrapolation rule used along Y by the spline evaluator.
+using SplineYExtrapolationRule = ddc::PeriodicExtrapolationRule<Y>;
+
+/// The extrapolation rule used along Vx by the spline evaluator.
+using SplineVxExtrapolationRule = ddc::ConstantExtrapolationRule<Vx>;
+
+/// The extrapolation rule used along Vy by the spline evaluator.
+using SplineVyExtrapolationRule = ddc::ConstantExtrapolationRule<Vy>;
+
+/// The spline interpolator along X built from SplineXBuilder and SplineXEvaluator.
+using SplineInterpolatorX = SplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The spline interpolator along Y built from SplineYBuilder and SplineYEvaluator.
+using SplineInterpolatorY = SplineInterpolator<
+        GridY,
+        BSplinesY,
+        SplineYBoundary,
+        SplineYBoundary,
+        SplineYExtrapolationRule,
+        SplineYExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The spline interpolator along Vx built from SplineVxBuilder and SplineVxEvaluator.
+using SplineInterpolatorVx = SplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The spline interpolator along Vy built from SplineVyBuilder and SplineVyEvaluator.
+using SplineInterpolatorVy = SplineInterpolator<
+        GridVy,
+        BSplinesVy,
+        SplineVyBoundary,
+        SplineVyBoundary,
+        SplineVyExtrapolationRule,
+        SplineVyExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The class which creates instances of SplineInterpolatorX.
+using PreallocatableSplineInterpolatorX = PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The class which creates instances of SplineInterpolatorY.
+using PreallocatableSplineInterpolatorY = PreallocatableSplineInterpolator<
+        GridY,
+        BSplinesY,
+        SplineYBoundary,
+        SplineYBoundary,
+        SplineYExtrapolationRule,
+        SplineYExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The class which creates instances of SplineInterpolatorVx.
+using PreallocatableSplineInterpolatorVx = PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The class which creates instances of SplineInterpolatorVy.
+using PreallocatableSplineInterpolatorVy = PreallocatableSplineInterpolator<
+        GridVy,
+        BSplinesVy,
+        SplineVyBoundary,
+        SplineVyBoundary,
+        SplineVyExtrapolationRule,
+        SplineVyExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+
+/// The semi-Lagrangian advection along X.
+using BslAdvectionX = BslAdvectionSpatial<GeometryXYVxVy, GridX>;
+
+/// The semi-Lagrangian advection along Y.
+using BslAdvectionY = BslAdvectionSpatial<GeometryXYVxVy, GridY>;
+
+/// The semi-Lagrangian advection along Vx.
+using BslAdvectionVx = BslAdvectionVelocity<GeometryXYVxVy, GridVx>;
+
+/// The semi-Lagrangian advection along Vy.
+using BslAdvectionVy = BslAdvectionVelocity<GeometryXYVxVy, GridVy>;
+
+// These classes are instantiated once in bsl_advection_xyvxvy.cpp
+extern template class SplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class SplineInterpolator<
+        GridY,
+        BSplinesY,
+        SplineYBoundary,
+        SplineYBoundary,
+        SplineYExtrapolationRule,
+        SplineYExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class SplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class SplineInterpolator<
+        GridVy,
+        BSplinesVy,
+        SplineVyBoundary,
+        SplineVyBoundary,
+        SplineVyExtrapolationRule,
+        SplineVyExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class PreallocatableSplineInterpolator<
+        GridX,
+        BSplinesX,
+        SplineXBoundary,
+        SplineXBoundary,
+        SplineXExtrapolationRule,
+        SplineXExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class PreallocatableSplineInterpolator<
+        GridY,
+        BSplinesY,
+        SplineYBoundary,
+        SplineYBoundary,
+        SplineYExtrapolationRule,
+        SplineYExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class PreallocatableSplineInterpolator<
+        GridVx,
+        BSplinesVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        SplineVxExtrapolationRule,
+        SplineVxExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class PreallocatableSplineInterpolator<
+        GridVy,
+        BSplinesVy,
+        SplineVyBoundary,
+        SplineVyBoundary,
+        SplineVyExtrapolationRule,
+        SplineVyExtrapolationRule,
+        ddc::SplineSolver::LAPACK,
+        GridX,
+        GridY,
+        GridVx,
+        GridVy>;
+extern template class BslAdvectionSpatial<GeometryXYVxVy, GridX>;
+extern template class BslAdvectionSpatial<GeometryXYVxVy, GridY>;
+extern template class BslAdvectionVelocity<GeometryXYVxVy, GridVx>;
+extern template class BslAdvectionVelocity<GeometryXYVxVy, GridVy>;
@@ -67,11 +67,27 @@ int constexpr BSDegreeY = 3;
 int constexpr BSDegreeVx = 3;
 int constexpr BSDegreeVy = 3;
 
+#ifdef NON_UNIFORM_BSPLINES_X
+bool constexpr BsplineOnUniformCellsX = false;
+#else
 bool constexpr BsplineOnUniformCellsX = true;
+#endif
+#ifdef NON_UNIFORM_BSPLINES_Y
+bool constexpr BsplineOnUniformCellsY = false;
+#else
 bool constexpr BsplineOnUniformCellsY = true;
+#endif
 
+#ifdef NON_UNIFORM_BSPLINES_VX
+bool constexpr BsplineOnUniformCellsVx = false;
+#else
 bool constexpr BsplineOnUniformCellsVx = true;
+#endif
+#ifdef NON_UNIFORM_BSPLINES_VY
+bool constexpr BsplineOnUniformCellsVy = false;
+#else
 bool constexpr BsplineOnUniformCellsVy = true;
+#endif
 
 struct BSplinesX
     : std::conditional_t<
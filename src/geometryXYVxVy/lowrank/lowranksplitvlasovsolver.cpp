@@ -0,0 +1,396 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "lowranksplitvlasovsolver.hpp"
+#include "species_info.hpp"
+
+namespace {
+
+template <class Grid1D>
+std::vector<double> get_coordinates(IdxRange<Grid1D> const idx_range)
+{
+    std::vector<double> coords;
+    coords.reserve(idx_range.size());
+    for (Idx<Grid1D> const idx : idx_range) {
+        coords.push_back(ddc::coordinate(idx));
+    }
+    return coords;
+}
+
+} // namespace
+
+LowRankSplitVlasovSolver::LowRankSplitVlasovSolver(IdxRangeXYVxVy const idx_range)
+    : m_idx_range(idx_range)
+    , m_grid_x {get_coordinates(IdxRangeX(idx_range)),
+                true,
+                ddc::discrete_space<BSplinesX>().rmax() - ddc::discrete_space<BSplinesX>().rmin()}
+    , m_grid_y {get_coordinates(IdxRangeY(idx_range)),
+                true,
+                ddc::discrete_space<BSplinesY>().rmax() - ddc::discrete_space<BSplinesY>().rmin()}
+    , m_grid_vx {get_coordinates(IdxRangeVx(idx_range)), false, 0.0}
+    , m_grid_vy {get_coordinates(IdxRangeVy(idx_range)), false, 0.0}
+{
+    assert(m_grid_x.coords.size() >= 4);
+    assert(m_grid_y.coords.size() >= 4);
+    assert(m_grid_vx.coords.size() >= 4);
+    assert(m_grid_vy.coords.size() >= 4);
+}
+
+TensorTrainFdistribu& LowRankSplitVlasovSolver::operator()(
+        TensorTrainFdistribu& allfdistribu,
+        host_t<DConstFieldXY> const electric_field_x,
+        host_t<DConstFieldXY> const electric_field_y,
+        double const dt) const
+{
+    Kokkos::Profiling::pushRegion("LowRankSplitVlasovSolver");
+    m_peak_memory_bytes = allfdistribu.size() * sizeof(double);
+    for (IdxSp const isp : ddc::select<Species>(allfdistribu.idx_range())) {
+        advect_x(allfdistribu, isp, dt / 2);
+        advect_y(allfdistribu, isp, dt / 2);
+        advect_vx(allfdistribu, isp, electric_field_x, dt / 2);
+        advect_vy(allfdistribu, isp, electric_field_y, dt);
+        advect_vx(allfdistribu, isp, electric_field_x, dt / 2);
+        advect_y(allfdistribu, isp, dt / 2);
+        advect_x(allfdistribu, isp, dt / 2);
+    }
+    Kokkos::Profiling::popRegion();
+    return allfdistribu;
+}
+
+void LowRankSplitVlasovSolver::record_memory(
+        TensorTrainFdistribu const& allfdistribu,
+        std::size_t const n_values) const
+{
+    m_peak_memory_bytes = std::max(
+            m_peak_memory_bytes,
+            (allfdistribu.size() + n_values) * sizeof(double));
+}
+
+void LowRankSplitVlasovSolver::advect_x(
+        TensorTrainFdistribu& allfdistribu,
+        IdxSp const isp,
+        double const dt) const
+{
+    using Core = TensorTrainFdistribu::Core;
+    std::array<int, TensorTrainFdistribu::n_cores + 1> const r = allfdistribu.ranks(isp);
+    Eigen::Index const nvx = m_grid_vx.coords.size();
+    double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+
+    // Merge the (x, vx) cores. The element (ix, ivx + nvx * gamma) is G_1(ix) G_2(ivx)(gamma)
+    Core merged = allfdistribu.core(isp, 0)
+                  * TensorTrainFdistribu::reshape(allfdistribu.core(isp, 1), r[1], nvx * r[2]);
+    for (Eigen::Index col(0); col < merged.cols(); ++col) {
+        double const shift = sqrt_me_on_mspecies * m_grid_vx.coords[col % nvx] * dt;
+        advect_line(m_grid_x, shift, merged.col(col).data(), 1);
+    }
+
+    record_memory(
+            allfdistribu,
+            merged.size()
+                    + TensorTrainFdistribu::truncated_split_workspace_size(
+                            merged.rows(),
+                            merged.cols()));
+    Core right;
+    allfdistribu.truncated_split(merged, allfdistribu.core(isp, 0), right);
+    allfdistribu.core(isp, 1) = TensorTrainFdistribu::reshape(right, right.rows() * nvx, r[2]);
+}
+
+void LowRankSplitVlasovSolver::advect_y(
+        TensorTrainFdistribu& allfdistribu,
+        IdxSp const isp,
+        double const dt) const
+{
+    using Core = TensorTrainFdistribu::Core;
+    std::array<int, TensorTrainFdistribu::n_cores + 1> const r = allfdistribu.ranks(isp);
+    Eigen::Index const nvy = m_grid_vy.coords.size();
+    double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
+
+    // Merge the (y, vy) cores. The element (alpha + r2 * iy, ivy) is G_3(iy)(alpha) G_4(ivy)
+    Core merged = allfdistribu.core(isp, 2)
+                  * TensorTrainFdistribu::reshape(allfdistribu.core(isp, 3), r[3], nvy);
+    for (Eigen::Index ivy(0); ivy < nvy; ++ivy) {
+        double const shift = sqrt_me_on_mspecies * m_grid_vy.coords[ivy] * dt;
+        for (Eigen::Index alpha(0); alpha < r[2]; ++alpha) {
+            advect_line(m_grid_y, shift, merged.col(ivy).data() + alpha, r[2]);
+        }
+    }
+
+    record_memory(
+            allfdistribu,
+            merged.size()
+                    + TensorTrainFdistribu::truncated_split_workspace_size(
+                            merged.rows(),
+                            merged.cols()));
+    Core right;
+    allfdistribu.truncated_split(merged, allfdistribu.core(isp, 2), right);
+    allfdistribu.core(isp, 3) = TensorTrainFdistribu::reshape(right, right.rows() * nvy, 1);
+}
+
+void LowRankSplitVlasovSolver::advect_vx(
+        TensorTrainFdistribu& allfdistribu,
+        IdxSp const isp,
+        host_t<DConstFieldXY> const electric_field_x,
+        double const dt) const
+{
+    using Core = TensorTrainFdistribu::Core;
+    IdxRangeX const idx_range_x(m_idx_range);
+    IdxRangeY const idx_range_y(m_idx_range);
+    Eigen::Index const nx = idx_range_x.size();
+    Eigen::Index const ny = idx_range_y.size();
+    Eigen::Index const nvx = m_grid_vx.coords.size();
+    Eigen::Index const nvy = m_grid_vy.coords.size();
+    double const coeff = charge(isp) * std::sqrt(mass(ielec()) / mass(isp)) * dt;
+
+    Core const left = left_part(allfdistribu, isp);
+    Core const right = right_part(allfdistribu, isp);
+    Eigen::Index const rank = left.cols();
+    Eigen::Index const reduced_rank = std::min(rank, nvy);
+
+    // For each y, f(x, vx, y, vy) = A(x, vx) B_y(vy) = A(x, vx) R_y^T Q_y(vy)^T
+    // The advected values of A R_y^T are stored in the block of columns associated with y
+    std::vector<Core> q_factors(ny);
+    Core advected(nx * nvx, ny * reduced_rank);
+    for (Eigen::Index iy(0); iy < ny; ++iy) {
+        Core right_y(rank, nvy);
+        for (Eigen::Index ivy(0); ivy < nvy; ++ivy) {
+            right_y.col(ivy) = right.col(iy + ny * ivy);
+        }
+        Eigen::HouseholderQR<Core> const qr(right_y.transpose());
+        q_factors[iy] = qr.householderQ() * Core::Identity(nvy, reduced_rank);
+        Core const r_factor = qr.matrixQR().topRows(reduced_rank).triangularView<Eigen::Upper>();
+
+        Core left_y = left;
+        IdxY const idx_y = idx_range_y.front() + iy;
+        for (Eigen::Index ix(0); ix < nx; ++ix) {
+            double const shift = coeff * electric_field_x(idx_range_x.front() + ix, idx_y);
+            for (Eigen::Index alpha(0); alpha < rank; ++alpha) {
+                advect_line(m_grid_vx, shift, left_y.col(alpha).data() + ix, nx);
+            }
+        }
+        advected.middleCols(iy * reduced_rank, reduced_rank) = left_y * r_factor.transpose();
+        // The QR decomposition holds a copy of the transpose of right_y
+        record_memory(
+                allfdistribu,
+                left.size() + right.size() + advected.size() + (iy + 1) * nvy * reduced_rank
+                        + 2 * right_y.size() + r_factor.size() + left_y.size());
+    }
+
+    // Recompress and go back to the (y, vy) basis
+    std::size_t const n_live_values
+            = left.size() + right.size() + advected.size() + ny * nvy * reduced_rank;
+    record_memory(
+            allfdistribu,
+            n_live_values
+                    + TensorTrainFdistribu::truncated_split_workspace_size(
+                            advected.rows(),
+                            advected.cols()));
+    Core new_left;
+    Core compressed;
+    allfdistribu.truncated_split(advected, new_left, compressed);
+    Core new_right(compressed.rows(), ny * nvy);
+    for (Eigen::Index iy(0); iy < ny; ++iy) {
+        Core const right_y = compressed.middleCols(iy * reduced_rank, reduced_rank)
+                             * q_factors[iy].transpose();
+        for (Eigen::Index ivy(0); ivy < nvy; ++ivy) {
+            new_right.col(iy + ny * ivy) = right_y.col(ivy);
+        }
+    }
+    set_parts(allfdistribu, isp, new_left, new_right, n_live_values + compressed.size());
+}
+
+void LowRankSplitVlasovSolver::advect_vy(
+        TensorTrainFdistribu& allfdistribu,
+        IdxSp const isp,
+        host_t<DConstFieldXY> const electric_field_y,
+        double const dt) const
+{
+    using Core = TensorTrainFdistribu::Core;
+    IdxRangeX const idx_range_x(m_idx_range);
+    IdxRangeY const idx_range_y(m_idx_range);
+    Eigen::Index const nx = idx_range_x.size();
+    Eigen::Index const ny = idx_range_y.size();
+    Eigen::Index const nvx = m_grid_vx.coords.size();
+    double const coeff = charge(isp) * std::sqrt(mass(ielec()) / mass(isp)) * dt;
+
+    Core const left = left_part(allfdistribu, isp);
+    Core const right = right_part(allfdistribu, isp);
+    Eigen::Index const rank = left.cols();
+    Eigen::Index const reduced_rank = std::min(rank, nvx);
+
+    // For each x, f(x, vx, y, vy) = A_x(vx) B(y, vy) = Q_x(vx) R_x B(y, vy)
+    // The advected values of R_x B are stored in the block of rows associated with x
+    std::vector<Core> q_factors(nx);
+    Core advected(nx * reduced_rank, right.cols());
+    for (Eigen::Index ix(0); ix < nx; ++ix) {
+        Core left_x(nvx, rank);
+        for (Eigen::Index ivx(0); ivx < nvx; ++ivx) {
+            left_x.row(ivx) = left.row(ix + nx * ivx);
+        }
+        Eigen::HouseholderQR<Core> const qr(left_x);
+        q_factors[ix] = qr.householderQ() * Core::Identity(nvx, reduced_rank);
+        Core const r_factor = qr.matrixQR().topRows(reduced_rank).triangularView<Eigen::Upper>();
+
+        Core right_x = right;
+        IdxX const idx_x = idx_range_x.front() + ix;
+        for (Eigen::Index iy(0); iy < ny; ++iy) {
+            double const shift = coeff * electric_field_y(idx_x, idx_range_y.front() + iy);
+            for (Eigen::Index alpha(0); alpha < rank; ++alpha) {
+                advect_line(m_grid_vy, shift, right_x.col(iy).data() + alpha, rank * ny);
+            }
+        }
+        advected.middleRows(ix * reduced_rank, reduced_rank) = r_factor * right_x;
+        // The QR decomposition holds a copy of left_x
+        record_memory(
+                allfdistribu,
+                left.size() + right.size() + advected.size() + (ix + 1) * nvx * reduced_rank
+                        + 2 * left_x.size() + r_factor.size() + right_x.size());
+    }
+
+    // Recompress and go back to the (x, vx) basis
+    std::size_t const n_live_values
+            = left.size() + right.size() + advected.size() + nx * nvx * reduced_rank;
+    record_memory(
+            allfdistribu,
+            n_live_values
+                    + TensorTrainFdistribu::truncated_split_workspace_size(
+                            advected.rows(),
+                            advected.cols()));
+    Core compressed;
+    Core new_right;
+    allfdistribu.truncated_split(advected, compressed, new_right);
+    Core new_left(nx * nvx, compressed.cols());
+    for (Eigen::Index ix(0); ix < nx; ++ix) {
+        Core const left_x = q_factors[ix] * compressed.middleRows(ix * reduced_rank, reduced_rank);
+        for (Eigen::Index ivx(0); ivx < nvx; ++ivx) {
+            new_left.row(ix + nx * ivx) = left_x.row(ivx);
+        }
+    }
+    set_parts(allfdistribu, isp, new_left, new_right, n_live_values + compressed.size());
+}
+
+void LowRankSplitVlasovSolver::advect_line(
+        Grid1D const& grid,
+        double const shift,
+        double* const values,
+        Eigen::Index const stride)
+{
+    std::vector<double> const& coords = grid.coords;
+    int const n = coords.size();
+    std::vector<double> initial_values(n);
+    for (int i(0); i < n; ++i) {
+        initial_values[i] = values[i * stride];
+    }
+
+    for (int i(0); i < n; ++i) {
+        double foot = coords[i] - shift;
+        int first_point;
+        double offset = 0.0;
+        if (grid.periodic) {
+            // Bring the foot back into [coords[0], coords[0] + period)
+            offset = std::floor((foot - coords[0]) / grid.period) * grid.period;
+            foot -= offset;
+            int const cell
+                    = std::upper_bound(coords.begin(), coords.end(), foot) - coords.begin() - 1;
+            first_point = cell - 1;
+        } else {
+            if (foot <= coords[0]) {
+                values[i * stride] = initial_values[0];
+                continue;
+            }
+            if (foot >= coords[n - 1]) {
+                values[i * stride] = initial_values[n - 1];
+                continue;
+            }
+            int const cell
+                    = std::upper_bound(coords.begin(), coords.end(), foot) - coords.begin() - 1;
+            first_point = std::clamp(cell - 1, 0, n - 4);
+        }
+
+        // Cubic Lagrange interpolation on the points [first_point, first_point + 4)
+        double interpolated_value = 0.0;
+        for (int k(first_point); k < first_point + 4; ++k) {
+            int const k_mod = ((k % n) + n) % n;
+            double const x_k = coords[k_mod] + (k - k_mod) / n * grid.period;
+            double weight = 1.0;
+            for (int m(first_point); m < first_point + 4; ++m) {
+                if (m != k) {
+                    int const m_mod = ((m % n) + n) % n;
+                    double const x_m = coords[m_mod] + (m - m_mod) / n * grid.period;
+                    weight *= (foot - x_m) / (x_k - x_m);
+                }
+            }
+            interpolated_value += weight * initial_values[k_mod];
+        }
+        values[i * stride] = interpolated_value;
+    }
+}
+
+TensorTrainFdistribu::Core LowRankSplitVlasovSolver::left_part(
+        TensorTrainFdistribu const& allfdistribu,
+        IdxSp const isp)
+{
+    std::array<int, TensorTrainFdistribu::n_cores + 1> const r = allfdistribu.ranks(isp);
+    Eigen::Index const nx = allfdistribu.core(isp, 0).rows();
+    Eigen::Index const nvx = allfdistribu.core(isp, 1).rows() / r[1];
+    TensorTrainFdistribu::Core const merged
+            = allfdistribu.core(isp, 0)
+              * TensorTrainFdistribu::reshape(allfdistribu.core(isp, 1), r[1], nvx * r[2]);
+    return TensorTrainFdistribu::reshape(merged, nx * nvx, r[2]);
+}
+
+TensorTrainFdistribu::Core LowRankSplitVlasovSolver::right_part(
+        TensorTrainFdistribu const& allfdistribu,
+        IdxSp const isp)
+{
+    std::array<int, TensorTrainFdistribu::n_cores + 1> const r = allfdistribu.ranks(isp);
+    Eigen::Index const ny = allfdistribu.core(isp, 2).rows() / r[2];
+    Eigen::Index const nvy = allfdistribu.core(isp, 3).rows() / r[3];
+    TensorTrainFdistribu::Core const merged
+            = allfdistribu.core(isp, 2)
+              * TensorTrainFdistribu::reshape(allfdistribu.core(isp, 3), r[3], nvy);
+    return TensorTrainFdistribu::reshape(merged, r[2], ny * nvy);
+}
+
+void LowRankSplitVlasovSolver::set_parts(
+        TensorTrainFdistribu& allfdistribu,
+        IdxSp const isp,
+        TensorTrainFdistribu::Core const& left,
+        TensorTrainFdistribu::Core const& right,
+        std::size_t const n_live_values) const
+{
+    using Core = TensorTrainFdistribu::Core;
+    Eigen::Index const nx = allfdistribu.core(isp, 0).rows();
+    Eigen::Index const nvx = left.rows() / nx;
+    Eigen::Index const rank = left.cols();
+    Eigen::Index const nvy = allfdistribu.core(isp, 3).rows() / allfdistribu.ranks(isp)[3];
+    Eigen::Index const ny = right.cols() / nvy;
+    // The parts and the reshaped copy of the part which is split are held with the workspace
+    std::size_t const n_parts_values
+            = n_live_values + left.size() + right.size() + std::max(left.size(), right.size());
+
+    record_memory(
+            allfdistribu,
+            n_parts_values
+                    + TensorTrainFdistribu::truncated_split_workspace_size(nx, nvx * rank));
+    Core remainder;
+    allfdistribu.truncated_split(
+            TensorTrainFdistribu::reshape(left, nx, nvx * rank),
+            allfdistribu.core(isp, 0),
+            remainder);
+    allfdistribu.core(isp, 1)
+            = TensorTrainFdistribu::reshape(remainder, remainder.rows() * nvx, rank);
+
+    record_memory(
+            allfdistribu,
+            n_parts_values
+                    + TensorTrainFdistribu::truncated_split_workspace_size(rank * ny, nvy));
+    allfdistribu.truncated_split(
+            TensorTrainFdistribu::reshape(right, rank * ny, nvy),
+            allfdistribu.core(isp, 2),
+            remainder);
+    allfdistribu.core(isp, 3) = TensorTrainFdistribu::reshape(remainder, remainder.rows() * nvy, 1);
+}
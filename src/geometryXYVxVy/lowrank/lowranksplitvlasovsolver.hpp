@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "tensortrain.hpp"
+
+/**
+ * @brief A class that solves a Vlasov equation for a distribution function stored in
+ * tensor-train format using Strang's splitting.
+ *
+ * The splitting is the same as the one used by SplitVlasovSolver: the advections along
+ * X, Y and Vx are solved on dt/2, then the advection along Vy on dt and finally the
+ * advections along Vx, Y and X on dt/2.
+ *
+ * The cores are ordered as (x, vx, y, vy). The spatial advections only couple two neighbouring
+ * cores: these cores are merged, interpolated along the spatial dimension and split again with
+ * a truncated singular value decomposition. The velocity advections depend on the electric
+ * field which couples x and y. The tensor train is therefore split into a left part
+ * (x, vx) and a right part (y, vy). The part containing the advected dimension is interpolated
+ * for each point of the other spatial dimension and the result is recompressed.
+ *
+ * The interpolations use cubic Lagrange polynomials, with periodic boundary conditions in space
+ * and constant extrapolation in velocity.
+ *
+ * This class is experimental and all the calculations are carried out on the host.
+ */
+class LowRankSplitVlasovSolver
+{
+    // The coordinates of a 1D grid and the information needed to interpolate on it
+    struct Grid1D
+    {
+        std::vector<double> coords;
+        bool periodic;
+        double period;
+    };
+
+    IdxRangeXYVxVy m_idx_range;
+
+    Grid1D m_grid_x;
+    Grid1D m_grid_y;
+    Grid1D m_grid_vx;
+    Grid1D m_grid_vy;
+
+    // The largest amount of memory held by the distribution function and the intermediate
+    // matrices during the last call to operator()
+    mutable std::size_t m_peak_memory_bytes = 0;
+
+public:
+    /**
+     * @brief Creates an instance of the low-rank split vlasov solver class.
+     * @param[in] idx_range The phase space index range on which the distribution function is defined.
+     */
+    explicit LowRankSplitVlasovSolver(IdxRangeXYVxVy idx_range);
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Vlasov equation.
+     * @param[in] electric_field_x The electric field in the x direction computed at all spatial positions.
+     * @param[in] electric_field_y The electric field in the y direction computed at all spatial positions.
+     * @param[in] dt The timestep.
+     *
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    TensorTrainFdistribu& operator()(
+            TensorTrainFdistribu& allfdistribu,
+            host_t<DConstFieldXY> electric_field_x,
+            host_t<DConstFieldXY> electric_field_y,
+            double dt) const;
+
+    /**
+     * @brief Get the peak memory used by the last call to operator().
+     *
+     * The peak memory is the largest amount of memory held simultaneously by the cores of the
+     * distribution function, the intermediate matrices of the advections and the workspace of
+     * the singular value decompositions (see
+     * TensorTrainFdistribu::truncated_split_workspace_size).
+     *
+     * @return The peak memory in bytes.
+     */
+    std::size_t peak_memory_bytes() const
+    {
+        return m_peak_memory_bytes;
+    }
+
+private:
+    // Update the peak memory with the cores and a number of values held by intermediate matrices
+    void record_memory(TensorTrainFdistribu const& allfdistribu, std::size_t n_values) const;
+
+    void advect_x(TensorTrainFdistribu& allfdistribu, IdxSp isp, double dt) const;
+
+    void advect_y(TensorTrainFdistribu& allfdistribu, IdxSp isp, double dt) const;
+
+    void advect_vx(
+            TensorTrainFdistribu& allfdistribu,
+            IdxSp isp,
+            host_t<DConstFieldXY> electric_field_x,
+            double dt) const;
+
+    void advect_vy(
+            TensorTrainFdistribu& allfdistribu,
+            IdxSp isp,
+            host_t<DConstFieldXY> electric_field_y,
+            double dt) const;
+
+    // Interpolate the values found on a 1D grid (with a given stride in memory) at the feet
+    // coords - shift of the characteristics.
+    static void advect_line(Grid1D const& grid, double shift, double* values, Eigen::Index stride);
+
+    // Contract the cores (x, vx) into a matrix of size (nx nvx) x r2
+    static TensorTrainFdistribu::Core left_part(
+            TensorTrainFdistribu const& allfdistribu,
+            IdxSp isp);
+
+    // Contract the cores (y, vy) into a matrix of size r2 x (ny nvy)
+    static TensorTrainFdistribu::Core right_part(
+            TensorTrainFdistribu const& allfdistribu,
+            IdxSp isp);
+
+    // Split the left and right parts into the four cores of the tensor train. n_live_values is
+    // the number of values held by the other intermediate matrices of the caller.
+    void set_parts(
+            TensorTrainFdistribu& allfdistribu,
+            IdxSp isp,
+            TensorTrainFdistribu::Core const& left,
+            TensorTrainFdistribu::Core const& right,
+            std::size_t n_live_values) const;
+};
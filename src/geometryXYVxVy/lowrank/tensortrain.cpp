@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "tensortrain.hpp"
+
+TensorTrainFdistribu::TensorTrainFdistribu(
+        host_t<DConstFieldSpXYVxVy> const allfdistribu,
+        double const tolerance,
+        int const max_rank)
+    : m_idx_range(get_idx_range(allfdistribu))
+    , m_cores(ddc::select<Species>(m_idx_range).size())
+    , m_tolerance(tolerance)
+    , m_max_rank(max_rank)
+{
+    assert(max_rank > 0);
+    IdxRangeX const idx_range_x(m_idx_range);
+    IdxRangeY const idx_range_y(m_idx_range);
+    IdxRangeVx const idx_range_vx(m_idx_range);
+    IdxRangeVy const idx_range_vy(m_idx_range);
+    std::array<Eigen::Index, n_cores> const n_points {
+            Eigen::Index(idx_range_x.size()),
+            Eigen::Index(idx_range_vx.size()),
+            Eigen::Index(idx_range_y.size()),
+            Eigen::Index(idx_range_vy.size())};
+
+    for (IdxSp const isp : ddc::select<Species>(m_idx_range)) {
+        // Unfold the distribution function with the dimensions ordered as (x, vx, y, vy)
+        Core remainder(n_points[0], n_points[1] * n_points[2] * n_points[3]);
+        ddc::for_each(IdxRangeXYVxVy(m_idx_range), [&](IdxXYVxVy const ixyvxvy) {
+            Eigen::Index const ix = (ddc::select<GridX>(ixyvxvy) - idx_range_x.front()).value();
+            Eigen::Index const iy = (ddc::select<GridY>(ixyvxvy) - idx_range_y.front()).value();
+            Eigen::Index const ivx = (ddc::select<GridVx>(ixyvxvy) - idx_range_vx.front()).value();
+            Eigen::Index const ivy = (ddc::select<GridVy>(ixyvxvy) - idx_range_vy.front()).value();
+            remainder(ix, ivx + n_points[1] * (iy + n_points[2] * ivy))
+                    = allfdistribu(isp, ixyvxvy);
+        });
+
+        // Successive truncated singular value decompositions
+        for (std::size_t k(0); k < n_cores - 1; ++k) {
+            Core right;
+            truncated_split(remainder, core(isp, k), right);
+            Eigen::Index const rank = right.rows();
+            remainder = reshape(right, rank * n_points[k + 1], right.cols() / n_points[k + 1]);
+        }
+        core(isp, n_cores - 1) = remainder;
+    }
+}
+
+void TensorTrainFdistribu::to_full(host_t<DFieldSpXYVxVy> const allfdistribu) const
+{
+    assert(get_idx_range(allfdistribu) == m_idx_range);
+    IdxRangeX const idx_range_x(m_idx_range);
+    IdxRangeY const idx_range_y(m_idx_range);
+    IdxRangeVx const idx_range_vx(m_idx_range);
+    IdxRangeVy const idx_range_vy(m_idx_range);
+    Eigen::Index const nx = idx_range_x.size();
+    Eigen::Index const nvx = idx_range_vx.size();
+    Eigen::Index const ny = idx_range_y.size();
+
+    for (IdxSp const isp : ddc::select<Species>(m_idx_range)) {
+        std::array<int, n_cores + 1> const r = ranks(isp);
+        // Contract the cores from right to left
+        Core contraction = reshape(core(isp, n_cores - 1), r[n_cores - 1], idx_range_vy.size());
+        for (int k(n_cores - 2); k >= 0; --k) {
+            Core const product = core(isp, k) * contraction;
+            contraction = reshape(product, r[k], product.size() / r[k]);
+        }
+        ddc::for_each(IdxRangeXYVxVy(m_idx_range), [&](IdxXYVxVy const ixyvxvy) {
+            Eigen::Index const ix = (ddc::select<GridX>(ixyvxvy) - idx_range_x.front()).value();
+            Eigen::Index const iy = (ddc::select<GridY>(ixyvxvy) - idx_range_y.front()).value();
+            Eigen::Index const ivx = (ddc::select<GridVx>(ixyvxvy) - idx_range_vx.front()).value();
+            Eigen::Index const ivy = (ddc::select<GridVy>(ixyvxvy) - idx_range_vy.front()).value();
+            allfdistribu(isp, ixyvxvy) = contraction(0, ix + nx * (ivx + nvx * (iy + ny * ivy)));
+        });
+    }
+}
+
+std::array<int, TensorTrainFdistribu::n_cores + 1> TensorTrainFdistribu::ranks(
+        IdxSp const isp) const
+{
+    std::array<int, n_cores + 1> r;
+    r[0] = 1;
+    for (std::size_t k(0); k < n_cores; ++k) {
+        r[k + 1] = core(isp, k).cols();
+    }
+    return r;
+}
+
+std::size_t TensorTrainFdistribu::size() const
+{
+    std::size_t n_values = 0;
+    for (std::array<Core, n_cores> const& species_cores : m_cores) {
+        for (Core const& species_core : species_cores) {
+            n_values += species_core.size();
+        }
+    }
+    return n_values;
+}
+
+void TensorTrainFdistribu::truncated_split(Core const& matrix, Core& left, Core& right) const
+{
+    Eigen::BDCSVD<Core> const svd(matrix, Eigen::ComputeThinU | Eigen::ComputeThinV);
+    Eigen::VectorXd const& singular_values = svd.singularValues();
+
+    // Remove the smallest singular values while the discarded norm is below the tolerance
+    double const threshold = m_tolerance * m_tolerance * singular_values.squaredNorm();
+    Eigen::Index rank = singular_values.size();
+    double discarded = 0.0;
+    while (rank > 1
+           && discarded + singular_values(rank - 1) * singular_values(rank - 1) <= threshold) {
+        discarded += singular_values(rank - 1) * singular_values(rank - 1);
+        --rank;
+    }
+    rank = std::min(rank, Eigen::Index(m_max_rank));
+
+    left = svd.matrixU().leftCols(rank);
+    right = singular_values.head(rank).asDiagonal() * svd.matrixV().leftCols(rank).transpose();
+}
+
+std::size_t TensorTrainFdistribu::truncated_split_workspace_size(
+        Eigen::Index const rows,
+        Eigen::Index const cols)
+{
+    Eigen::Index const diag_size = std::min(rows, cols);
+    return 2 * rows * cols + (rows + cols) * diag_size + 6 * (diag_size + 1) * (diag_size + 1);
+}
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <Eigen/Dense>
+
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+
+/**
+ * @brief A distribution function stored in tensor-train format.
+ *
+ * For each species the distribution function is approximated as a product of four cores:
+ * @f$ f_s(x, v_x, y, v_y) = G^s_1(x) G^s_2(v_x) G^s_3(y) G^s_4(v_y) @f$
+ * where @f$ G^s_k(i) @f$ is a matrix of size @f$ r_{k-1} \times r_k @f$ with @f$ r_0 = r_4 = 1 @f$.
+ * The dimensions are ordered so that each spatial dimension is next to the velocity
+ * dimension which advects it.
+ *
+ * Each core is stored as its left unfolding, i.e. an Eigen matrix of size
+ * @f$ (r_{k-1} n_k) \times r_k @f$ whose element @f$ (\alpha + r_{k-1} i, \beta) @f$ is
+ * @f$ G_k(\alpha, i, \beta) @f$.
+ *
+ * The ranks are chosen by truncating the singular values so that the relative error made in
+ * each decomposition is smaller than a tolerance, with a maximum rank.
+ *
+ * This class is experimental and all the data is stored on the host.
+ */
+class TensorTrainFdistribu
+{
+public:
+    /// The number of cores of each tensor train.
+    static constexpr std::size_t n_cores = 4;
+
+    /// The type of a core.
+    using Core = Eigen::MatrixXd;
+
+private:
+    IdxRangeSpXYVxVy m_idx_range;
+
+    // The cores of each species
+    std::vector<std::array<Core, n_cores>> m_cores;
+
+    double m_tolerance;
+
+    int m_max_rank;
+
+public:
+    /**
+     * @brief Create the tensor-train approximation of a distribution function.
+     *
+     * @param[in] allfdistribu The distribution function on the full grid.
+     * @param[in] tolerance The relative tolerance used to truncate each singular value decomposition.
+     * @param[in] max_rank The maximum rank of the tensor train.
+     */
+    TensorTrainFdistribu(
+            host_t<DConstFieldSpXYVxVy> allfdistribu,
+            double tolerance,
+            int max_rank);
+
+    /**
+     * @brief Evaluate the tensor train on the full grid.
+     *
+     * @param[out] allfdistribu The distribution function on the full grid.
+     */
+    void to_full(host_t<DFieldSpXYVxVy> allfdistribu) const;
+
+    /**
+     * @brief Get the index range of the distribution function.
+     *
+     * @return The index range.
+     */
+    IdxRangeSpXYVxVy idx_range() const
+    {
+        return m_idx_range;
+    }
+
+    /**
+     * @brief Get a core of the tensor train of a species.
+     *
+     * @param[in] isp The species.
+     * @param[in] k The index of the core (0 for x, 1 for vx, 2 for y and 3 for vy).
+     *
+     * @return A reference to the core.
+     */
+    Core& core(IdxSp isp, std::size_t k)
+    {
+        return m_cores[(isp - m_idx_range.front()).value()][k];
+    }
+
+    /**
+     * @brief Get a core of the tensor train of a species.
+     *
+     * @param[in] isp The species.
+     * @param[in] k The index of the core (0 for x, 1 for vx, 2 for y and 3 for vy).
+     *
+     * @return A constant reference to the core.
+     */
+    Core const& core(IdxSp isp, std::size_t k) const
+    {
+        return m_cores[(isp - m_idx_range.front()).value()][k];
+    }
+
+    /**
+     * @brief Get the ranks @f$ r_0, ..., r_4 @f$ of the tensor train of a species.
+     *
+     * @param[in] isp The species.
+     *
+     * @return The ranks.
+     */
+    std::array<int, n_cores + 1> ranks(IdxSp isp) const;
+
+    /**
+     * @brief Get the number of values stored in all the cores.
+     *
+     * @return The number of values.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Get the relative tolerance used to truncate the decompositions.
+     *
+     * @return The tolerance.
+     */
+    double tolerance() const
+    {
+        return m_tolerance;
+    }
+
+    /**
+     * @brief Get the maximum rank of the tensor train.
+     *
+     * @return The maximum rank.
+     */
+    int max_rank() const
+    {
+        return m_max_rank;
+    }
+
+    /**
+     * @brief Split a matrix into two factors using a truncated singular value decomposition.
+     *
+     * The matrix is approximated by left * right where left has orthonormal columns.
+     * The rank is the smallest rank such that the relative Frobenius error is smaller than
+     * the tolerance of the tensor train, limited by its maximum rank.
+     *
+     * @param[in] matrix The matrix to be split.
+     * @param[out] left The left factor.
+     * @param[out] right The right factor.
+     */
+    void truncated_split(Core const& matrix, Core& left, Core& right) const;
+
+    /**
+     * @brief Get the number of values allocated by truncated_split for a matrix.
+     *
+     * This is an estimate of the allocations made by Eigen::BDCSVD: a scaled copy of the matrix
+     * and its bidiagonalisation, the thin singular vectors and the work arrays of the divide and
+     * conquer algorithm. The factors returned by truncated_split are included.
+     *
+     * @param[in] rows The number of rows of the matrix.
+     * @param[in] cols The number of columns of the matrix.
+     *
+     * @return The number of values.
+     */
+    static std::size_t truncated_split_workspace_size(Eigen::Index rows, Eigen::Index cols);
+
+    /**
+     * @brief Reshape a matrix stored in column-major order.
+     *
+     * @param[in] matrix The matrix to be reshaped.
+     * @param[in] rows The number of rows of the reshaped matrix.
+     * @param[in] cols The number of columns of the reshaped matrix.
+     *
+     * @return A copy of the matrix with the new shape.
+     */
+    static Core reshape(Core const& matrix, Eigen::Index rows, Eigen::Index cols)
+    {
+        assert(rows * cols == matrix.size());
+        return Eigen::Map<Core const>(matrix.data(), rows, cols);
+    }
+};
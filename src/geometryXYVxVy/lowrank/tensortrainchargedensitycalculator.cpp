@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "species_info.hpp"
+#include "tensortrainchargedensitycalculator.hpp"
+
+TensorTrainChargeDensityCalculator::TensorTrainChargeDensityCalculator(
+        host_t<ConstFieldVx<double>> const coeffs_vx,
+        host_t<ConstFieldVy<double>> const coeffs_vy)
+    : m_coeffs_vx(get_idx_range(coeffs_vx))
+    , m_coeffs_vy(get_idx_range(coeffs_vy))
+{
+    ddc::parallel_deepcopy(get_field(m_coeffs_vx), coeffs_vx);
+    ddc::parallel_deepcopy(get_field(m_coeffs_vy), coeffs_vy);
+}
+
+void TensorTrainChargeDensityCalculator::operator()(
+        host_t<DFieldXY> const rho,
+        TensorTrainFdistribu const& allfdistribu) const
+{
+    Kokkos::Profiling::pushRegion("TensorTrainChargeDensityCalculator");
+    using Core = TensorTrainFdistribu::Core;
+    IdxRangeX const idx_range_x = get_idx_range<GridX>(rho);
+    IdxRangeY const idx_range_y = get_idx_range<GridY>(rho);
+    IdxRangeVx const idx_range_vx = get_idx_range(m_coeffs_vx);
+    IdxRangeVy const idx_range_vy = get_idx_range(m_coeffs_vy);
+    Eigen::Index const nx = idx_range_x.size();
+    Eigen::Index const ny = idx_range_y.size();
+
+    Core charge_density = Core::Zero(nx, ny);
+    IdxRangeSp const kin_species_idx_range = ddc::select<Species>(allfdistribu.idx_range());
+    for (IdxSp const isp : kin_species_idx_range) {
+        std::array<int, TensorTrainFdistribu::n_cores + 1> const r = allfdistribu.ranks(isp);
+        Core const& core_vx = allfdistribu.core(isp, 1);
+        Core const& core_vy = allfdistribu.core(isp, 3);
+
+        // Integrate the velocity cores
+        Core integral_vx = Core::Zero(r[1], r[2]);
+        for (IdxVx const ivx : idx_range_vx) {
+            Eigen::Index const j = (ivx - idx_range_vx.front()).value();
+            integral_vx += m_coeffs_vx(ivx) * core_vx.middleRows(j * r[1], r[1]);
+        }
+        Eigen::VectorXd integral_vy = Eigen::VectorXd::Zero(r[3]);
+        for (IdxVy const ivy : idx_range_vy) {
+            Eigen::Index const j = (ivy - idx_range_vy.front()).value();
+            integral_vy += m_coeffs_vy(ivy) * core_vy.middleRows(j * r[3], r[3]).col(0);
+        }
+
+        // Contract the spatial cores with the integrated velocity cores
+        Core const y_part = TensorTrainFdistribu::reshape(
+                allfdistribu.core(isp, 2) * integral_vy,
+                r[2],
+                ny);
+        charge_density += charge(isp) * (allfdistribu.core(isp, 0) * integral_vx * y_part);
+    }
+
+    host_t<DConstFieldSp> const charges_host = ddc::host_discrete_space<Species>().charges();
+    IdxSp const last_kin_species = kin_species_idx_range.back();
+    IdxSp const last_species = get_idx_range(charges_host).back();
+    double const chargedens_adiabspecies
+            = last_kin_species != last_species ? double(charge(last_species)) : 0.0;
+
+    ddc::for_each(get_idx_range(rho), [&](IdxXY const ixy) {
+        Eigen::Index const ix = (ddc::select<GridX>(ixy) - idx_range_x.front()).value();
+        Eigen::Index const iy = (ddc::select<GridY>(ixy) - idx_range_y.front()).value();
+        rho(ixy) = charge_density(ix, iy) + chargedens_adiabspecies;
+    });
+    Kokkos::Profiling::popRegion();
+}
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "tensortrain.hpp"
+
+/**
+ * @brief A class which computes the charge density of a distribution function stored in
+ * tensor-train format.
+ *
+ * The charge density is defined as:
+ * @f$ \rho(x,y) = \sum_s q_s \int_{vx} \int_{vy} f_s(x,y,vx,vy) dvx dvy @f$.
+ * The quadrature is assumed to be separable (e.g. a tensor product of 1D quadratures) so
+ * each velocity core can be integrated independently. The 4D distribution function is
+ * therefore never evaluated.
+ *
+ * This class is experimental and all the calculations are carried out on the host.
+ */
+class TensorTrainChargeDensityCalculator
+{
+private:
+    host_t<FieldMemVx<double>> m_coeffs_vx;
+
+    host_t<FieldMemVy<double>> m_coeffs_vy;
+
+public:
+    /**
+     * @brief Create a TensorTrainChargeDensityCalculator object.
+     * @param[in] coeffs_vx
+     *            The coefficients of the quadrature along vx.
+     * @param[in] coeffs_vy
+     *            The coefficients of the quadrature along vy.
+     */
+    TensorTrainChargeDensityCalculator(
+            host_t<ConstFieldVx<double>> coeffs_vx,
+            host_t<ConstFieldVy<double>> coeffs_vy);
+
+    /**
+     * @brief Computes the charge density rho from the distribution function.
+     * @param[out] rho The charge density.
+     * @param[in] allfdistribu The distribution function in tensor-train format.
+     */
+    void operator()(host_t<DFieldXY> rho, TensorTrainFdistribu const& allfdistribu) const;
+};
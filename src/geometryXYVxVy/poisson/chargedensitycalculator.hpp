@@ -36,4 +36,12 @@ public:
      * @param[in] allfdistribu 
      */
     void operator()(DFieldXY rho, DConstFieldSpXYVxVy allfdistribu) const final;
+
+    /**
+     * @brief Computes the charge density rho from a distribution function stored in single
+     * precision. The integrals are accumulated in double precision.
+     * @param[in, out] rho
+     * @param[in] allfdistribu 
+     */
+    void operator()(DFieldXY rho, ConstFieldSpXYVxVy<float> allfdistribu) const final;
 };
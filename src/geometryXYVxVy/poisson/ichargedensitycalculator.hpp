@@ -29,4 +29,13 @@ public:
      * @param[in] allfdistribu The distribution function.
      */
     virtual void operator()(DFieldXY rho, DConstFieldSpXYVxVy allfdistribu) const = 0;
+
+    /**
+     * Calculate the charge density rho from a distribution function stored in single precision.
+     * The integrals are accumulated in double precision.
+     *
+     * @param[out] rho The charge density.
+     * @param[in] allfdistribu The distribution function.
+     */
+    virtual void operator()(DFieldXY rho, ConstFieldSpXYVxVy<float> allfdistribu) const = 0;
 };
@@ -9,3 +9,11 @@ void NullQNSolver::operator()(
         DConstFieldSpXYVxVy const) const
 {
 }
+
+void NullQNSolver::operator()(
+        DFieldXY const,
+        DFieldXY const,
+        DFieldXY const,
+        ConstFieldSpXYVxVy<float> const) const
+{
+}
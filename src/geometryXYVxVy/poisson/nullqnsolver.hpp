@@ -28,4 +28,18 @@ public:
             DFieldXY electric_field_x,
             DFieldXY electric_field_y,
             DConstFieldSpXYVxVy allfdistribu) const override;
+
+    /**
+     * @brief A QN Solver which does nothing
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field_x The x-component of the electric field, the gradient of the electrostatic potential.
+     * @param[out] electric_field_y The y-component of the electric field, the gradient of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void operator()(
+            DFieldXY electrostatic_potential,
+            DFieldXY electric_field_x,
+            DFieldXY electric_field_y,
+            ConstFieldSpXYVxVy<float> allfdistribu) const override;
 };
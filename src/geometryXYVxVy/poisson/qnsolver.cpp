@@ -11,6 +11,7 @@
 #include "directional_tag.hpp"
 #include "geometry.hpp"
 #include "qnsolver.hpp"
+#include "workspace_arena.hpp"
 
 QNSolver::QNSolver(PoissonSolver const& solve_poisson, IChargeDensityCalculator const& compute_rho)
     : m_solve_poisson(solve_poisson)
@@ -23,14 +24,34 @@ void QNSolver::operator()(
         DFieldXY const electric_field_x,
         DFieldXY const electric_field_y,
         DConstFieldSpXYVxVy const allfdistribu) const
+{
+    solve(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+}
+
+void QNSolver::operator()(
+        DFieldXY const electrostatic_potential,
+        DFieldXY const electric_field_x,
+        DFieldXY const electric_field_y,
+        ConstFieldSpXYVxVy<float> const allfdistribu) const
+{
+    solve(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
+}
+
+template <class ElementType>
+void QNSolver::solve(
+        DFieldXY const electrostatic_potential,
+        DFieldXY const electric_field_x,
+        DFieldXY const electric_field_y,
+        ConstFieldSpXYVxVy<ElementType> const allfdistribu) const
 {
     Kokkos::Profiling::pushRegion("QNSolver");
+    WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+            get_workspace_arena());
     assert((get_idx_range(electrostatic_potential) == get_idx_range<GridX, GridY>(allfdistribu)));
     IdxRangeXY const idx_range_xy = get_idx_range(electrostatic_potential);
 
     // Compute the RHS of the Quasi-Neutrality equation.
-    DFieldMemXY rho(idx_range_xy);
-    DFieldMemVxVy contiguous_slice_vxvy(get_idx_range<GridVx, GridVy>(allfdistribu));
+    DWorkspaceFieldMem<IdxRangeXY> rho(idx_range_xy);
     m_compute_rho(rho, allfdistribu);
 
     VectorField<
@@ -28,6 +28,14 @@ class QNSolver : public IQNSolver
     PoissonSolver const& m_solve_poisson;
     IChargeDensityCalculator const& m_compute_rho;
 
+    // Solve the equation for a distribution function stored with any precision.
+    template <class ElementType>
+    void solve(
+            DFieldXY electrostatic_potential,
+            DFieldXY electric_field_x,
+            DFieldXY electric_field_y,
+            ConstFieldSpXYVxVy<ElementType> allfdistribu) const;
+
 public:
     /**
      * Construct the QNSolver operator.
@@ -52,4 +60,19 @@ public:
             DFieldXY electric_field_x,
             DFieldXY electric_field_y,
             DConstFieldSpXYVxVy allfdistribu) const override;
+
+    /**
+     * The operator which solves the equation for a distribution function stored in single
+     * precision.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field_x The x-component of the electric field, the gradient of the electrostatic potential.
+     * @param[out] electric_field_y The y-component of the electric field, the gradient of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void operator()(
+            DFieldXY electrostatic_potential,
+            DFieldXY electric_field_x,
+            DFieldXY electric_field_y,
+            ConstFieldSpXYVxVy<float> allfdistribu) const override;
 };
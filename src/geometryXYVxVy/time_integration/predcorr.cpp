@@ -1,19 +1,79 @@
 // SPDX-License-Identifier: MIT
 
+#include <cassert>
 #include <cmath>
 #include <iostream>
+#include <string>
+#include <type_traits>
 
 #include <ddc/ddc.hpp>
 
 #include "ddc_alias_inline_functions.hpp"
+#include "first_touch.hpp"
 #include "iqnsolver.hpp"
 #include "ivlasovsolver.hpp"
 #include "predcorr.hpp"
 
-PredCorr::PredCorr(IVlasovSolver const& vlasov_solver, IQNSolver const& poisson_solver)
+namespace {
+/**
+ * Expose the distribution function and the electrostatic potential to PDI. A double precision
+ * host copy of the distribution function is only created for the duration of the event. If the
+ * distribution function is stored in single precision it is converted one species at a time so
+ * no complete single precision host copy is created.
+ *
+ * @param[in] event The name of the PDI event.
+ * @param[in] iter The iteration.
+ * @param[in] time The physical time.
+ * @param[in] allfdistribu The distribution function.
+ * @param[in] electrostatic_potential_host The electrostatic potential on the host.
+ */
+template <class ElementType>
+void expose_diagnostics(
+        std::string const& event,
+        int iter,
+        double time,
+        FieldSpXYVxVy<ElementType> const allfdistribu,
+        host_t<DFieldXY> const electrostatic_potential_host)
+{
+    if constexpr (std::is_same_v<ElementType, double>) {
+        auto allfdistribu_host_alloc = ddc::create_mirror_view_and_copy(allfdistribu);
+        ddc::PdiEvent(event)
+                .with("iter", iter)
+                .and_with("time_saved", time)
+                .and_with("fdistribu", get_field(allfdistribu_host_alloc))
+                .and_with("electrostatic_potential", electrostatic_potential_host);
+    } else {
+        host_t<DFieldMemSpXYVxVy> allfdistribu_output_alloc(get_idx_range(allfdistribu));
+        host_t<DFieldSpXYVxVy> const allfdistribu_output = get_field(allfdistribu_output_alloc);
+        for (IdxSp const isp : get_idx_range<Species>(allfdistribu)) {
+            auto allfdistribu_slice_alloc = ddc::create_mirror_view_and_copy(allfdistribu[isp]);
+            host_t<ConstField<ElementType, IdxRangeXYVxVy>> const allfdistribu_slice
+                    = get_const_field(allfdistribu_slice_alloc);
+            ddc::parallel_for_each(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    get_idx_range(allfdistribu_slice),
+                    [=](IdxXYVxVy const i) {
+                        allfdistribu_output(isp, i) = allfdistribu_slice(i);
+                    });
+        }
+        ddc::PdiEvent(event)
+                .with("iter", iter)
+                .and_with("time_saved", time)
+                .and_with("fdistribu", allfdistribu_output)
+                .and_with("electrostatic_potential", electrostatic_potential_host);
+    }
+}
+} // namespace
+
+PredCorr::PredCorr(
+        IVlasovSolver const& vlasov_solver,
+        IQNSolver const& poisson_solver,
+        int const nbstep_diag)
     : m_vlasov_solver(vlasov_solver)
     , m_poisson_solver(poisson_solver)
+    , m_nbstep_diag(nbstep_diag)
 {
+    assert(nbstep_diag >= 0);
 }
 
 DFieldSpXYVxVy PredCorr::operator()(
@@ -21,8 +81,26 @@ DFieldSpXYVxVy PredCorr::operator()(
         double const dt,
         int const steps) const
 {
-    auto allfdistribu_host_alloc = ddc::create_mirror_view_and_copy(allfdistribu);
-    host_t<DFieldSpXYVxVy> allfdistribu_host = get_field(allfdistribu_host_alloc);
+    solve(allfdistribu, dt, steps);
+    return allfdistribu;
+}
+
+FieldSpXYVxVy<float> PredCorr::operator()(
+        FieldSpXYVxVy<float> const allfdistribu,
+        double const dt,
+        int const steps) const
+{
+    solve(allfdistribu, dt, steps);
+    return allfdistribu;
+}
+
+template <class ElementType>
+void PredCorr::solve(
+        FieldSpXYVxVy<ElementType> const allfdistribu,
+        double const dt,
+        int const steps) const
+{
+    IdxRangeSpXYVxVy const idx_range_fdistribu = get_idx_range(allfdistribu);
 
     // electrostatic potential and electric field (depending only on x)
     DFieldMemXY electrostatic_potential(get_idx_range<GridX, GridY>(allfdistribu));
@@ -32,13 +110,8 @@ DFieldSpXYVxVy PredCorr::operator()(
     host_t<DFieldMemXY> electrostatic_potential_host(get_idx_range<GridX, GridY>(allfdistribu));
 
     // a 2D chunck of the same size as fdistribu
-    DFieldMemSpXYVxVy allfdistribu_half_t(get_idx_range(allfdistribu));
-
-    m_poisson_solver(
-            electrostatic_potential,
-            electric_field_x,
-            electric_field_y,
-            get_const_field(allfdistribu));
+    FieldMemSpXYVxVy<ElementType> allfdistribu_half_t(idx_range_fdistribu);
+    first_touch(get_field(allfdistribu_half_t));
 
     int iter = 0;
     for (; iter < steps; ++iter) {
@@ -51,20 +124,22 @@ DFieldSpXYVxVy PredCorr::operator()(
                 electric_field_x,
                 electric_field_y,
                 get_const_field(allfdistribu));
-        // copies necessary to PDI
-        ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
-        ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-        ddc::PdiEvent("iteration")
-                .with("iter", iter)
-                .and_with("time_saved", iter_time)
-                .and_with("fdistribu", allfdistribu_host)
-                .and_with("electrostatic_potential", electrostatic_potential_host);
+        // copies necessary to PDI (only carried out when the diagnostics are saved)
+        if (m_nbstep_diag > 0 && iter % m_nbstep_diag == 0) {
+            ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+            expose_diagnostics(
+                    "iteration",
+                    iter,
+                    iter_time,
+                    allfdistribu,
+                    get_field(electrostatic_potential_host));
+        }
 
         // copy fdistribu
         ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu);
 
         // predictor
-        m_vlasov_solver(allfdistribu_half_t, electric_field_x, electric_field_y, dt / 2);
+        m_vlasov_solver(get_field(allfdistribu_half_t), electric_field_x, electric_field_y, dt / 2);
 
         // computation of the electrostatic potential at time tn+1/2
         // and the associated electric field
@@ -72,23 +147,27 @@ DFieldSpXYVxVy PredCorr::operator()(
                 electrostatic_potential,
                 electric_field_x,
                 electric_field_y,
-                allfdistribu_half_t);
+                get_const_field(allfdistribu_half_t));
 
         // correction on a dt
         m_vlasov_solver(allfdistribu, electric_field_x, electric_field_y, dt);
     }
 
-    double const final_time = iter * dt;
-    m_poisson_solver(electrostatic_potential, electric_field_x, electric_field_y, allfdistribu);
-
-    //copies necessary to PDI
-    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
-    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
-    ddc::PdiEvent("last_iteration")
-            .with("iter", iter)
-            .and_with("time_saved", final_time)
-            .and_with("fdistribu", allfdistribu_host)
-            .and_with("electrostatic_potential", electrostatic_potential_host);
+    if (m_nbstep_diag > 0) {
+        double const final_time = iter * dt;
+        m_poisson_solver(
+                electrostatic_potential,
+                electric_field_x,
+                electric_field_y,
+                get_const_field(allfdistribu));
 
-    return allfdistribu;
+        //copies necessary to PDI
+        ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+        expose_diagnostics(
+                "last_iteration",
+                iter,
+                final_time,
+                allfdistribu,
+                get_field(electrostatic_potential_host));
+    }
 }
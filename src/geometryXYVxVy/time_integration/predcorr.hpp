@@ -17,6 +17,10 @@ class IVlasovSolver;
  * of a half-timestep. This potential is then used to compute
  * the value of the distribution function at time t+dt, where
  * dt is the timestep.
+ *
+ * The distribution function and the electrostatic potential are only copied to the host
+ * and exposed to PDI every nbstep_diag steps. The double precision host copy of the
+ * distribution function only exists while the diagnostics are written.
  */
 class PredCorr : public ITimeSolver
 {
@@ -25,13 +29,25 @@ private:
 
     IQNSolver const& m_poisson_solver;
 
+    int m_nbstep_diag;
+
+    // Solve the system for a distribution function stored with any precision. The outputs are
+    // converted to double precision.
+    template <class ElementType>
+    void solve(FieldSpXYVxVy<ElementType> allfdistribu, double dt, int steps) const;
+
 public:
     /**
      * @brief Creates an instance of the predictor-corrector class.
      * @param[in] vlasov_solver A solver for a Boltzmann equation.
      * @param[in] poisson_solver A solver for a Poisson equation.
+     * @param[in] nbstep_diag The number of steps between two outputs of the diagnostics. If it
+     *                  is 0 then no diagnostics are saved.
      */
-    PredCorr(IVlasovSolver const& vlasov_solver, IQNSolver const& poisson_solver);
+    PredCorr(
+            IVlasovSolver const& vlasov_solver,
+            IQNSolver const& poisson_solver,
+            int nbstep_diag = 1);
 
     ~PredCorr() override = default;
 
@@ -45,4 +61,18 @@ public:
      * @return The distribution function after solving the system.
      */
     DFieldSpXYVxVy operator()(DFieldSpXYVxVy allfdistribu, double dt, int steps = 1) const override;
+
+    /**
+     * @brief Solves the Vlasov-Poisson system for a distribution function stored in single
+     * precision. The advections, the charge density and the field solve are computed in double
+     * precision. The outputs are written in double precision.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Vlasov-Poisson system a given number of iterations.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed by the predictor-corrector.
+     * @return The distribution function after solving the system.
+     */
+    FieldSpXYVxVy<float> operator()(FieldSpXYVxVy<float> allfdistribu, double dt, int steps = 1)
+            const override;
 };
@@ -16,8 +16,9 @@ SplitVlasovSolver::SplitVlasovSolver(
 {
 }
 
-DFieldSpXYVxVy SplitVlasovSolver::operator()(
-        DFieldSpXYVxVy const allfdistribu,
+template <class ElementType>
+void SplitVlasovSolver::apply_splitting(
+        FieldSpXYVxVy<ElementType> const allfdistribu,
         DConstFieldXY const electric_field_x,
         DConstFieldXY const electric_field_y,
         double const dt) const
@@ -29,6 +30,24 @@ DFieldSpXYVxVy SplitVlasovSolver::operator()(
     m_advec_vx(allfdistribu, electric_field_x, dt / 2);
     m_advec_y(allfdistribu, dt / 2);
     m_advec_x(allfdistribu, dt / 2);
+}
+
+DFieldSpXYVxVy SplitVlasovSolver::operator()(
+        DFieldSpXYVxVy const allfdistribu,
+        DConstFieldXY const electric_field_x,
+        DConstFieldXY const electric_field_y,
+        double const dt) const
+{
+    apply_splitting(allfdistribu, electric_field_x, electric_field_y, dt);
+    return allfdistribu;
+}
 
+FieldSpXYVxVy<float> SplitVlasovSolver::operator()(
+        FieldSpXYVxVy<float> const allfdistribu,
+        DConstFieldXY const electric_field_x,
+        DConstFieldXY const electric_field_y,
+        double const dt) const
+{
+    apply_splitting(allfdistribu, electric_field_x, electric_field_y, dt);
     return allfdistribu;
 }
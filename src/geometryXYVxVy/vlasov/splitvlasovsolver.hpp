@@ -31,6 +31,14 @@ class SplitVlasovSolver : public IVlasovSolver
     /// Advection operator in the vy direction
     IAdvectionVelocity<GeometryXYVxVy, GridVy> const& m_advec_vy;
 
+    // Apply the splitting to a distribution function stored with any precision.
+    template <class ElementType>
+    void apply_splitting(
+            FieldSpXYVxVy<ElementType> allfdistribu,
+            DConstFieldXY electric_field_x,
+            DConstFieldXY electric_field_y,
+            double dt) const;
+
 public:
     /**
      * @brief Creates an instance of the split vlasov solver class.
@@ -64,4 +72,23 @@ public:
             DConstFieldXY electric_field_x,
             DConstFieldXY electric_field_y,
             double dt) const override;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt for a distribution function stored in
+     * single precision. Each advection is carried out in double precision.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving 
+     *                              the Vlasov equation.
+     * @param[in] electric_field_x The electric field in the x direction computed at all spatial positions. 
+     * @param[in] electric_field_y The electric field in the y direction computed at all spatial positions. 
+     * @param[in] dt The timestep. 
+     *
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    FieldSpXYVxVy<float> operator()(
+            FieldSpXYVxVy<float> allfdistribu,
+            DConstFieldXY electric_field_x,
+            DConstFieldXY electric_field_y,
+            double dt) const override;
 };
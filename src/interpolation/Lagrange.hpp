@@ -72,7 +72,15 @@ public:
 private:
     IdxInterp getclosest(CoordDimI value) const;
 
-    KOKKOS_FUNCTION IdxInterp getclosest_binsearch(CoordDimI value) const;
+    /**
+     * @brief Find the cell containing a point. The cell is found in constant time on a
+     * uniform mesh and with a binary search otherwise.
+     *
+     * @param[in] value The coordinate of the point.
+     *
+     * @return The index of the left node of the cell.
+     */
+    KOKKOS_FUNCTION IdxInterp find_cell(CoordDimI value) const;
 
     KOKKOS_FUNCTION double evaluate_lagrange(CoordDimI x_interp) const;
 
@@ -96,23 +104,31 @@ Idx<GridInterp> Lagrange<Execspace, GridInterp, BcMin, BcMax>::getclosest(CoordD
 }
 template <typename Execspace, class GridInterp, BCond BcMin, BCond BcMax>
 KOKKOS_INLINE_FUNCTION Idx<GridInterp> Lagrange<Execspace, GridInterp, BcMin, BcMax>::
-        getclosest_binsearch(CoordDimI x_interp) const
+        find_cell(CoordDimI x_interp) const
 {
     assert(x_interp >= m_left_bound && x_interp <= m_right_bound);
     IdxInterp begin = m_idx_range.front();
-    IdxInterp end = m_idx_range.back();
-    IdxInterp elm_cell = begin + (end - begin) / 2;
-    while (x_interp < ddc::coordinate(elm_cell)
-           || x_interp > ddc::coordinate(elm_cell + IdxStepInterp(1))) {
-        if (x_interp < ddc::coordinate(elm_cell)) {
-            end = elm_cell;
-        } else {
-            begin = elm_cell;
+    if constexpr (ddc::is_uniform_point_sampling_v<GridInterp>) {
+        // On a uniform mesh the cell is found directly from the distance to the first point
+        int const icell = static_cast<int>(
+                (x_interp - ddc::coordinate(begin)) / ddc::step<GridInterp>());
+        int const last_cell = static_cast<int>(m_idx_range.size()) - 2;
+        return begin + IdxStepInterp(Kokkos::min(icell, last_cell));
+    } else {
+        IdxInterp end = m_idx_range.back();
+        IdxInterp elm_cell = begin + (end - begin) / 2;
+        while (x_interp < ddc::coordinate(elm_cell)
+               || x_interp > ddc::coordinate(elm_cell + IdxStepInterp(1))) {
+            if (x_interp < ddc::coordinate(elm_cell)) {
+                end = elm_cell;
+            } else {
+                begin = elm_cell;
+            }
+
+            elm_cell = begin + (end - begin) / 2;
         }
-
-        elm_cell = begin + (end - begin) / 2;
+        return elm_cell;
     }
-    return elm_cell;
 }
 
 /**
@@ -177,7 +193,7 @@ KOKKOS_INLINE_FUNCTION double Lagrange<Execspace, GridInterp, BcMin, BcMax>::eva
     assert(x_intern >= m_left_bound && x_intern <= m_right_bound);
 
     IdxInterp begin, end;
-    IdxInterp icell = getclosest_binsearch(x_intern);
+    IdxInterp icell = find_cell(x_intern);
     IdxInterp mid = icell;
     if (mid >= m_inner_idx_range.back() && BcMax == BCond::PERIODIC) {
         begin = mid - m_poly_support / 2;
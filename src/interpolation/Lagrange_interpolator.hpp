@@ -5,12 +5,16 @@
 #include "Lagrange.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
+#include "idx_range_utils.hpp"
 #include "iinterpolator.hpp"
 
 /**
  * @brief A class for interpolating a function using Lagrange polynomials.
  * It is designed to work with both uniform and non-uniform mesh, and have the advantage to be local.
  *
+ * The interpolation is done in place. Each line along the interpolation dimension is handled by
+ * a team of threads which copies it into its scratch memory before evaluating the polynomials,
+ * so no copy of the whole field is needed.
  */
 template <class GridInterp, BCond BcMin, BCond BcMax, class... Grid1D>
 class LagrangeInterpolator : public IInterpolator<GridInterp, Grid1D...>
@@ -21,6 +25,9 @@ class LagrangeInterpolator : public IInterpolator<GridInterp, Grid1D...>
             typename IInterpolator<GridInterp, Grid1D...>::batched_derivs_idx_range_type;
 
 private:
+    // The largest amount of level 0 (fast) scratch memory used by a team
+    static constexpr std::size_t max_level_0_scratch_bytes = 32768;
+
     int m_degree;
     IdxStep<GridInterp> m_ghost;
 
@@ -83,24 +90,57 @@ public:
                 BcMin != BCond::PERIODIC,
                 "PERIODIC Boundary condition is not supported yet in LagrangeInterpolator.");
 
+        using ExecSpace = Kokkos::DefaultExecutionSpace;
+        using TeamPolicy = Kokkos::TeamPolicy<ExecSpace>;
+        using MemberType = typename TeamPolicy::member_type;
+        using ScratchLine = Kokkos::View<
+                double*,
+                typename ExecSpace::scratch_memory_space,
+                Kokkos::MemoryUnmanaged>;
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRange<Grid1D...>, GridInterp>;
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        using LagrangeEvaluator = Lagrange<ExecSpace, GridInterp, BcMin, BcMax>;
+
         int const deg = m_degree;
-        auto const ghost = m_ghost;
-        auto inout_data_tmp_alloc
-                = ddc::create_mirror_and_copy(Kokkos::DefaultExecutionSpace(), inout_data);
-        auto inout_data_tmp = get_field(inout_data_tmp_alloc);
-        auto batch_idx_range = ddc::remove_dims_of<GridInterp>(get_idx_range(inout_data));
-        ddc::parallel_for_each(
-                Kokkos::DefaultExecutionSpace(),
-                batch_idx_range,
-                KOKKOS_LAMBDA(typename decltype(batch_idx_range)::discrete_element_type const i) {
-                    Lagrange<Kokkos::DefaultExecutionSpace, GridInterp, BcMin, BcMax> evaluator(
+        IdxStep<GridInterp> const ghost = m_ghost;
+        IdxRange<GridInterp> const idx_range_interp = get_idx_range<GridInterp>(inout_data);
+        IdxRangeBatch const batch_idx_range(get_idx_range(inout_data));
+        int const n_interp = idx_range_interp.size();
+
+        // Each line is copied into the scratch memory of a team so the interpolation can be
+        // done in place. Long lines which do not fit in the fast scratch memory use level 1.
+        std::size_t const line_bytes = ScratchLine::shmem_size(n_interp);
+        int const scratch_level = line_bytes > max_level_0_scratch_bytes ? 1 : 0;
+        TeamPolicy policy(ExecSpace(), batch_idx_range.size(), Kokkos::AUTO);
+        policy.set_scratch_size(scratch_level, Kokkos::PerTeam(line_bytes));
+
+        Kokkos::parallel_for(
+                "LagrangeInterpolator",
+                policy,
+                KOKKOS_LAMBDA(MemberType const& team) {
+                    IdxBatch const ib
+                            = ddcHelper::to_discrete_element(team.league_rank(), batch_idx_range);
+                    ScratchLine line(team.team_scratch(scratch_level), n_interp);
+
+                    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, n_interp), [&](int j) {
+                        line(j) = inout_data(ib, idx_range_interp.front() + j);
+                    });
+                    team.team_barrier();
+
+                    // The evaluator only reads the values through a pointer so it can use the
+                    // line stored in the scratch memory
+                    LagrangeEvaluator const evaluator(
                             deg,
-                            inout_data_tmp[i],
-                            get_idx_range<GridInterp>(inout_data),
+                            Field<double,
+                                  IdxRange<GridInterp>,
+                                  std::experimental::layout_right,
+                                  typename ExecSpace::memory_space>(line.data(), idx_range_interp),
+                            idx_range_interp,
                             ghost);
-                    for (Idx<GridInterp> j : get_idx_range<GridInterp>(inout_data)) {
-                        inout_data(i, j) = evaluator.evaluate(coordinates(i, j));
-                    }
+                    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, n_interp), [&](int j) {
+                        Idx<GridInterp> const ij = idx_range_interp.front() + j;
+                        inout_data(ib, ij) = evaluator.evaluate(coordinates(ib, ij));
+                    });
                 });
         return inout_data;
     }
@@ -140,4 +180,17 @@ public:
         return std::make_unique<LagrangeInterpolator<GridInterp, BcMin, BcMax, Grid1D...>>(
                 m_evaluator);
     }
+    /**
+     * Create an instance of the LagrangeInterpolator class acting on a block of the batched index range.
+     * The LagrangeInterpolator does not store any buffer so this is the same as preallocate().
+     *
+     * @param[in] idx_range The index range (batched + interpolated) of the data which will be interpolated.
+     *
+     * @return A unique pointer to an instance of the LagrangeInterpolator class.
+     */
+    std::unique_ptr<IInterpolator<GridInterp, Grid1D...>> preallocate(
+            [[maybe_unused]] IdxRange<Grid1D...> idx_range) const override
+    {
+        return preallocate();
+    }
 };
@@ -153,6 +153,20 @@ public:
      */
     virtual std::unique_ptr<IInterpolator<GridInterp, Grid1D...>> preallocate() const = 0;
 
+    /**
+     * @brief Allocate an instance of an IInterpolator acting on a block of the batched index range.
+     *
+     * The returned interpolator may only be applied to data defined on idx_range. Its buffers
+     * therefore only span this block, which allows a large batched problem to be treated block
+     * by block.
+     *
+     * @param[in] idx_range The index range (batched + interpolated) of the data which will be interpolated.
+     *
+     * @return An allocated instance of an IInterpolator.
+     */
+    virtual std::unique_ptr<IInterpolator<GridInterp, Grid1D...>> preallocate(
+            IdxRange<Grid1D...> idx_range) const = 0;
+
     /**
      * @brief Get the batched derivs index range on lower boundaries.
      *
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <memory>
+
 #include <ddc/kernels/splines.hpp>
 
 #include "ddc_alias_inline_functions.hpp"
@@ -53,6 +55,9 @@ class SplineInterpolator : public IInterpolator<GridInterp, Grid1D...>
     using batched_deriv_field_type = ConstField<double, batched_derivs_idx_range_type>;
 
 private:
+    // A builder owned by the interpolator when it acts on a block of the batched index range
+    std::unique_ptr<BuilderType const> m_block_builder;
+
     BuilderType const& m_builder;
 
     EvaluatorType const& m_evaluator;
@@ -77,6 +82,22 @@ public:
     {
     }
 
+    /**
+     * @brief Create a spline interpolator object acting on a block of the batched index range.
+     *
+     * A builder is created on the block so the spline coefficients are only allocated on the block.
+     *
+     * @param[in] idx_range The index range (batched + interpolated) of the block.
+     * @param[in] evaluator An operator which evaluates the value of a spline at requested coordinates.
+     */
+    SplineInterpolator(IdxRange<Grid1D...> idx_range, EvaluatorType const& evaluator)
+        : m_block_builder(std::make_unique<BuilderType const>(idx_range))
+        , m_builder(*m_block_builder)
+        , m_evaluator(evaluator)
+        , m_coefs(m_builder.batched_spline_domain())
+    {
+    }
+
     ~SplineInterpolator() override = default;
 
     batched_derivs_idx_range_type batched_derivs_idx_range_xmin(
@@ -198,4 +219,28 @@ public:
                 Solver,
                 Grid1D...>>(m_builder, m_evaluator);
     }
+
+    /**
+     * Create an instance of the SplineInterpolator class acting on a block of the batched index range.
+     *
+     * @param[in] idx_range The index range (batched + interpolated) of the data which will be interpolated.
+     *
+     * @return A unique pointer to an instance of the SplineInterpolator class.
+     */
+    std::unique_ptr<IInterpolator<GridInterp, Grid1D...>> preallocate(
+            IdxRange<Grid1D...> idx_range) const override
+    {
+        if (idx_range == m_builder.batched_interpolation_domain()) {
+            return preallocate();
+        }
+        return std::make_unique<SplineInterpolator<
+                GridInterp,
+                BSplines,
+                BcMin,
+                BcMax,
+                LeftExtrapolationRule,
+                RightExtrapolationRule,
+                Solver,
+                Grid1D...>>(idx_range, m_evaluator);
+    }
 };
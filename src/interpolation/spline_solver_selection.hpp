@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "iinterpolator.hpp"
+
+/**
+ * @brief The choice of the solver used to compute the spline coefficients.
+ *
+ * The batched solvers provided by DDC (ddc::SplineSolver) have different performances
+ * depending on the number of batches, the degree of the splines and the number of threads.
+ * The solver can therefore be chosen at runtime, or chosen by timing a few builds on the
+ * simulation grid (Benchmark).
+ */
+enum class SplineSolverChoice {
+    /// Use the LAPACK-based solver (ddc::SplineSolver::LAPACK).
+    LAPACK,
+    /// Use the Ginkgo-based sparse solver (ddc::SplineSolver::GINKGO).
+    GINKGO,
+    /// Time both solvers and use the faster one.
+    Benchmark
+};
+
+/**
+ * @brief Get the spline solver choice described by a string (as found in an input file).
+ *
+ * @param[in] name The name of the solver: "LAPACK", "GINKGO" or "benchmark".
+ *
+ * @return The spline solver choice.
+ */
+inline SplineSolverChoice spline_solver_choice_from_string(std::string const& name)
+{
+    if (name == "LAPACK") {
+        return SplineSolverChoice::LAPACK;
+    } else if (name == "GINKGO") {
+        return SplineSolverChoice::GINKGO;
+    } else if (name == "benchmark") {
+        return SplineSolverChoice::Benchmark;
+    } else {
+        throw std::runtime_error("Unknown spline solver : " + name);
+    }
+}
+
+/**
+ * @brief Measure the average time taken by an interpolator to interpolate a function defined
+ * on an index range.
+ *
+ * The function is interpolated at the interpolation points themselves so the values remain
+ * bounded whatever the number of repetitions. The first interpolation is not timed as it may
+ * include the setup of the solver. If the interpolator uses Hermite boundary conditions then
+ * the derivatives are set to 0.
+ *
+ * @param[in] interpolator The interpolator being timed.
+ * @param[in] idx_range The index range on which the function is defined.
+ * @param[in] n_repeats The number of interpolations which are timed.
+ *
+ * @return The average duration of an interpolation in seconds.
+ */
+template <class GridInterp, class... Grid1D>
+double time_interpolation(
+        IPreallocatableInterpolator<GridInterp, Grid1D...> const& interpolator,
+        IdxRange<Grid1D...> const& idx_range,
+        int const n_repeats)
+{
+    using CoordInterp = Coord<typename GridInterp::continuous_dimension_type>;
+    using InterpolatorType = IInterpolator<GridInterp, Grid1D...>;
+    using IdxRangeDerivs = typename InterpolatorType::batched_derivs_idx_range_type;
+
+    FieldMem<double, IdxRange<Grid1D...>> values_alloc(idx_range);
+    FieldMem<CoordInterp, IdxRange<Grid1D...>> coords_alloc(idx_range);
+    FieldMem<double, IdxRangeDerivs> derivs_min(
+            interpolator.batched_derivs_idx_range_xmin(idx_range));
+    FieldMem<double, IdxRangeDerivs> derivs_max(
+            interpolator.batched_derivs_idx_range_xmax(idx_range));
+    ddc::parallel_fill(values_alloc, 1.);
+    ddc::parallel_fill(derivs_min, 0.);
+    ddc::parallel_fill(derivs_max, 0.);
+    Field<CoordInterp, IdxRange<Grid1D...>> const coords = get_field(coords_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(Idx<Grid1D...> const idx) {
+                coords(idx) = ddc::coordinate(ddc::select<GridInterp>(idx));
+            });
+
+    std::unique_ptr<InterpolatorType> const interpolator_ptr = interpolator.preallocate();
+    InterpolatorType const& interp = *interpolator_ptr;
+
+    interp(get_field(values_alloc),
+           get_const_field(coords),
+           get_const_field(derivs_min),
+           get_const_field(derivs_max));
+    Kokkos::fence();
+
+    std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+    for (int i(0); i < n_repeats; ++i) {
+        interp(get_field(values_alloc),
+               get_const_field(coords),
+               get_const_field(derivs_min),
+               get_const_field(derivs_max));
+    }
+    Kokkos::fence();
+    std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count() / n_repeats;
+}
+
+/**
+ * @brief Select the interpolator matching a spline solver choice.
+ *
+ * If the choice is SplineSolverChoice::Benchmark then both interpolators are timed on the
+ * index range with time_interpolation and the faster one is returned. Otherwise only the
+ * interpolator matching the choice is used so the other one may be null. This allows the
+ * caller to only create the builders and the interpolators of the chosen solver.
+ *
+ * @param[in] choice The spline solver choice.
+ * @param[in] lapack_interpolator An interpolator using the LAPACK-based solver (may be null
+ *                  if the choice is SplineSolverChoice::GINKGO).
+ * @param[in] ginkgo_interpolator An interpolator using the Ginkgo-based solver (may be null
+ *                  if the choice is SplineSolverChoice::LAPACK).
+ * @param[in] idx_range The index range on which the interpolator is used (Benchmark only).
+ * @param[in] n_repeats The number of timed interpolations (Benchmark only).
+ *
+ * @return A reference to the selected interpolator.
+ */
+template <class GridInterp, class... Grid1D>
+IPreallocatableInterpolator<GridInterp, Grid1D...> const& select_spline_interpolator(
+        SplineSolverChoice const choice,
+        IPreallocatableInterpolator<GridInterp, Grid1D...> const* const lapack_interpolator,
+        IPreallocatableInterpolator<GridInterp, Grid1D...> const* const ginkgo_interpolator,
+        IdxRange<Grid1D...> const& idx_range,
+        int const n_repeats = 5)
+{
+    if (choice != SplineSolverChoice::GINKGO && !lapack_interpolator) {
+        throw std::invalid_argument("The LAPACK spline interpolator is required.");
+    }
+    if (choice != SplineSolverChoice::LAPACK && !ginkgo_interpolator) {
+        throw std::invalid_argument("The GINKGO spline interpolator is required.");
+    }
+    if (choice == SplineSolverChoice::LAPACK) {
+        return *lapack_interpolator;
+    } else if (choice == SplineSolverChoice::GINKGO) {
+        return *ginkgo_interpolator;
+    }
+    double const lapack_time = time_interpolation(*lapack_interpolator, idx_range, n_repeats);
+    double const ginkgo_time = time_interpolation(*ginkgo_interpolator, idx_range, n_repeats);
+    return lapack_time <= ginkgo_time ? *lapack_interpolator : *ginkgo_interpolator;
+}
+
+/**
+ * @brief Select the interpolator matching a spline solver choice.
+ *
+ * If the choice is SplineSolverChoice::Benchmark then both interpolators are timed on the
+ * index range with time_interpolation and the faster one is returned.
+ *
+ * @param[in] choice The spline solver choice.
+ * @param[in] lapack_interpolator An interpolator using the LAPACK-based solver.
+ * @param[in] ginkgo_interpolator An interpolator using the Ginkgo-based solver.
+ * @param[in] idx_range The index range on which the interpolator is used (Benchmark only).
+ * @param[in] n_repeats The number of timed interpolations (Benchmark only).
+ *
+ * @return A reference to the selected interpolator.
+ */
+template <class GridInterp, class... Grid1D>
+IPreallocatableInterpolator<GridInterp, Grid1D...> const& select_spline_interpolator(
+        SplineSolverChoice const choice,
+        IPreallocatableInterpolator<GridInterp, Grid1D...> const& lapack_interpolator,
+        IPreallocatableInterpolator<GridInterp, Grid1D...> const& ginkgo_interpolator,
+        IdxRange<Grid1D...> const& idx_range,
+        int const n_repeats = 5)
+{
+    return select_spline_interpolator(
+            choice,
+            &lapack_interpolator,
+            &ginkgo_interpolator,
+            idx_range,
+            n_repeats);
+}
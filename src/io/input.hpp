@@ -1,5 +1,9 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include <ddc/ddc.hpp>
 
 #include <paraconf.h>
@@ -35,6 +39,127 @@ void parse_executable_arguments(
  */
 PC_tree_t parse_executable_arguments(int argc, char** argv, char const* const params_yaml);
 
+/**
+ * Read the break points of a non-uniform bspline from an input yaml file.
+ *
+ * The method used to build the break points is read from:
+ * - .SplineMesh.<mesh_identifier>_mesh_type
+ *
+ * The possible values and the additional information which is read are:
+ * - 'uniform' (default if the mesh type is not specified): uniform break points.
+ *   - .SplineMesh.<mesh_identifier>_min
+ *   - .SplineMesh.<mesh_identifier>_max
+ *   - .SplineMesh.<mesh_identifier>_ncells
+ * - 'tanh': break points refined near both boundaries (see build_tanh_break_points).
+ *   - .SplineMesh.<mesh_identifier>_min
+ *   - .SplineMesh.<mesh_identifier>_max
+ *   - .SplineMesh.<mesh_identifier>_ncells
+ *   - .SplineMesh.<mesh_identifier>_stretching
+ * - 'geometric': cell sizes following a geometric sequence (see build_geometric_break_points).
+ *   - .SplineMesh.<mesh_identifier>_min
+ *   - .SplineMesh.<mesh_identifier>_max
+ *   - .SplineMesh.<mesh_identifier>_ncells
+ *   - .SplineMesh.<mesh_identifier>_ratio
+ * - 'piecewise': uniform break points in each of a set of zones
+ *   (see build_piecewise_uniform_break_points).
+ *   - .SplineMesh.<mesh_identifier>_zones : the list of the bounds of the zones.
+ *   - .SplineMesh.<mesh_identifier>_zones_ncells : the list of the number of cells in each zone.
+ * - 'break_points': break points provided by the user.
+ *   - .SplineMesh.<mesh_identifier>_break_points : the (increasing) list of the break points.
+ *
+ * A std::runtime_error is thrown if the mesh type is unknown, if the stretching or the ratio
+ * is not positive or if the resulting break points are not strictly increasing.
+ *
+ * @param[in] conf_voicexx The paraconf configuration describing the simulation.
+ * @param[in] mesh_identifier The name of the mesh in the yaml file.
+ *
+ * @returns The break points.
+ */
+template <class Grid1D>
+std::vector<Coord<typename Grid1D::continuous_dimension_type>> read_break_points(
+        PC_tree_t const& conf_voicexx,
+        std::string const& mesh_identifier)
+{
+    using Dim = typename Grid1D::continuous_dimension_type;
+    using Coord1D = Coord<Dim>;
+    std::string const key = ".SplineMesh." + mesh_identifier;
+
+    std::string mesh_type = "uniform";
+    if (!PC_status(PCpp_get(conf_voicexx, key + "_mesh_type"))) {
+        mesh_type = PCpp_string(conf_voicexx, key + "_mesh_type");
+    }
+
+    std::vector<Coord1D> break_points;
+    if (mesh_type == "break_points") {
+        int const n_break_points = PCpp_len(conf_voicexx, key + "_break_points");
+        break_points.resize(n_break_points);
+        for (int i(0); i < n_break_points; ++i) {
+            break_points[i] = Coord1D(PCpp_double(conf_voicexx, key + "_break_points[%d]", i));
+        }
+    } else if (mesh_type == "piecewise") {
+        int const n_zones = PCpp_len(conf_voicexx, key + "_zones_ncells");
+        if (PCpp_len(conf_voicexx, key + "_zones") != n_zones + 1) {
+            throw std::runtime_error(
+                    "The number of zone bounds for " + mesh_identifier
+                    + " should be one more than the number of zones.");
+        }
+        std::vector<Coord1D> zone_bounds(n_zones + 1);
+        std::vector<int> zone_ncells(n_zones);
+        for (int i(0); i < n_zones + 1; ++i) {
+            zone_bounds[i] = Coord1D(PCpp_double(conf_voicexx, key + "_zones[%d]", i));
+        }
+        for (int i(0); i < n_zones; ++i) {
+            zone_ncells[i] = PCpp_int(conf_voicexx, key + "_zones_ncells[%d]", i);
+            if (zone_ncells[i] <= 0 || zone_bounds[i + 1] <= zone_bounds[i]) {
+                throw std::runtime_error(
+                        "The zones of " + mesh_identifier
+                        + " should be increasing and contain at least one cell.");
+            }
+        }
+        break_points = build_piecewise_uniform_break_points(zone_bounds, zone_ncells);
+    } else {
+        Coord1D min(PCpp_double(conf_voicexx, key + "_min"));
+        Coord1D max(PCpp_double(conf_voicexx, key + "_max"));
+        IdxStep<Grid1D> ncells(PCpp_int(conf_voicexx, key + "_ncells"));
+        if (max <= min || ncells.value() < 1) {
+            throw std::runtime_error(
+                    "The mesh " + mesh_identifier
+                    + " should have max > min and at least one cell.");
+        }
+        if (mesh_type == "uniform") {
+            break_points = build_uniform_break_points(min, max, ncells);
+        } else if (mesh_type == "tanh") {
+            double const stretching = PCpp_double(conf_voicexx, key + "_stretching");
+            if (stretching <= 0) {
+                throw std::runtime_error(
+                        "The stretching of the mesh " + mesh_identifier + " should be positive.");
+            }
+            break_points = build_tanh_break_points(min, max, ncells, stretching);
+        } else if (mesh_type == "geometric") {
+            double const ratio = PCpp_double(conf_voicexx, key + "_ratio");
+            if (ratio <= 0) {
+                throw std::runtime_error(
+                        "The ratio of the mesh " + mesh_identifier + " should be positive.");
+            }
+            break_points = build_geometric_break_points(min, max, ncells, ratio);
+        } else {
+            throw std::runtime_error(
+                    "Unknown mesh type for " + mesh_identifier + " : " + mesh_type);
+        }
+    }
+
+    if (break_points.size() < 2) {
+        throw std::runtime_error("The mesh " + mesh_identifier + " needs at least 2 break points.");
+    }
+    for (std::size_t i(1); i < break_points.size(); ++i) {
+        if (break_points[i] <= break_points[i - 1]) {
+            throw std::runtime_error(
+                    "The break points of " + mesh_identifier + " should be strictly increasing.");
+        }
+    }
+    return break_points;
+}
+
 /**
  * Initialise an index range which will serve as an interpolation index range for splines.
  *
@@ -44,10 +169,8 @@ PC_tree_t parse_executable_arguments(int argc, char** argv, char const* const pa
  * - .SplineMesh.<mesh_identifier>_max
  * - .SplineMesh.<mesh_identifier>_ncells
  *
- * If the bsplines are non-uniform then the information to be read is:
- * - .SplineMesh.<mesh_identifier>_MeshFile
- *
- * This string indicates the name of a file which contains the knots of the bspline.
+ * If the bsplines are non-uniform then the break points are built using the method described
+ * in the yaml file (see read_break_points).
  *
  * This information is used to initialise the bsplines. The interpolation index range
  * is then created using the specified method.
@@ -66,7 +189,8 @@ inline IdxRange<Grid1D> init_spline_dependent_idx_range(
                 PCpp_int(conf_voicexx, ".SplineMesh." + mesh_identifier + "_ncells"));
         ddc::init_discrete_space<BSplines>(min, max, ncells);
     } else {
-        throw "Non-uniform bspline initialisation is not yet handled";
+        ddc::init_discrete_space<BSplines>(
+                read_break_points<Grid1D>(conf_voicexx, mesh_identifier));
     }
     ddc::init_discrete_space<Grid1D>(InterpPointInitMethod::template get_sampling<Grid1D>());
     IdxRange<Grid1D> interpolation_idx_range(InterpPointInitMethod::template get_domain<Grid1D>());
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+/**
+ * @brief A component grid of the sparse grid combination technique.
+ *
+ * @tparam NDims The number of dimensions of the grids.
+ */
+template <std::size_t NDims>
+struct CombinationComponent
+{
+    /// The refinement level along each dimension. The grid has 2^level cells along a dimension.
+    std::array<int, NDims> levels;
+
+    /// The coefficient of the component in the combination.
+    double coefficient;
+
+    /**
+     * @brief Get the number of cells of the grid along a dimension.
+     * @param[in] dim The index of the dimension.
+     * @return The number of cells.
+     */
+    int ncells(std::size_t dim) const
+    {
+        return 1 << levels[dim];
+    }
+};
+
+namespace detail {
+
+template <std::size_t NDims>
+void add_components_with_level_sum(
+        std::vector<CombinationComponent<NDims>>& components,
+        std::array<int, NDims>& levels,
+        std::size_t dim,
+        int remaining_levels,
+        double coefficient)
+{
+    if (dim == NDims - 1) {
+        levels[dim] += remaining_levels;
+        components.push_back(CombinationComponent<NDims> {levels, coefficient});
+        levels[dim] -= remaining_levels;
+        return;
+    }
+    for (int l = 0; l <= remaining_levels; ++l) {
+        levels[dim] += l;
+        add_components_with_level_sum(
+                components,
+                levels,
+                dim + 1,
+                remaining_levels - l,
+                coefficient);
+        levels[dim] -= l;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the component grids and the coefficients of the truncated combination technique.
+ *
+ * The combined solution approximates the solution on a sparse grid of level n built on top of
+ * the coarsest grid min_levels. The components are the grids with levels l >= min_levels such
+ * that |l - min_levels|_1 = n - q for q = 0, ..., d-1. Their coefficient is
+ * @f$ (-1)^q \binom{d-1}{q} @f$.
+ *
+ * @param[in] min_levels The refinement levels of the coarsest grid.
+ * @param[in] n The level of the sparse grid. It must be at least d-1.
+ * @return The component grids and their coefficients.
+ */
+template <std::size_t NDims>
+std::vector<CombinationComponent<NDims>> combination_scheme(
+        std::array<int, NDims> const& min_levels,
+        int const n)
+{
+    static_assert(NDims > 0);
+    if (n < int(NDims) - 1) {
+        throw std::invalid_argument("The level of the combination technique is too small.");
+    }
+    std::vector<CombinationComponent<NDims>> components;
+    double binomial = 1.;
+    for (int q = 0; q < int(NDims); ++q) {
+        double const sign = (q % 2 == 0) ? 1. : -1.;
+        std::array<int, NDims> levels = min_levels;
+        detail::add_components_with_level_sum(components, levels, 0, n - q, sign * binomial);
+        binomial = binomial * (NDims - 1 - q) / (q + 1);
+    }
+    return components;
+}
+
+/**
+ * @brief Get the component grid handled by this rank.
+ *
+ * As the discrete dimensions are global in DDC, each component grid is solved by exactly one
+ * rank. The component handled by a rank is therefore its rank in the communicator. Extra ranks
+ * would only repeat the solve of a component so the size of the communicator must match the
+ * number of components.
+ *
+ * @param[in] comm The communicator containing all the ranks.
+ * @param[in] n_components The number of component grids.
+ * @return The index of the component handled by this rank.
+ */
+inline int get_combination_component(MPI_Comm const comm, int const n_components)
+{
+    int comm_size;
+    int rank;
+    MPI_Comm_size(comm, &comm_size);
+    MPI_Comm_rank(comm, &rank);
+    if (comm_size != n_components) {
+        throw std::runtime_error(
+                "The combination technique requires exactly one MPI rank per component grid: "
+                + std::to_string(n_components) + " ranks are needed but "
+                + std::to_string(comm_size) + " were provided.");
+    }
+    return rank;
+}
+
+/**
+ * @brief Combine values computed on each component grid.
+ *
+ * The values of each rank are multiplied by the coefficient of its component and summed. All
+ * the components must provide the same number of values (e.g. the same diagnostic at the same
+ * times).
+ *
+ * @param[in] local_values The values computed on the component grid of this rank.
+ * @param[in] coefficient The coefficient of the component grid of this rank.
+ * @param[in] comm The communicator containing one rank per component.
+ * @return The combined values (on all the ranks).
+ */
+inline std::vector<double> combine_component_values(
+        std::vector<double> const& local_values,
+        double const coefficient,
+        MPI_Comm const comm)
+{
+    std::vector<double> weighted_values(local_values.size());
+    for (std::size_t i(0); i < local_values.size(); ++i) {
+        weighted_values[i] = coefficient * local_values[i];
+    }
+    std::vector<double> combined_values(local_values.size());
+    MPI_Allreduce(
+            weighted_values.data(),
+            combined_values.data(),
+            static_cast<int>(local_values.size()),
+            MPI_DOUBLE,
+            MPI_SUM,
+            comm);
+    return combined_values;
+}
@@ -41,6 +41,15 @@ struct MPITypeDescriptor<unsigned long>
         return MPI_UNSIGNED_LONG;
     }
 };
+
+template <>
+struct MPITypeDescriptor<Kokkos::complex<double>>
+{
+    static MPI_Datatype get_type() noexcept
+    {
+        return MPI_C_DOUBLE_COMPLEX;
+    }
+};
 } // namespace detail
 
 /// A helper to get the MPI type descriptor from an element type
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cassert>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <mpi.h>
+
+#include "ddc_aliases.hpp"
+#include "vector_field_common.hpp"
+
+template <class ElementType, class IdxRangeType>
+class NodeSharedFieldMem;
+
+template <class ElementType, class IdxRangeType>
+inline constexpr bool enable_field<NodeSharedFieldMem<ElementType, IdxRangeType>> = true;
+
+/**
+ * @brief A class which describes the storage for a field which is replicated on all the MPI
+ * ranks but which is only stored once per node.
+ *
+ * Fields which only depend on the spatial dimensions (electrostatic potential, equilibrium
+ * profiles, mapping tables, spline coefficients of the advection field, ...) are needed by all
+ * the ranks. Instead of storing a copy on each rank, the memory is allocated once per node in an
+ * MPI-3 shared memory window (MPI_Win_allocate_shared) and each rank of the node accesses it
+ * through a host Field. The values are computed by one rank of the node (see compute_once) and
+ * are then read by all the ranks of the node.
+ *
+ * The memory is host memory so the Field can only be used in kernels running on the host. As
+ * the shared window is created collectively, an object of this class must be created and
+ * destroyed at the same time by all the ranks of the communicator. It can be neither copied nor
+ * moved.
+ *
+ * @tparam ElementType The type of the elements of the field.
+ * @tparam IdxRangeType The index range on which the field is defined.
+ */
+template <class ElementType, class IdxRangeType>
+class NodeSharedFieldMem
+{
+public:
+    /// @brief The type of the memory space where the field is saved.
+    using memory_space = Kokkos::HostSpace;
+
+    /// @brief The type of a modifiable reference to this field.
+    using span_type
+            = Field<ElementType, IdxRangeType, std::experimental::layout_right, memory_space>;
+
+    /// @brief The type of a constant reference to this field.
+    using view_type
+            = Field<ElementType const, IdxRangeType, std::experimental::layout_right, memory_space>;
+
+    /// @brief The index range on which the field is defined.
+    using index_range_type = IdxRangeType;
+
+private:
+    IdxRangeType m_idx_range;
+
+    // The ranks of the communicator which share the memory of the node
+    MPI_Comm m_node_comm;
+
+    int m_node_rank;
+
+    MPI_Win m_window;
+
+    ElementType* m_data;
+
+public:
+    /**
+     * @brief Allocate the memory shared by the ranks of each node (collective on comm).
+     *
+     * @param[in] idx_range The index range on which the field is defined.
+     * @param[in] comm The communicator containing all the ranks which use the field.
+     */
+    NodeSharedFieldMem(IdxRangeType const& idx_range, MPI_Comm comm) : m_idx_range(idx_range)
+    {
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &m_node_comm);
+        MPI_Comm_rank(m_node_comm, &m_node_rank);
+
+        // Only the first rank of the node allocates memory, the other ranks attach to it
+        MPI_Aint const local_size
+                = m_node_rank == 0 ? MPI_Aint(idx_range.size() * sizeof(ElementType)) : 0;
+        void* local_ptr;
+        MPI_Win_allocate_shared(
+                local_size,
+                sizeof(ElementType),
+                MPI_INFO_NULL,
+                m_node_comm,
+                &local_ptr,
+                &m_window);
+
+        MPI_Aint shared_size;
+        int disp_unit;
+        void* shared_ptr;
+        MPI_Win_shared_query(m_window, 0, &shared_size, &disp_unit, &shared_ptr);
+        assert(shared_size == MPI_Aint(idx_range.size() * sizeof(ElementType)));
+        m_data = static_cast<ElementType*>(shared_ptr);
+
+        // Open a passive target epoch for the lifetime of the object so the memory can be
+        // accessed directly. The accesses are synchronised with synchronize.
+        MPI_Win_lock_all(MPI_MODE_NOCHECK, m_window);
+    }
+
+    /// Deleted: the window cannot be duplicated
+    NodeSharedFieldMem(NodeSharedFieldMem const& other) = delete;
+
+    /// Deleted: the window is attached to the address of the object
+    NodeSharedFieldMem(NodeSharedFieldMem&& other) = delete;
+
+    /// Deleted: the window cannot be duplicated
+    NodeSharedFieldMem& operator=(NodeSharedFieldMem const& other) = delete;
+
+    /// Deleted: the window is attached to the address of the object
+    NodeSharedFieldMem& operator=(NodeSharedFieldMem&& other) = delete;
+
+    /**
+     * @brief Release the shared memory (collective on the communicator used at construction).
+     */
+    ~NodeSharedFieldMem()
+    {
+        MPI_Win_unlock_all(m_window);
+        MPI_Win_free(&m_window);
+        MPI_Comm_free(&m_node_comm);
+    }
+
+    /**
+     * @brief Check if this rank is the rank of its node which writes to the field.
+     *
+     * @returns True if this rank writes to the field.
+     */
+    bool is_writer() const
+    {
+        return m_node_rank == 0;
+    }
+
+    /**
+     * @brief Get the communicator containing the ranks of the node which share the field.
+     *
+     * @returns The communicator.
+     */
+    MPI_Comm node_communicator() const
+    {
+        return m_node_comm;
+    }
+
+    /**
+     * @brief Make the values written by one rank of the node visible to all the ranks of the
+     * node (collective on the node communicator).
+     */
+    void synchronize() const
+    {
+        MPI_Win_sync(m_window);
+        MPI_Barrier(m_node_comm);
+        MPI_Win_sync(m_window);
+    }
+
+    /**
+     * @brief Compute the values of the field on one rank of each node and share them with the
+     * other ranks of the node (collective on the node communicator).
+     *
+     * @param[in] compute A function taking the modifiable field (span_type) as argument and
+     *              filling it. It is only called on the writer rank.
+     */
+    template <class Func>
+    void compute_once(Func&& compute)
+    {
+        if (is_writer()) {
+            std::forward<Func>(compute)(span_view());
+            Kokkos::DefaultHostExecutionSpace().fence();
+        }
+        synchronize();
+    }
+
+    /**
+     * @brief Get the index range on which the field is defined.
+     *
+     * @returns The index range.
+     */
+    IdxRangeType idx_range() const
+    {
+        return m_idx_range;
+    }
+
+    /**
+     * @brief Get the index range on which the field is defined along the requested dimensions.
+     *
+     * @returns The index range.
+     */
+    template <class... QueryGrids>
+    IdxRange<QueryGrids...> idx_range() const
+    {
+        return ddc::select<QueryGrids...>(m_idx_range);
+    }
+
+    /**
+     * Get a modifiable reference to this field.
+     *
+     * This function is designed to match the equivalent function in DDC. In Gysela it should
+     * not be called directly. Instead the global function get_field should be used.
+     *
+     * @return A modifiable reference to this field.
+     */
+    span_type span_view()
+    {
+        return span_type(m_data, m_idx_range);
+    }
+
+    /**
+     * Get a constant reference to this field.
+     *
+     * This function is designed to match the equivalent function in DDC. In Gysela it should
+     * not be called directly. Instead the global function get_field should be used.
+     *
+     * @return A constant reference to this field.
+     */
+    view_type span_view() const
+    {
+        return span_cview();
+    }
+
+    /**
+     * Get a constant reference to this field.
+     *
+     * This function is designed to match the equivalent function in DDC. In Gysela it should
+     * not be called directly. Instead the global function get_const_field should be used.
+     *
+     * @return A constant reference to this field.
+     */
+    view_type span_cview() const
+    {
+        return view_type(m_data, m_idx_range);
+    }
+};
@@ -0,0 +1,749 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+
+#include <mpi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
+#include "ipoisson_solver.hpp"
+#include "mpilayout.hpp"
+#include "mpitransposealltoall.hpp"
+
+/**
+ * See @ref DistributedFFTPoissonSolverImplementation.
+ */
+template <class IdxRangeLaplacian, class IdxRangeFull, class ExecSpace>
+class DistributedFFTPoissonSolver;
+
+/**
+ * @brief A class to solve the following equation:
+ * @f$ -\Delta \phi = \rho @f$
+ * on a periodic 2D index range using a Fourier transform distributed over MPI processes.
+ *
+ * The 2D transform is split into two series of 1D transforms. The right-hand side is first
+ * distributed in slabs along the first dimension. The 1D transforms along the second dimension
+ * are carried out on each slab, then the data is transposed with MPITransposeAllToAll so that
+ * each process owns a slab along the second dimension (a pencil containing all the points of
+ * the first dimension) and the 1D transforms along the first dimension are carried out. The
+ * inverse transforms follow the same path in reverse. The solution and its gradient are
+ * finally gathered so that each process holds the full fields, as with FFTPoissonSolver.
+ *
+ * The right-hand side can either be replicated on all processes or each process can hold a
+ * contribution to it (e.g. the charge density integrated over the velocities stored on this
+ * process). In the second case the contributions are summed with a reduce-scatter so that
+ * each process only receives its slab.
+ *
+ * The 1D transforms of all the lines of a slab (or a pencil) are carried out by a single
+ * kernel which applies a radix-2 FFT to each line. If the number of points along a dimension
+ * is not a power of two, the lines are transformed one after the other with ddc::fft. The
+ * temporary fields and the host buffers used by MPI are allocated once by the constructor, so
+ * an instance must not be used by several threads at the same time.
+ *
+ * The number of points in each dimension must be a multiple of the number of processes.
+ *
+ * The implementation of this class can be found at DistributedFFTPoissonSolver< IdxRange<GridPDEDim1, GridPDEDim2>, IdxRangeFull, ExecSpace >.
+ * @anchor DistributedFFTPoissonSolverImplementation
+ *
+ * @tparam IdxRangeLaplacian The index range on which the equation is defined.
+ * @tparam IdxRangeFull The index range on which the operator() acts. This is equal to the
+ *                      IdxRangeLaplacian plus any batched dimensions.
+ * @tparam ExecSpace The space (CPU/GPU) where the calculations will take place.
+ */
+template <class GridPDEDim1, class GridPDEDim2, class IdxRangeFull, class ExecSpace>
+class DistributedFFTPoissonSolver<IdxRange<GridPDEDim1, GridPDEDim2>, IdxRangeFull, ExecSpace>
+    : public IPoissonSolver<
+              IdxRange<GridPDEDim1, GridPDEDim2>,
+              IdxRangeFull,
+              std::experimental::layout_right,
+              typename ExecSpace::memory_space>
+{
+private:
+    using base_type = IPoissonSolver<
+            IdxRange<GridPDEDim1, GridPDEDim2>,
+            IdxRangeFull,
+            std::experimental::layout_right,
+            typename ExecSpace::memory_space>;
+
+    using Dim1 = typename GridPDEDim1::continuous_dimension_type;
+    using Dim2 = typename GridPDEDim2::continuous_dimension_type;
+
+public:
+    /// @brief Indicates how the right-hand side is distributed over the processes.
+    enum class RhoDistribution {
+        /// Each process holds the full right-hand side.
+        Replicated,
+        /// Each process holds a contribution to the right-hand side. The contributions are summed.
+        PartialSum
+    };
+
+    template <class Dim>
+    struct GridFourier : ddc::PeriodicSampling<ddc::Fourier<Dim>>
+    {
+    };
+
+public:
+    /// @brief The Field type of the arguments to operator().
+    using field_type = typename base_type::field_type;
+    /// @brief The const Field type of the arguments to operator().
+    using const_field_type = typename base_type::const_field_type;
+
+    /// @brief The type of the derivative of @f$ \phi @f$.
+    using vector_field_type = typename base_type::vector_field_type;
+
+    /// @brief The index range type describing the batch dimensions.
+    using batch_idx_range_type = typename base_type::batch_idx_range_type;
+    /// @brief The index type for indexing a batch dimension.
+    using batch_index_type = typename base_type::batch_index_type;
+
+    /// @brief The type of the index range on which the equation is defined.
+    using laplacian_idx_range_type = typename base_type::laplacian_idx_range_type;
+
+    /// @brief The layout space of the Fields passed to operator().
+    using layout_space = typename base_type::layout_space;
+    /// @brief The space (CPU/GPU) where the Fields passed to operator() are saved.
+    using memory_space = typename base_type::memory_space;
+
+    /// @brief The Fourier grid associated with the first dimension.
+    using GridFourier1 = GridFourier<Dim1>;
+    /// @brief The Fourier grid associated with the second dimension.
+    using GridFourier2 = GridFourier<Dim2>;
+
+    /// @brief The index range of a slab distributed along the first dimension.
+    using slab_idx_range_type = IdxRange<GridPDEDim1, GridPDEDim2>;
+    /// @brief The index range of a slab transformed along the second dimension.
+    using mixed_slab_idx_range_type = IdxRange<GridPDEDim1, GridFourier2>;
+    /// @brief The index range of a pencil distributed along the second Fourier dimension.
+    using pencil_idx_range_type = IdxRange<GridFourier2, GridPDEDim1>;
+    /// @brief The index range of a pencil transformed along both dimensions.
+    using fourier_idx_range_type = IdxRange<GridFourier2, GridFourier1>;
+    /// @brief The type of an index of the Fourier space index range.
+    using fourier_index_type = typename fourier_idx_range_type::discrete_element_type;
+
+    /// @brief The type of a complex Field allocated on the memory space.
+    template <class IdxRangeType>
+    using complex_field_mem_type = FieldMem<
+            Kokkos::complex<double>,
+            IdxRangeType,
+            ddc::KokkosAllocator<Kokkos::complex<double>, memory_space>>;
+    /// @brief The type of a complex Field on the memory space.
+    template <class IdxRangeType>
+    using complex_field_type = Field<
+            Kokkos::complex<double>,
+            IdxRangeType,
+            std::experimental::layout_right,
+            memory_space>;
+
+private:
+    using SlabLayout = MPILayout<mixed_slab_idx_range_type, GridPDEDim1>;
+    using PencilLayout = MPILayout<pencil_idx_range_type, GridFourier2>;
+
+    using double_field_mem_type
+            = FieldMem<double, slab_idx_range_type, ddc::KokkosAllocator<double, memory_space>>;
+
+    using double_host_field_mem_type = host_t<DFieldMem<slab_idx_range_type>>;
+
+    /// @brief True if MPI can read and write the fields of the memory space directly.
+    static constexpr bool s_mpi_on_memory_space
+            = Kokkos::SpaceAccessibility<Kokkos::HostSpace, memory_space>::accessible;
+
+    /// @brief The normalisation used for the Fourier transform
+    static constexpr ddc::FFT_Normalization m_norm = ddc::FFT_Normalization::BACKWARD;
+
+private:
+    MPI_Comm m_comm;
+
+    RhoDistribution m_rho_distribution;
+
+    // The transpose is mutable as the MPI operators are not const
+    mutable MPITransposeAllToAll<SlabLayout, PencilLayout> m_transpose;
+
+    laplacian_idx_range_type m_idx_range;
+
+    slab_idx_range_type m_slab_idx_range;
+
+    mixed_slab_idx_range_type m_mixed_slab_idx_range;
+
+    pencil_idx_range_type m_pencil_idx_range;
+
+    fourier_idx_range_type m_fourier_idx_range;
+
+    Idx<GridFourier1> m_zero_mode_1;
+
+    Idx<GridFourier2> m_zero_mode_2;
+
+    // The twiddle factors exp(-2 i pi j / n) of the radix-2 transforms along each dimension
+    complex_field_mem_type<IdxRange<GridPDEDim1>> m_twiddles_1;
+
+    complex_field_mem_type<IdxRange<GridPDEDim2>> m_twiddles_2;
+
+    // The temporary fields are mutable as they are only used as work space by operator()
+    mutable complex_field_mem_type<slab_idx_range_type> m_slab;
+
+    mutable complex_field_mem_type<mixed_slab_idx_range_type> m_mixed_slab;
+
+    mutable complex_field_mem_type<pencil_idx_range_type> m_pencil;
+
+    mutable complex_field_mem_type<fourier_idx_range_type> m_phi_fourier;
+
+    mutable complex_field_mem_type<fourier_idx_range_type> m_efield_fourier;
+
+    mutable double_field_mem_type m_real;
+
+    mutable double_field_mem_type m_real_slab;
+
+    // The host copies used by MPI (empty if MPI can access the memory space)
+    mutable double_host_field_mem_type m_real_host;
+
+    mutable double_host_field_mem_type m_real_slab_host;
+
+private:
+    template <class Grid1D>
+    static IdxRange<GridFourier<typename Grid1D::continuous_dimension_type>> init_fourier_space(
+            IdxRange<Grid1D> idx_range)
+    {
+        using GridFFT = GridFourier<typename Grid1D::continuous_dimension_type>;
+        ddc::init_discrete_space<GridFFT>(ddc::init_fourier_space<GridFFT>(idx_range));
+        // All the modes are kept as the transforms are complex-to-complex
+        return ddc::FourierMesh<GridFFT>(idx_range, true);
+    }
+
+    static mixed_slab_idx_range_type init_mixed_idx_range(
+            laplacian_idx_range_type idx_range,
+            IdxRange<GridFourier2> k_mesh_2)
+    {
+        return mixed_slab_idx_range_type(ddc::select<GridPDEDim1>(idx_range), k_mesh_2);
+    }
+
+    /**
+     * @brief Check that the index range can be distributed over the processes.
+     *
+     * @param[in] laplacian_idx_range The global index range on which the equation is solved.
+     * @param[in] comm The communicator containing the processes which share the work.
+     *
+     * @return The communicator.
+     */
+    static MPI_Comm check_distribution(laplacian_idx_range_type laplacian_idx_range, MPI_Comm comm)
+    {
+        int comm_size;
+        MPI_Comm_size(comm, &comm_size);
+        std::size_t const n1 = ddc::select<GridPDEDim1>(laplacian_idx_range).size();
+        std::size_t const n2 = ddc::select<GridPDEDim2>(laplacian_idx_range).size();
+        if (n1 % comm_size != 0 || n2 % comm_size != 0) {
+            throw std::invalid_argument(
+                    "The number of points in each dimension (" + std::to_string(n1) + ", "
+                    + std::to_string(n2) + ") must be a multiple of the number of processes ("
+                    + std::to_string(comm_size) + ").");
+        }
+        return comm;
+    }
+
+    static bool is_power_of_two(std::size_t n)
+    {
+        return n > 0 && (n & (n - 1)) == 0;
+    }
+
+    /**
+     * @brief Get the twiddle factors of the radix-2 transforms along a dimension.
+     *
+     * @tparam GridPDE The dimension (GridPDEDim1 or GridPDEDim2).
+     *
+     * @return The twiddle factors.
+     */
+    template <class GridPDE>
+    ConstField<Kokkos::complex<double>,
+               IdxRange<GridPDE>,
+               std::experimental::layout_right,
+               memory_space>
+    get_twiddles() const
+    {
+        if constexpr (std::is_same_v<GridPDE, GridPDEDim1>) {
+            return get_const_field(m_twiddles_1);
+        } else {
+            return get_const_field(m_twiddles_2);
+        }
+    }
+
+    /**
+     * @brief Apply a forward 1D transform to each line of a field along its last dimension.
+     *
+     * @param[out] out The transformed field.
+     * @param[in] in The field to be transformed.
+     */
+    template <class BatchGrid, class GridIn, class GridOut>
+    void fft_lines(
+            complex_field_type<IdxRange<BatchGrid, GridOut>> out,
+            complex_field_type<IdxRange<BatchGrid, GridIn>> in) const
+    {
+        if (is_power_of_two(ddc::select<GridIn>(get_idx_range(in)).size())) {
+            batched_radix2_fft(out, in, get_twiddles<GridIn>(), false);
+        } else {
+            ddc::for_each(ddc::select<BatchGrid>(get_idx_range(in)), [&](Idx<BatchGrid> ib) {
+                ddc::fft(ExecSpace(), out[ib], in[ib], ddc::kwArgs_fft {m_norm});
+            });
+        }
+    }
+
+    /**
+     * @brief Apply a backward 1D transform to each line of a field along its last dimension.
+     *
+     * @param[out] out The transformed field.
+     * @param[in] in The field to be transformed.
+     */
+    template <class BatchGrid, class GridIn, class GridOut>
+    void ifft_lines(
+            complex_field_type<IdxRange<BatchGrid, GridOut>> out,
+            complex_field_type<IdxRange<BatchGrid, GridIn>> in) const
+    {
+        if (is_power_of_two(ddc::select<GridOut>(get_idx_range(out)).size())) {
+            batched_radix2_fft(out, in, get_twiddles<GridOut>(), true);
+        } else {
+            ddc::for_each(ddc::select<BatchGrid>(get_idx_range(in)), [&](Idx<BatchGrid> ib) {
+                ddc::ifft(ExecSpace(), out[ib], in[ib], ddc::kwArgs_fft {m_norm});
+            });
+        }
+    }
+
+    /**
+     * @brief Get pointers to the data of a real field and of its slab which can be passed to MPI.
+     *
+     * If MPI cannot access the memory space, the field is copied to the host buffers.
+     *
+     * @param[in] copy_full True if the full field must be copied to the host.
+     * @param[in] copy_slab True if the slab must be copied to the host.
+     *
+     * @return The pointers to the full field and to the slab.
+     */
+    std::pair<double*, double*> get_mpi_buffers(
+            [[maybe_unused]] bool copy_full,
+            [[maybe_unused]] bool copy_slab) const
+    {
+        if constexpr (s_mpi_on_memory_space) {
+            ExecSpace().fence();
+            return {m_real.data_handle(), m_real_slab.data_handle()};
+        } else {
+            if (copy_full) {
+                ddc::parallel_deepcopy(get_field(m_real_host), get_const_field(m_real));
+            }
+            if (copy_slab) {
+                ddc::parallel_deepcopy(
+                        get_field(m_real_slab_host),
+                        get_const_field(m_real_slab));
+            }
+            return {m_real_host.data_handle(), m_real_slab_host.data_handle()};
+        }
+    }
+
+    /**
+     * @brief Distribute the right-hand side in slabs along the first dimension.
+     *
+     * @param[out] rho_slab The slab of the right-hand side owned by this process.
+     * @param[in] rho The right-hand side (or the contribution of this process to it).
+     */
+    template <class Layout>
+    void scatter_rho(
+            complex_field_type<slab_idx_range_type> rho_slab,
+            DField<laplacian_idx_range_type, Layout, memory_space> rho) const
+    {
+        ddc::parallel_deepcopy(ExecSpace(), get_field(m_real), rho);
+        if (m_rho_distribution == RhoDistribution::Replicated) {
+            ddc::parallel_deepcopy(
+                    ExecSpace(),
+                    get_field(m_real_slab),
+                    get_const_field(m_real)[m_slab_idx_range]);
+        } else {
+            auto [rho_data, rho_slab_data] = get_mpi_buffers(true, false);
+            // The slabs are contiguous and ordered by rank so they can be scattered directly
+            MPI_Reduce_scatter_block(
+                    rho_data,
+                    rho_slab_data,
+                    m_real_slab.size(),
+                    MPI_DOUBLE,
+                    MPI_SUM,
+                    m_comm);
+            if constexpr (!s_mpi_on_memory_space) {
+                ddc::parallel_deepcopy(
+                        ExecSpace(),
+                        get_field(m_real_slab),
+                        get_const_field(m_real_slab_host));
+            }
+        }
+        copy_to_complex(rho_slab, get_const_field(m_real_slab));
+    }
+
+    /**
+     * @brief Transform a field from Fourier space back to real space and gather it on all
+     * processes.
+     *
+     * @param[out] result The field in real space.
+     * @param[in] values The values of the field in Fourier space. They are overwritten.
+     */
+    template <class Layout>
+    void invert_and_gather(
+            DField<laplacian_idx_range_type, Layout, memory_space> result,
+            complex_field_type<fourier_idx_range_type> values) const
+    {
+        ifft_lines(get_field(m_pencil), values);
+        m_transpose(ExecSpace(), get_field(m_mixed_slab), get_const_field(m_pencil));
+        ifft_lines(get_field(m_slab), get_field(m_mixed_slab));
+        copy_real_part(get_field(m_real_slab), get_const_field(m_slab));
+
+        auto [result_data, result_slab_data] = get_mpi_buffers(false, true);
+        MPI_Allgather(
+                result_slab_data,
+                m_real_slab.size(),
+                MPI_DOUBLE,
+                result_data,
+                m_real_slab.size(),
+                MPI_DOUBLE,
+                m_comm);
+        if constexpr (!s_mpi_on_memory_space) {
+            ddc::parallel_deepcopy(ExecSpace(), get_field(m_real), get_const_field(m_real_host));
+        }
+        ddc::parallel_deepcopy(ExecSpace(), result, get_const_field(m_real));
+    }
+
+    /**
+     * @brief Compute the solution of the equation in Fourier space from one right-hand side.
+     *
+     * @param[out] phi_fourier The solution in Fourier space on the pencil owned by this process.
+     * @param[in] rho The right-hand side (or the contribution of this process to it).
+     */
+    template <class Layout>
+    void solve_in_fourier_space(
+            complex_field_type<fourier_idx_range_type> phi_fourier,
+            DField<laplacian_idx_range_type, Layout, memory_space> rho) const
+    {
+        scatter_rho(get_field(m_slab), rho);
+        fft_lines(get_field(m_mixed_slab), get_field(m_slab));
+        m_transpose(ExecSpace(), get_field(m_pencil), get_const_field(m_mixed_slab));
+        fft_lines(phi_fourier, get_field(m_pencil));
+        solve_poisson_equation(phi_fourier);
+    }
+
+public:
+    /**
+     * @brief Apply a 1D radix-2 transform to each line of a field along its last dimension.
+     * All the lines are transformed by a single kernel. The number of points along the last
+     * dimension must be a power of two. The backward transform is normalised by the number of
+     * points (as with ddc::FFT_Normalization::BACKWARD).
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[out] out The transformed field. It must not overlap with in.
+     * @param[in] in The field to be transformed.
+     * @param[in] twiddles The factors exp(-2 i pi j / n) for j in [0, n/2).
+     * @param[in] backward True for the backward transform, false for the forward transform.
+     */
+    template <class BatchGrid, class GridIn, class GridOut, class GridTwiddle>
+    void batched_radix2_fft(
+            complex_field_type<IdxRange<BatchGrid, GridOut>> out,
+            complex_field_type<IdxRange<BatchGrid, GridIn>> in,
+            ConstField<Kokkos::complex<double>,
+                       IdxRange<GridTwiddle>,
+                       std::experimental::layout_right,
+                       memory_space> twiddles,
+            bool const backward) const
+    {
+        Idx<GridIn> const in_front = ddc::select<GridIn>(get_idx_range(in)).front();
+        Idx<GridOut> const out_front = ddc::select<GridOut>(get_idx_range(out)).front();
+        Idx<GridTwiddle> const twiddle_front = get_idx_range(twiddles).front();
+        int const n = ddc::select<GridIn>(get_idx_range(in)).size();
+        int log2_n = 0;
+        while ((1 << log2_n) < n) {
+            ++log2_n;
+        }
+        double const scale = backward ? 1. / n : 1.;
+        ddc::parallel_for_each(
+                ExecSpace(),
+                ddc::select<BatchGrid>(get_idx_range(in)),
+                KOKKOS_LAMBDA(Idx<BatchGrid> const ib) {
+                    // Copy the line in bit-reversed order
+                    for (int j = 0; j < n; ++j) {
+                        int j_reversed = 0;
+                        for (int bit = 0; bit < log2_n; ++bit) {
+                            j_reversed |= ((j >> bit) & 1) << (log2_n - 1 - bit);
+                        }
+                        out(ib, out_front + IdxStep<GridOut>(j_reversed))
+                                = in(ib, in_front + IdxStep<GridIn>(j));
+                    }
+                    // Combine the transforms of length half into transforms of length 2*half
+                    for (int half = 1; half < n; half *= 2) {
+                        int const stride = n / (2 * half);
+                        for (int start = 0; start < n; start += 2 * half) {
+                            for (int j = 0; j < half; ++j) {
+                                Kokkos::complex<double> twiddle = twiddles(
+                                        twiddle_front + IdxStep<GridTwiddle>(j * stride));
+                                if (backward) {
+                                    twiddle = Kokkos::conj(twiddle);
+                                }
+                                Idx<GridOut> const i0 = out_front + IdxStep<GridOut>(start + j);
+                                Idx<GridOut> const i1 = i0 + IdxStep<GridOut>(half);
+                                Kokkos::complex<double> const u = out(ib, i0);
+                                Kokkos::complex<double> const v = twiddle * out(ib, i1);
+                                out(ib, i0) = u + v;
+                                out(ib, i1) = u - v;
+                            }
+                        }
+                    }
+                    if (backward) {
+                        for (int j = 0; j < n; ++j) {
+                            out(ib, out_front + IdxStep<GridOut>(j)) *= scale;
+                        }
+                    }
+                });
+    }
+
+    /**
+     * @brief Compute the twiddle factors of the radix-2 transforms along a dimension.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[out] twiddles The factors exp(-2 i pi j / n) for j in [0, n/2).
+     * @param[in] n The number of points along the dimension.
+     */
+    template <class GridPDE>
+    void compute_twiddles(complex_field_type<IdxRange<GridPDE>> twiddles, int const n) const
+    {
+        Idx<GridPDE> const front = get_idx_range(twiddles).front();
+        ddc::parallel_for_each(
+                ExecSpace(),
+                get_idx_range(twiddles),
+                KOKKOS_LAMBDA(Idx<GridPDE> const idx) {
+                    double const angle = -2. * M_PI * (idx - front).value() / n;
+                    twiddles(idx) = Kokkos::complex<double>(Kokkos::cos(angle), Kokkos::sin(angle));
+                });
+    }
+
+    /**
+     * @brief Copy a real field into a complex field.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[out] out The complex field.
+     * @param[in] in The real field.
+     */
+    void copy_to_complex(
+            complex_field_type<slab_idx_range_type> out,
+            DConstField<slab_idx_range_type, std::experimental::layout_right, memory_space> in)
+            const
+    {
+        ddc::parallel_for_each(
+                ExecSpace(),
+                get_idx_range(out),
+                KOKKOS_LAMBDA(Idx<GridPDEDim1, GridPDEDim2> const idx) {
+                    out(idx) = Kokkos::complex<double>(in(idx), 0.);
+                });
+    }
+
+    /**
+     * @brief Copy the real part of a complex field into a real field.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[out] out The real field.
+     * @param[in] in The complex field.
+     */
+    void copy_real_part(
+            DField<slab_idx_range_type, std::experimental::layout_right, memory_space> out,
+            ConstField<
+                    Kokkos::complex<double>,
+                    slab_idx_range_type,
+                    std::experimental::layout_right,
+                    memory_space> in) const
+    {
+        ddc::parallel_for_each(
+                ExecSpace(),
+                get_idx_range(out),
+                KOKKOS_LAMBDA(Idx<GridPDEDim1, GridPDEDim2> const idx) {
+                    out(idx) = in(idx).real();
+                });
+    }
+
+    /**
+     * @brief Divide the Fourier transform of the right-hand side by the Fourier representation
+     * of the Laplace operator.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[inout] values On input the right-hand side in Fourier space. On output the
+     *                      solution in Fourier space.
+     */
+    void solve_poisson_equation(complex_field_type<fourier_idx_range_type> values) const
+    {
+        Idx<GridFourier1> const zero_mode_1 = m_zero_mode_1;
+        Idx<GridFourier2> const zero_mode_2 = m_zero_mode_2;
+        ddc::parallel_for_each(
+                ExecSpace(),
+                get_idx_range(values),
+                KOKKOS_LAMBDA(fourier_index_type const ik) {
+                    Idx<GridFourier1> const ik1 = ddc::select<GridFourier1>(ik);
+                    Idx<GridFourier2> const ik2 = ddc::select<GridFourier2>(ik);
+                    if (ik1 != zero_mode_1 || ik2 != zero_mode_2) {
+                        double const k1 = ddc::coordinate(ik1);
+                        double const k2 = ddc::coordinate(ik2);
+                        values(ik) = values(ik) / (k1 * k1 + k2 * k2);
+                    } else {
+                        values(ik) = 0.;
+                    }
+                });
+    }
+
+    /**
+     * @brief Differentiate and multiply by -1 an expression in Fourier space by multiplying by -i * k
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param derivative The Field where the derivative will be saved.
+     * @param values The Field containing the values of the function in Fourier space.
+     *
+     * @tparam GridFFT The Fourier dimension along which the expression is differentiated.
+     */
+    template <class GridFFT>
+    void negative_differentiate_equation(
+            complex_field_type<fourier_idx_range_type> derivative,
+            complex_field_type<fourier_idx_range_type> values) const
+    {
+        Kokkos::complex<double> imaginary_unit(0.0, 1.0);
+        ddc::parallel_for_each(
+                ExecSpace(),
+                get_idx_range(values),
+                KOKKOS_LAMBDA(fourier_index_type const ik) {
+                    Idx<GridFFT> const ikx = ddc::select<GridFFT>(ik);
+                    derivative(ik) = -imaginary_unit * ddc::coordinate(ikx) * values(ik);
+                });
+    }
+
+public:
+    /**
+     * @brief A constructor for the distributed FFT Poisson solver.
+     * This constructor calls ddc::init_discrete_space so it should only be called once per
+     * simulation. It is collective on the communicator.
+     *
+     * @param laplacian_idx_range The global index range on which the equation should be solved.
+     * @param comm The communicator containing the processes which share the work.
+     * @param rho_distribution Indicates how the right-hand side is distributed over the processes.
+     */
+    DistributedFFTPoissonSolver(
+            laplacian_idx_range_type laplacian_idx_range,
+            MPI_Comm comm,
+            RhoDistribution rho_distribution = RhoDistribution::Replicated)
+        : m_comm(check_distribution(laplacian_idx_range, comm))
+        , m_rho_distribution(rho_distribution)
+        , m_transpose(
+                  init_mixed_idx_range(
+                          laplacian_idx_range,
+                          init_fourier_space(ddc::select<GridPDEDim2>(laplacian_idx_range))),
+                  comm)
+        , m_idx_range(laplacian_idx_range)
+    {
+        IdxRange<GridFourier1> const k_mesh_1
+                = init_fourier_space(ddc::select<GridPDEDim1>(laplacian_idx_range));
+        IdxRange<GridFourier2> const k_mesh_2 = ddc::FourierMesh<
+                GridFourier2>(ddc::select<GridPDEDim2>(laplacian_idx_range), true);
+        m_zero_mode_1 = k_mesh_1.front();
+        m_zero_mode_2 = k_mesh_2.front();
+
+        m_mixed_slab_idx_range = m_transpose.template get_local_idx_range<SlabLayout>();
+        m_pencil_idx_range = m_transpose.template get_local_idx_range<PencilLayout>();
+        m_slab_idx_range = slab_idx_range_type(
+                ddc::select<GridPDEDim1>(m_mixed_slab_idx_range),
+                ddc::select<GridPDEDim2>(laplacian_idx_range));
+        m_fourier_idx_range = fourier_idx_range_type(
+                ddc::select<GridFourier2>(m_pencil_idx_range),
+                k_mesh_1);
+
+        IdxRange<GridPDEDim1> const idx_range_1 = ddc::select<GridPDEDim1>(laplacian_idx_range);
+        IdxRange<GridPDEDim2> const idx_range_2 = ddc::select<GridPDEDim2>(laplacian_idx_range);
+        m_twiddles_1 = complex_field_mem_type<IdxRange<GridPDEDim1>>(
+                IdxRange<GridPDEDim1>(
+                        idx_range_1.front(),
+                        IdxStep<GridPDEDim1>(idx_range_1.size() / 2)));
+        m_twiddles_2 = complex_field_mem_type<IdxRange<GridPDEDim2>>(
+                IdxRange<GridPDEDim2>(
+                        idx_range_2.front(),
+                        IdxStep<GridPDEDim2>(idx_range_2.size() / 2)));
+        compute_twiddles(get_field(m_twiddles_1), idx_range_1.size());
+        compute_twiddles(get_field(m_twiddles_2), idx_range_2.size());
+
+        m_slab = complex_field_mem_type<slab_idx_range_type>(m_slab_idx_range);
+        m_mixed_slab = complex_field_mem_type<mixed_slab_idx_range_type>(m_mixed_slab_idx_range);
+        m_pencil = complex_field_mem_type<pencil_idx_range_type>(m_pencil_idx_range);
+        m_phi_fourier = complex_field_mem_type<fourier_idx_range_type>(m_fourier_idx_range);
+        m_efield_fourier = complex_field_mem_type<fourier_idx_range_type>(m_fourier_idx_range);
+        m_real = double_field_mem_type(m_idx_range);
+        m_real_slab = double_field_mem_type(m_slab_idx_range);
+        if constexpr (!s_mpi_on_memory_space) {
+            m_real_host = double_host_field_mem_type(m_idx_range);
+            m_real_slab_host = double_host_field_mem_type(m_slab_idx_range);
+        }
+    }
+
+    /**
+     * @brief An operator which calculates the solution @f$\phi@f$ to Poisson's equation:
+     * @f$ - \Delta \phi = \rho @f$
+     * This operator is collective on the communicator.
+     *
+     * @param[out] phi The solution to Poisson's equation (on the full index range).
+     * @param[in] rho The right-hand side of Poisson's equation (or the contribution of this
+     *                process to it).
+     *
+     * @return A reference to the solution to Poisson's equation.
+     */
+    virtual field_type operator()(field_type phi, field_type rho) const final
+    {
+        Kokkos::Profiling::pushRegion("DistributedFFTPoissonSolver");
+
+        batch_idx_range_type batch_idx_range(get_idx_range(phi));
+
+        complex_field_type<fourier_idx_range_type> phi_fourier = get_field(m_phi_fourier);
+
+        ddc::for_each(batch_idx_range, [&](batch_index_type ib) {
+            solve_in_fourier_space(phi_fourier, rho[ib]);
+            invert_and_gather(phi[ib], phi_fourier);
+        });
+
+        Kokkos::Profiling::popRegion();
+        return phi;
+    }
+
+    /**
+     * @brief An operator which calculates the solution @f$\phi@f$ to Poisson's equation and
+     * its derivative:
+     * @f$ - \Delta \phi = \rho @f$
+     * @f$ E = - \nabla \phi @f$
+     * This operator is collective on the communicator.
+     *
+     * @param[out] phi The solution to Poisson's equation (on the full index range).
+     * @param[out] E The derivative of the solution to Poisson's equation (on the full index range).
+     * @param[in] rho The right-hand side of Poisson's equation (or the contribution of this
+     *                process to it).
+     *
+     * @return A reference to the solution to Poisson's equation.
+     */
+    virtual field_type operator()(field_type phi, vector_field_type E, field_type rho) const final
+    {
+        Kokkos::Profiling::pushRegion("DistributedFFTPoissonSolver");
+
+        batch_idx_range_type batch_idx_range(get_idx_range(phi));
+
+        complex_field_type<fourier_idx_range_type> phi_fourier = get_field(m_phi_fourier);
+        complex_field_type<fourier_idx_range_type> fourier_efield = get_field(m_efield_fourier);
+
+        ddc::for_each(batch_idx_range, [&](batch_index_type ib) {
+            solve_in_fourier_space(phi_fourier, rho[ib]);
+
+            negative_differentiate_equation<GridFourier1>(fourier_efield, phi_fourier);
+            invert_and_gather(ddcHelper::get<Dim1>(E[ib]), fourier_efield);
+            negative_differentiate_equation<GridFourier2>(fourier_efield, phi_fourier);
+            invert_and_gather(ddcHelper::get<Dim2>(E[ib]), fourier_efield);
+
+            invert_and_gather(phi[ib], phi_fourier);
+        });
+
+        Kokkos::Profiling::popRegion();
+        return phi;
+    }
+};
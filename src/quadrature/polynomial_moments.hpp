@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <array>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
+#include "quadrature.hpp"
+
+/**
+ * @brief A class providing an operator which calculates several polynomial moments of a function
+ * in a single pass over the data.
+ *
+ * The k-th moment of a function f is defined as:
+ * @f$ M_k = \int f(x) \prod_d x_d^{p_{k,d}} dx @f$
+ * where @f$ p_{k,d} @f$ is the exponent of the coordinate in the d-th dimension of the quadrature.
+ * For example, on a (vpar, mu) velocity space the exponents {{0, 0}, {1, 0}, {2, 0}, {0, 1}}
+ * describe the moments @f$ \int f @f$, @f$ \int v_\parallel f @f$, @f$ \int v_\parallel^2 f @f$
+ * and @f$ \int \mu f @f$ from which the density, the parallel flow and the temperature can be
+ * deduced.
+ *
+ * The moments are calculated with the batched Quadrature operator which integrates several
+ * values in a single pass. The integrand is the function weighted by the monomial of each moment,
+ * so all the moments of one batch element are computed by the same Kokkos team and the function
+ * is only evaluated once per point.
+ *
+ * @tparam IdxRangeQuadrature The index range over which the function is integrated.
+ * @tparam IdxRangeTotal The index range of the functions which can be passed to the operator().
+ *                      This is the IdxRangeQuadrature combined with the batch dimensions.
+ * @tparam NMoments The number of moments calculated by the operator.
+ * @tparam MemorySpace The memory space (cpu/gpu) where the quadrature coefficients are saved.
+ */
+template <
+        class IdxRangeQuadrature,
+        class IdxRangeTotal,
+        std::size_t NMoments,
+        class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+class PolynomialMoments
+{
+public:
+    /// The number of dimensions of the index range over which the function is integrated.
+    static constexpr std::size_t quadrature_rank = IdxRangeQuadrature::rank();
+
+    /// The type describing the exponents of the monomial associated with each moment.
+    using Exponents = Kokkos::Array<Kokkos::Array<int, quadrature_rank>, NMoments>;
+
+private:
+    using IdxQuadrature = typename IdxRangeQuadrature::discrete_element_type;
+
+    using QuadConstField
+            = DConstField<IdxRangeQuadrature, std::experimental::layout_right, MemorySpace>;
+
+    Quadrature<IdxRangeQuadrature, IdxRangeTotal, MemorySpace> m_quadrature;
+
+    Exponents m_exponents;
+
+public:
+    /**
+     * @brief Create a PolynomialMoments object.
+     * @param[in] coeffs
+     *      The coefficients of the quadrature used to calculate the moments.
+     * @param[in] exponents
+     *      The exponents of the coordinates in each dimension of the quadrature for each moment.
+     */
+    PolynomialMoments(QuadConstField coeffs, Exponents const& exponents)
+        : m_quadrature(coeffs)
+        , m_exponents(exponents)
+    {
+    }
+
+    /**
+     * @brief Calculate the moments of a function by cycling over the batch dimensions.
+     *
+     * @param[in] exec_space
+     *        The space on which the function is executed (CPU/GPU).
+     * @param[out] results
+     *        The moments. The k-th field contains the moment described by the k-th exponents.
+     * @param[in] integrated_function
+     *        A function taking an index of a position in the total index range and returning
+     *        the value of the function whose moments are calculated. Any Jacobian should be
+     *        included in this function.
+     *        Please note that a Field fulfils the described criteria.
+     *        If the exec_space is a GPU the function that is passed must be accessible from GPU.
+     */
+    template <class ExecutionSpace, class BatchIdxRange, class IntegratorFunction>
+    void operator()(
+            ExecutionSpace exec_space,
+            std::array<
+                    Field<double, BatchIdxRange, std::experimental::layout_right, MemorySpace>,
+                    NMoments> const& results,
+            IntegratorFunction integrated_function) const
+    {
+        using IdxTotal = typename IdxRangeTotal::discrete_element_type;
+
+        static_assert(
+                std::is_invocable_v<IntegratorFunction, IdxTotal>,
+                "The object passed to PolynomialMoments::operator() is not defined on the total "
+                "idx_range.");
+
+        Exponents const exponents = m_exponents;
+        m_quadrature(
+                exec_space,
+                results,
+                KOKKOS_LAMBDA(IdxTotal const it) {
+                    IdxQuadrature const iq(it);
+                    double const f = integrated_function(it);
+                    Kokkos::Array<double, NMoments> weighted_f;
+                    for (std::size_t k(0); k < NMoments; ++k) {
+                        weighted_f[k] = f * monomial(iq, exponents[k]);
+                    }
+                    return weighted_f;
+                });
+    }
+
+private:
+    /**
+     * Calculate x^n for a small non-negative integer n.
+     *
+     * @param[in] x The value to be raised to a power.
+     * @param[in] n The power.
+     *
+     * @return x^n.
+     */
+    KOKKOS_FUNCTION static double integer_power(double x, int n)
+    {
+        double res = 1.0;
+        for (int i(0); i < n; ++i) {
+            res *= x;
+        }
+        return res;
+    }
+
+    /**
+     * Evaluate the monomial associated with a set of exponents at a point of the quadrature
+     * index range.
+     *
+     * @param[in] iq The index of the point.
+     * @param[in] exponents The exponents of the coordinate in each dimension.
+     *
+     * @return The value of the monomial.
+     */
+    template <class... QuadGrid>
+    KOKKOS_FUNCTION static double monomial(
+            Idx<QuadGrid...> iq,
+            Kokkos::Array<int, quadrature_rank> const& exponents)
+    {
+        return (integer_power(
+                        ddc::coordinate(ddc::select<QuadGrid>(iq)),
+                        exponents[ddc::type_seq_rank_v<
+                                QuadGrid,
+                                ddc::to_type_seq_t<IdxRangeQuadrature>>])
+                * ...);
+    }
+};
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <array>
 #include <cassert>
 
 #include <ddc/ddc.hpp>
@@ -10,6 +11,56 @@
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
 #include "ddc_helper.hpp"
+#include "idx_range_utils.hpp"
+
+namespace detail {
+/**
+ * @brief A fixed-size set of partial sums which can be used as the value type of a Kokkos
+ * sum reduction. This allows several integrals to be accumulated in a single pass.
+ *
+ * @tparam NValues The number of values which are accumulated.
+ */
+template <std::size_t NValues>
+struct IntegralsAccumulator
+{
+    /// The partial sums.
+    double values[NValues];
+
+    /// Create an accumulator whose partial sums are all equal to 0.
+    KOKKOS_FUNCTION IntegralsAccumulator()
+    {
+        for (std::size_t i(0); i < NValues; ++i) {
+            values[i] = 0.0;
+        }
+    }
+
+    /**
+     * @brief Add the partial sums of another accumulator to this one.
+     * @param[in] other The accumulator to be added.
+     * @returns A reference to this accumulator.
+     */
+    KOKKOS_FUNCTION IntegralsAccumulator& operator+=(IntegralsAccumulator const& other)
+    {
+        for (std::size_t i(0); i < NValues; ++i) {
+            values[i] += other.values[i];
+        }
+        return *this;
+    }
+};
+} // namespace detail
+
+namespace Kokkos {
+/// Specialisation of the reduction identity required to sum IntegralsAccumulator objects.
+template <std::size_t NValues>
+struct reduction_identity<detail::IntegralsAccumulator<NValues>>
+{
+    /// The identity of the sum.
+    KOKKOS_FORCEINLINE_FUNCTION static detail::IntegralsAccumulator<NValues> sum()
+    {
+        return detail::IntegralsAccumulator<NValues>();
+    }
+};
+} // namespace Kokkos
 
 /**
  * @brief A class providing an operator for integrating functions defined on a discrete index range.
@@ -149,15 +200,16 @@ public:
                 Kokkos::TeamPolicy<>(exec_space, batch_idx_range.size(), Kokkos::AUTO),
                 KOKKOS_LAMBDA(const Kokkos::TeamPolicy<>::member_type& team) {
                     const int idx = team.league_rank();
-                    IdxBatch ib = to_discrete_element(idx, batch_idx_range);
+                    IdxBatch ib = ddcHelper::to_discrete_element(idx, batch_idx_range);
 
                     // Sum over quadrature dimensions
                     double teamSum = 0;
                     Kokkos::parallel_reduce(
                             Kokkos::TeamThreadRange(team, quad_idx_range.size()),
                             [&](int const& thread_index, double& sum) {
-                                IdxQuadrature iq
-                                        = to_discrete_element(thread_index, quad_idx_range);
+                                IdxQuadrature iq = ddcHelper::to_discrete_element(
+                                        thread_index,
+                                        quad_idx_range);
                                 IdxTotal it(ib, iq);
                                 sum += coeff_proxy(iq) * integrated_function(it);
                             },
@@ -166,30 +218,101 @@ public:
                 });
     }
 
-private:
     /**
-     * A function which converts an integer into an index found in an index range
-     * starting from the front. This is useful for iterating over an index range using Kokkos
-     * loops.
+     * @brief An operator for calculating the integrals of several functions defined on a discrete
+     * index range by cycling over batch dimensions.
      *
-     * @param[in] idx The index of the requested element.
-     * @param[in] idx_range The index range being iterated over.
+     * All the integrals of one batch element are calculated by the same Kokkos team in a single
+     * pass over the quadrature index range.
      *
-     * @return The vector displacement from the front of the index range
+     * @param[in] exec_space
+     *        The space on which the function is executed (CPU/GPU).
+     * @param[out] results
+     *        The results of the quadrature calculation. The k-th field contains the integral of
+     *        the k-th value returned by the integrated function.
+     * @param[in] integrated_function
+     *        A function taking an index of a position in the total index range (including the
+     *        batch index range) and returning a Kokkos::Array containing the values of the
+     *        NValues functions to be integrated at that point.
+     *        If the exec_space is a GPU the function that is passed must be accessible from GPU.
      */
-    template <class HeadDim, class... Grid1D>
-    KOKKOS_FUNCTION static Idx<HeadDim, Grid1D...> to_discrete_element(
-            int idx,
-            IdxRange<HeadDim, Grid1D...> idx_range)
+    template <
+            class ExecutionSpace,
+            class BatchIdxRange,
+            std::size_t NValues,
+            class IntegratorFunction>
+    void operator()(
+            ExecutionSpace exec_space,
+            std::array<
+                    Field<double, BatchIdxRange, std::experimental::layout_right, MemorySpace>,
+                    NValues> const& results,
+            IntegratorFunction integrated_function) const
     {
-        IdxRange<Grid1D...> subidx_range(idx_range);
-        Idx<HeadDim> head_idx(ddc::select<HeadDim>(idx_range).front() + idx / subidx_range.size());
-        if constexpr (sizeof...(Grid1D) == 0) {
-            return head_idx;
-        } else {
-            Idx<Grid1D...> tail_idx = to_discrete_element(idx % subidx_range.size(), subidx_range);
-            return Idx<HeadDim, Grid1D...>(head_idx, tail_idx);
+        static_assert(
+                Kokkos::SpaceAccessibility<ExecutionSpace, MemorySpace>::accessible,
+                "Execution space is not compatible with memory space where coefficients are found");
+        static_assert(
+                std::is_same_v<ExecutionSpace, Kokkos::DefaultExecutionSpace>,
+                "Kokkos::TeamPolicy only works with the default execution space. Please use "
+                "DefaultExecutionSpace to call this batched operator.");
+        using ExpectedBatchDims = ddc::type_seq_remove_t<
+                ddc::to_type_seq_t<IdxRangeTotal>,
+                ddc::to_type_seq_t<IdxRangeQuadrature>>;
+        static_assert(
+                ddc::type_seq_same_v<ddc::to_type_seq_t<BatchIdxRange>, ExpectedBatchDims>,
+                "The batch idx_range deduced from the type of results does not match the class "
+                "template parameters.");
+
+        // Get useful index types
+        using IdxTotal = typename IdxRangeTotal::discrete_element_type;
+        using IdxBatch = typename BatchIdxRange::discrete_element_type;
+        using ResultField
+                = Field<double, BatchIdxRange, std::experimental::layout_right, MemorySpace>;
+        using Accumulator = detail::IntegralsAccumulator<NValues>;
+
+        static_assert(
+                std::is_invocable_r_v<Kokkos::Array<double, NValues>, IntegratorFunction, IdxTotal>,
+                "The object passed to Quadrature::operator() is not defined on the total "
+                "idx_range or does not return one value per result.");
+
+        // Get index ranges
+        IdxRangeQuadrature quad_idx_range(get_idx_range(m_coefficients));
+        BatchIdxRange batch_idx_range(get_idx_range(results[0]));
+        for (std::size_t k(1); k < NValues; ++k) {
+            assert(get_idx_range(results[k]) == batch_idx_range);
         }
+
+        QuadConstField const coeff_proxy = m_coefficients;
+        std::array<ResultField, NValues> const results_proxy = results;
+        // Loop over batch dimensions
+        Kokkos::parallel_for(
+                Kokkos::TeamPolicy<>(exec_space, batch_idx_range.size(), Kokkos::AUTO),
+                KOKKOS_LAMBDA(const Kokkos::TeamPolicy<>::member_type& team) {
+                    const int idx = team.league_rank();
+                    IdxBatch ib = ddcHelper::to_discrete_element(idx, batch_idx_range);
+
+                    // Sum over quadrature dimensions
+                    Accumulator team_sums;
+                    Kokkos::parallel_reduce(
+                            Kokkos::TeamThreadRange(team, quad_idx_range.size()),
+                            [&](int const& thread_index, Accumulator& sums) {
+                                IdxQuadrature iq = ddcHelper::to_discrete_element(
+                                        thread_index,
+                                        quad_idx_range);
+                                IdxTotal it(ib, iq);
+                                Kokkos::Array<double, NValues> const values
+                                        = integrated_function(it);
+                                for (std::size_t k(0); k < NValues; ++k) {
+                                    sums.values[k] += coeff_proxy(iq) * values[k];
+                                }
+                            },
+                            Kokkos::Sum<Accumulator>(team_sums));
+                    Kokkos::single(Kokkos::PerTeam(team), [&]() {
+                        for (std::size_t k(0); k < NValues; ++k) {
+                            results_proxy[k](ib) = team_sums.values[k];
+                        }
+                    });
+                });
     }
 };
 
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "species_count_dispatch.hpp"
+#include "species_info.hpp"
+
+namespace detail {
+/**
+ * @brief Compute the charge density of the kinetic species with double precision accumulation
+ * whatever the precision used to store the distribution function.
+ *
+ * If the number of species is known at compile time the loop over the species is unrolled and
+ * the charges are captured by value. Otherwise the charges are read from kinetic_charges.
+ *
+ * @tparam NSpecies The number of kinetic species or dynamic_species_count.
+ * @param[in] quadrature The batched quadrature over the velocity.
+ * @param[out] rho The charge density.
+ * @param[in] allfdistribu The distribution function of the kinetic species.
+ * @param[in] kinetic_charges_host The charges of the kinetic species on the host.
+ * @param[in] kinetic_charges The charges of the kinetic species on the device. It is only used
+ *                  if NSpecies is dynamic_species_count.
+ */
+template <
+        std::size_t NSpecies,
+        class QuadratureOperator,
+        class IdxRangeRho,
+        class ElementType,
+        class IdxRangeFdistribu>
+void compute_kinetic_charge_density(
+        QuadratureOperator const& quadrature,
+        DField<IdxRangeRho> const rho,
+        ConstField<ElementType, IdxRangeFdistribu> const allfdistribu,
+        host_t<DConstFieldSp> const kinetic_charges_host,
+        DConstFieldSp const kinetic_charges)
+{
+    using IdxQuadratureTotal =
+            typename ddc::remove_dims_of_t<IdxRangeFdistribu, Species>::discrete_element_type;
+
+    if constexpr (NSpecies == dynamic_species_count) {
+        quadrature(
+                Kokkos::DefaultExecutionSpace(),
+                rho,
+                KOKKOS_LAMBDA(IdxQuadratureTotal const idx) {
+                    double sum = 0.0;
+                    for (IdxSp const isp : get_idx_range(kinetic_charges)) {
+                        sum += kinetic_charges(isp) * allfdistribu(isp, idx);
+                    }
+                    return sum;
+                });
+    } else {
+        Kokkos::Array<double, NSpecies> const kinetic_charges_array
+                = get_static_species_attribute<NSpecies>(kinetic_charges_host);
+        IdxSp const first_species = get_idx_range(kinetic_charges_host).front();
+
+        quadrature(
+                Kokkos::DefaultExecutionSpace(),
+                rho,
+                KOKKOS_LAMBDA(IdxQuadratureTotal const idx) {
+                    double sum = 0.0;
+                    for (std::size_t i(0); i < NSpecies; ++i) {
+                        sum += kinetic_charges_array[i] * allfdistribu(first_species + i, idx);
+                    }
+                    return sum;
+                });
+    }
+}
+} // namespace detail
+
+/**
+ * @brief Compute the charge density of all the species.
+ *
+ * The charge density of the kinetic species is obtained by integrating the distribution function
+ * over the velocity with a batched quadrature. The kernel is specialised for the number of
+ * kinetic species (see dispatch_species_count). If the last species is adiabatic its charge is
+ * added to the result.
+ *
+ * @param[in] quadrature The batched quadrature over the velocity. It is called with the default
+ *                  execution space, the charge density and a function defined on the index
+ *                  range of the distribution function without the species.
+ * @param[out] rho The charge density.
+ * @param[in] allfdistribu The distribution function of the kinetic species.
+ * @param[in] charges The charges of all the species on the device. They are only read if there
+ *                  are more than max_static_species_count kinetic species. If this field is
+ *                  empty the charges are then copied to the device at each call.
+ */
+template <class QuadratureOperator, class IdxRangeRho, class ElementType, class IdxRangeFdistribu>
+void compute_charge_density(
+        QuadratureOperator const& quadrature,
+        DField<IdxRangeRho> const rho,
+        ConstField<ElementType, IdxRangeFdistribu> const allfdistribu,
+        DConstFieldSp const charges = DConstFieldSp())
+{
+    host_t<DConstFieldSp> const charges_host = ddc::host_discrete_space<Species>().charges();
+    IdxRangeSp const kin_species_idx_range = get_idx_range<Species>(allfdistribu);
+    host_t<DConstFieldSp> const kinetic_charges_host = charges_host[kin_species_idx_range];
+
+    dispatch_species_count(kin_species_idx_range.size(), [&](auto n_species) {
+        constexpr std::size_t NSpecies = decltype(n_species)::value;
+        if constexpr (NSpecies == dynamic_species_count) {
+            if (get_idx_range(charges).empty()) {
+                auto kinetic_charges_alloc = ddc::create_mirror_view_and_copy(
+                        Kokkos::DefaultExecutionSpace(),
+                        kinetic_charges_host);
+                detail::compute_kinetic_charge_density<NSpecies>(
+                        quadrature,
+                        rho,
+                        allfdistribu,
+                        kinetic_charges_host,
+                        get_const_field(kinetic_charges_alloc));
+            } else {
+                detail::compute_kinetic_charge_density<NSpecies>(
+                        quadrature,
+                        rho,
+                        allfdistribu,
+                        kinetic_charges_host,
+                        charges[kin_species_idx_range]);
+            }
+        } else {
+            detail::compute_kinetic_charge_density<NSpecies>(
+                    quadrature,
+                    rho,
+                    allfdistribu,
+                    kinetic_charges_host,
+                    charges);
+        }
+    });
+
+    IdxSp const last_kin_species = kin_species_idx_range.back();
+    IdxSp const last_species = get_idx_range(charges_host).back();
+    if (last_kin_species != last_species) {
+        using IdxRho = typename IdxRangeRho::discrete_element_type;
+        double const chargedens_adiabspecies = charges_host(last_species);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                get_idx_range(rho),
+                KOKKOS_LAMBDA(IdxRho const i) { rho(i) += chargedens_adiabspecies; });
+    }
+}
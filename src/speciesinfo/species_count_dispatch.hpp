@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_aliases.hpp"
+#include "species_info.hpp"
+
+/// The species count used to indicate that the number of species is only known at runtime.
+inline constexpr std::size_t dynamic_species_count = 0;
+
+/// The largest species count for which specialised kernels are instantiated.
+inline constexpr std::size_t max_static_species_count = 4;
+
+/**
+ * @brief A type carrying a number of species known at compile time.
+ *
+ * @tparam NSpecies The number of species or dynamic_species_count.
+ */
+template <std::size_t NSpecies>
+using SpeciesCount = std::integral_constant<std::size_t, NSpecies>;
+
+/**
+ * @brief Call a functor with a compile-time representation of a number of species.
+ *
+ * The functor is called with SpeciesCount<n_species> if n_species is between 1 and
+ * max_static_species_count. Otherwise it is called with SpeciesCount<dynamic_species_count>.
+ * This allows kernels to unroll their loops over the species and to keep the species
+ * attributes in registers for the most common simulations while still supporting any number
+ * of species.
+ *
+ * @param[in] n_species The number of species known at runtime.
+ * @param[in] functor A generic callable taking a SpeciesCount as argument.
+ */
+template <class Functor>
+void dispatch_species_count(std::size_t const n_species, Functor&& functor)
+{
+    static_assert(max_static_species_count == 4, "Please update the dispatch table.");
+    switch (n_species) {
+    case 1:
+        functor(SpeciesCount<1>());
+        break;
+    case 2:
+        functor(SpeciesCount<2>());
+        break;
+    case 3:
+        functor(SpeciesCount<3>());
+        break;
+    case 4:
+        functor(SpeciesCount<4>());
+        break;
+    default:
+        functor(SpeciesCount<dynamic_species_count>());
+        break;
+    }
+}
+
+/**
+ * @brief Copy a species attribute into a fixed-size array which can be captured by value in
+ * a kernel.
+ *
+ * @param[in] attribute The attribute (e.g. the charges) of the species, allocated on the host.
+ *
+ * @return An array whose i-th element is the attribute of the i-th species of the index range.
+ */
+template <std::size_t NSpecies>
+Kokkos::Array<double, NSpecies> get_static_species_attribute(host_t<DConstFieldSp> attribute)
+{
+    static_assert(NSpecies != dynamic_species_count);
+    IdxRangeSp const idx_range_sp = get_idx_range(attribute);
+    assert(idx_range_sp.size() == NSpecies);
+    Kokkos::Array<double, NSpecies> values;
+    for (std::size_t i(0); i < NSpecies; ++i) {
+        values[i] = attribute(idx_range_sp.front() + i);
+    }
+    return values;
+}
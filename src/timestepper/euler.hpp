@@ -7,6 +7,7 @@
 #include "ddc_helper.hpp"
 #include "itimestepper.hpp"
 #include "vector_field_common.hpp"
+#include "workspace_arena.hpp"
 
 /**
  * @brief A class which provides an implementation of an explicit Euler method.
@@ -46,6 +47,9 @@ private:
     using DerivFieldMem = typename DerivFieldMemType::span_type;
     using DerivConstField = typename DerivFieldMemType::view_type;
 
+    using DerivStageFieldMem = workspace_t<DerivFieldMemType>;
+    using DerivMemorySpace = typename DerivFieldMemType::memory_space;
+
     IdxRange const m_idx_range;
 
 public:
@@ -142,7 +146,9 @@ public:
             std::function<void(DerivFieldMem, ValConstField)> dy,
             std::function<void(ValField, DerivConstField, double)> y_update) const
     {
-        DerivFieldMemType m_k1(m_idx_range);
+        typename WorkspaceArena<DerivMemorySpace>::Scope const workspace_scope(
+                get_workspace_arena<DerivMemorySpace>());
+        DerivStageFieldMem m_k1(m_idx_range);
 
         // --------- Calculate k1 ------------
         // Calculate k1 = f(y_n)
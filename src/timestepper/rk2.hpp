@@ -8,6 +8,7 @@
 #include "ddc_helper.hpp"
 #include "itimestepper.hpp"
 #include "vector_field_common.hpp"
+#include "workspace_arena.hpp"
 
 /**
  * @brief A class which provides an implementation of a second-order Runge-Kutta method.
@@ -50,6 +51,11 @@ private:
     using DerivFieldMem = typename DerivFieldMemType::span_type;
     using DerivConstField = typename DerivFieldMemType::view_type;
 
+    using StageFieldMem = workspace_t<FieldMemType>;
+    using DerivStageFieldMem = workspace_t<DerivFieldMemType>;
+    using MemorySpace = typename FieldMemType::memory_space;
+    using DerivMemorySpace = typename DerivFieldMemType::memory_space;
+
 
     IdxRange const m_idx_range;
 
@@ -147,9 +153,13 @@ public:
             std::function<void(DerivFieldMem, ValConstField)> dy,
             std::function<void(ValField, DerivConstField, double)> y_update) const
     {
-        DerivFieldMemType m_k1(m_idx_range);
-        DerivFieldMemType m_k2(m_idx_range);
-        FieldMemType m_y_prime(m_idx_range);
+        typename WorkspaceArena<MemorySpace>::Scope const workspace_scope(
+                get_workspace_arena<MemorySpace>());
+        typename WorkspaceArena<DerivMemorySpace>::Scope const deriv_workspace_scope(
+                get_workspace_arena<DerivMemorySpace>());
+        DerivStageFieldMem m_k1(m_idx_range);
+        DerivStageFieldMem m_k2(m_idx_range);
+        StageFieldMem m_y_prime(m_idx_range);
 
 
         // Save initial conditions
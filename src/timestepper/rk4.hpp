@@ -6,6 +6,7 @@
 #include "ddc_helper.hpp"
 #include "itimestepper.hpp"
 #include "vector_field_common.hpp"
+#include "workspace_arena.hpp"
 
 
 /**
@@ -50,6 +51,11 @@ private:
     using DerivFieldMem = typename DerivFieldMemType::span_type;
     using DerivConstField = typename DerivFieldMemType::view_type;
 
+    using StageFieldMem = workspace_t<FieldMemType>;
+    using DerivStageFieldMem = workspace_t<DerivFieldMemType>;
+    using MemorySpace = typename FieldMemType::memory_space;
+    using DerivMemorySpace = typename DerivFieldMemType::memory_space;
+
     IdxRange const m_idx_range;
 
 public:
@@ -154,12 +160,16 @@ public:
                 Kokkos::SpaceAccessibility<ExecSpace, typename DerivFieldMemType::memory_space>::
                         accessible,
                 "MemorySpace has to be accessible for ExecutionSpace.");
-        FieldMemType m_y_prime_alloc(m_idx_range);
-        DerivFieldMemType m_k1_alloc(m_idx_range);
-        DerivFieldMemType m_k2_alloc(m_idx_range);
-        DerivFieldMemType m_k3_alloc(m_idx_range);
-        DerivFieldMemType m_k4_alloc(m_idx_range);
-        DerivFieldMemType m_k_total_alloc(m_idx_range);
+        typename WorkspaceArena<MemorySpace>::Scope const workspace_scope(
+                get_workspace_arena<MemorySpace>());
+        typename WorkspaceArena<DerivMemorySpace>::Scope const deriv_workspace_scope(
+                get_workspace_arena<DerivMemorySpace>());
+        StageFieldMem m_y_prime_alloc(m_idx_range);
+        DerivStageFieldMem m_k1_alloc(m_idx_range);
+        DerivStageFieldMem m_k2_alloc(m_idx_range);
+        DerivStageFieldMem m_k3_alloc(m_idx_range);
+        DerivStageFieldMem m_k4_alloc(m_idx_range);
+        DerivStageFieldMem m_k_total_alloc(m_idx_range);
         ValField m_y_prime = get_field(m_y_prime_alloc);
         DerivFieldMem m_k1 = get_field(m_k1_alloc);
         DerivFieldMem m_k2 = get_field(m_k2_alloc);
@@ -254,16 +254,26 @@ struct OnMemorySpace<NewMemorySpace, ddc::ChunkSpan<ElementType, SupportType, La
  * @tparam NDTag NDTag object storing the dimensions along which the VectorFieldMem is defined.
  *               The dimensions refer to the dimensions of the arrival domain of the VectorFieldMem. 
  * @tparam Allocator Allocator type (see ddc::KokkosAllocator).
+ * @tparam ComponentLayout Tag describing how the components of the VectorFieldMem are stored.
  * @see VectorFieldMem
  */
-template <class NewMemorySpace, class ElementType, class SupportType, class NDTag, class Allocator>
-struct OnMemorySpace<NewMemorySpace, VectorFieldMem<ElementType, SupportType, NDTag, Allocator>>
+template <
+        class NewMemorySpace,
+        class ElementType,
+        class SupportType,
+        class NDTag,
+        class Allocator,
+        class ComponentLayout>
+struct OnMemorySpace<
+        NewMemorySpace,
+        VectorFieldMem<ElementType, SupportType, NDTag, Allocator, ComponentLayout>>
 {
     using type = VectorFieldMem<
             ElementType,
             SupportType,
             NDTag,
-            ddc::KokkosAllocator<ElementType, NewMemorySpace>>;
+            ddc::KokkosAllocator<ElementType, NewMemorySpace>,
+            ComponentLayout>;
 };
 
 /**
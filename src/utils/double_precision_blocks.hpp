@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <algorithm>
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "workspace_arena.hpp"
+
+namespace detail {
+/**
+ * @brief Apply a double precision operator to a field stored in single precision, one block
+ * at a time.
+ *
+ * The part idx_range of the field is split into n_blocks blocks along GridBlock. Each block is
+ * copied into a double precision buffer, the operator is applied to this buffer in place and
+ * the result is stored back in single precision. The operator must therefore only couple
+ * points which have the same index along GridBlock. The double precision buffer, and the
+ * buffers allocated by the operator, only span one block.
+ *
+ * @tparam GridBlock The dimension along which the field is split into blocks.
+ * @param[in, out] field The field stored in single precision.
+ * @param[in] idx_range The part of the index range of the field which is treated.
+ * @param[in] apply A function which applies the operator to a double precision block in place.
+ * @param[in] n_blocks The number of blocks.
+ */
+template <class GridBlock, class IdxRangeField, class Function>
+void apply_on_double_precision_blocks(
+        Field<float, IdxRangeField> const field,
+        IdxRangeField const idx_range,
+        Function&& apply,
+        std::size_t const n_blocks = 8)
+{
+    using IdxField = typename IdxRangeField::discrete_element_type;
+    using IdxRangeOther = ddc::remove_dims_of_t<IdxRangeField, GridBlock>;
+
+    IdxRangeOther const idx_range_other(idx_range);
+    IdxRange<GridBlock> const idx_range_block_dim = ddc::select<GridBlock>(idx_range);
+    std::size_t const n_block_dim = idx_range_block_dim.size();
+    std::size_t const block_size = (n_block_dim + n_blocks - 1) / n_blocks;
+
+    for (std::size_t start = 0; start < n_block_dim; start += block_size) {
+        WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const workspace_scope(
+                get_workspace_arena());
+        IdxRange<GridBlock> const idx_range_block_slice(
+                idx_range_block_dim.front() + IdxStep<GridBlock>(start),
+                IdxStep<GridBlock>(std::min(block_size, n_block_dim - start)));
+        IdxRangeField const idx_range_block(idx_range_block_slice, idx_range_other);
+        WorkspaceFieldMem<double, IdxRangeField> block_double_alloc(idx_range_block);
+        Field<double, IdxRangeField> const block_double = get_field(block_double_alloc);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idx_range_block,
+                KOKKOS_LAMBDA(IdxField const i) { block_double(i) = field(i); });
+        apply(block_double);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idx_range_block,
+                KOKKOS_LAMBDA(IdxField const i) {
+                    field(i) = static_cast<float>(block_double(i));
+                });
+    }
+}
+} // namespace detail
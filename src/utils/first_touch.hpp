@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_aliases.hpp"
+
+/**
+ * @brief Initialise the values of a newly allocated field in parallel with the iteration
+ * mapping used by the computational kernels.
+ *
+ * The memory allocated for a FieldMem is not initialised. On a CPU the operating system only
+ * maps a page of memory to a NUMA node when it is first written to, and it places it on the
+ * NUMA node of the thread which writes to it. If a large field is first written to by a single
+ * thread (or by a kernel with a different iteration mapping) then most of it is placed on one
+ * NUMA node and the kernels running on the other sockets are limited by the bandwidth of the
+ * interconnect.
+ *
+ * This function writes a value to each element with ddc::parallel_for_each over the whole
+ * index range of the field, which is the loop used by the kernels acting on the field. Each
+ * thread therefore touches the pages which it will access in these kernels. It should be called
+ * directly after the allocation, before the field is initialised. On a GPU it only sets the
+ * values.
+ *
+ * The threads must be pinned for the placement to remain valid (e.g. OMP_PROC_BIND=spread and
+ * OMP_PLACES=threads with the OpenMP backend).
+ *
+ * @param[in] exec_space The execution space on which the kernels acting on the field are run.
+ * @param[out] field The field whose memory is touched.
+ * @param[in] value The value written to each element.
+ */
+template <
+        class ExecSpace,
+        class ElementType,
+        class IdxRangeType,
+        class LayoutStridedPolicy,
+        class MemorySpace>
+void first_touch(
+        ExecSpace const& exec_space,
+        Field<ElementType, IdxRangeType, LayoutStridedPolicy, MemorySpace> const field,
+        ElementType const value = ElementType())
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+            "The field must be accessible from the execution space");
+    ddc::parallel_for_each(
+            exec_space,
+            get_idx_range(field),
+            KOKKOS_LAMBDA(typename IdxRangeType::discrete_element_type const idx) {
+                field(idx) = value;
+            });
+}
+
+/**
+ * @brief Initialise the values of a newly allocated field in parallel with the iteration
+ * mapping used by the computational kernels on the default execution space.
+ *
+ * @see first_touch(ExecSpace const&, Field<ElementType, IdxRangeType, LayoutStridedPolicy, MemorySpace>, ElementType)
+ *
+ * @param[out] field The field whose memory is touched.
+ * @param[in] value The value written to each element.
+ */
+template <class ElementType, class IdxRangeType, class LayoutStridedPolicy, class MemorySpace>
+void first_touch(
+        Field<ElementType, IdxRangeType, LayoutStridedPolicy, MemorySpace> const field,
+        ElementType const value = ElementType())
+{
+    first_touch(Kokkos::DefaultExecutionSpace(), field, value);
+}
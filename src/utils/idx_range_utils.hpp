@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <cstddef>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_aliases.hpp"
+
+namespace ddcHelper {
+
+/**
+ * @brief Convert an integer into an index found in an index range starting from the front.
+ * The last dimension is the fastest varying dimension. This is useful for iterating over an
+ * index range using Kokkos loops (e.g. with the league rank of a team policy).
+ *
+ * @param idx The position of the requested element.
+ * @param idx_range The index range being iterated over.
+ *
+ * @returns The element of the index range.
+ */
+template <class HeadGrid, class... Grid1D>
+KOKKOS_FUNCTION Idx<HeadGrid, Grid1D...> to_discrete_element(
+        std::size_t idx,
+        IdxRange<HeadGrid, Grid1D...> idx_range)
+{
+    IdxRange<Grid1D...> subidx_range(idx_range);
+    Idx<HeadGrid> head_idx(ddc::select<HeadGrid>(idx_range).front() + idx / subidx_range.size());
+    if constexpr (sizeof...(Grid1D) == 0) {
+        return head_idx;
+    } else {
+        Idx<Grid1D...> tail_idx = to_discrete_element(idx % subidx_range.size(), subidx_range);
+        return Idx<HeadGrid, Grid1D...>(head_idx, tail_idx);
+    }
+}
+
+/**
+ * @brief Convert an integer into an index of a 0D index range.
+ *
+ * @returns The only element of the index range.
+ */
+KOKKOS_INLINE_FUNCTION Idx<> to_discrete_element(std::size_t, IdxRange<>)
+{
+    return Idx<>();
+}
+
+} // namespace ddcHelper
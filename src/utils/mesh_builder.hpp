@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <cassert>
+#include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <vector>
@@ -45,3 +47,114 @@ std::vector<Coord<Dim>> build_random_non_uniform_break_points(
     break_points[n_cells] = max;
     return break_points;
 }
+
+/**
+ * @brief Build break points which are refined near both boundaries of the domain.
+ *
+ * The break points are the image of uniformly spaced points by a hyperbolic tangent:
+ * $`x_i = x_{min} + (x_{max} - x_{min}) (1 + \tanh(s \xi_i) / \tanh(s)) / 2`$ with
+ * $`\xi_i = 2 i / n - 1`$. The ratio between the size of the cells at the centre and at
+ * the boundaries increases with the stretching parameter s.
+ *
+ * @param[in] min The lower bound of the domain.
+ * @param[in] max The upper bound of the domain.
+ * @param[in] n_cells The number of cells.
+ * @param[in] stretching The (strictly positive) stretching parameter s.
+ *
+ * @returns The break points.
+ */
+template <class Dim, class Grid1D>
+std::vector<Coord<Dim>> build_tanh_break_points(
+        Coord<Dim> min,
+        Coord<Dim> max,
+        IdxStep<Grid1D> n_cells,
+        double stretching)
+{
+    static_assert(std::is_same_v<typename Grid1D::continuous_dimension_type, Dim>);
+    assert(stretching > 0);
+
+    std::vector<Coord<Dim>> break_points(n_cells + 1);
+    double const length(max - min);
+    double const tanh_stretching(std::tanh(stretching));
+
+    break_points[0] = min;
+    for (int i(1); i < n_cells; ++i) {
+        double const xi = 2. * i / double(n_cells) - 1.;
+        break_points[i] = min + length * 0.5 * (1. + std::tanh(stretching * xi) / tanh_stretching);
+    }
+    break_points[n_cells] = max;
+    return break_points;
+}
+
+/**
+ * @brief Build break points whose cell sizes form a geometric sequence.
+ *
+ * The size of each cell is equal to the size of the previous cell multiplied by the ratio.
+ * A ratio larger than 1 therefore refines the mesh near the lower bound and a ratio smaller
+ * than 1 refines the mesh near the upper bound.
+ *
+ * @param[in] min The lower bound of the domain.
+ * @param[in] max The upper bound of the domain.
+ * @param[in] n_cells The number of cells.
+ * @param[in] ratio The (strictly positive) ratio between the sizes of two consecutive cells.
+ *
+ * @returns The break points.
+ */
+template <class Dim, class Grid1D>
+std::vector<Coord<Dim>> build_geometric_break_points(
+        Coord<Dim> min,
+        Coord<Dim> max,
+        IdxStep<Grid1D> n_cells,
+        double ratio)
+{
+    static_assert(std::is_same_v<typename Grid1D::continuous_dimension_type, Dim>);
+    assert(ratio > 0);
+
+    if (ratio == 1.) {
+        return build_uniform_break_points(min, max, n_cells);
+    }
+
+    std::vector<Coord<Dim>> break_points(n_cells + 1);
+    double const first_cell_size(
+            (max - min) * (ratio - 1.) / (std::pow(ratio, double(n_cells)) - 1.));
+
+    break_points[0] = min;
+    double cell_size = first_cell_size;
+    for (int i(1); i < n_cells; ++i) {
+        break_points[i] = break_points[i - 1] + cell_size;
+        cell_size *= ratio;
+    }
+    break_points[n_cells] = max;
+    return break_points;
+}
+
+/**
+ * @brief Build break points which are uniform in each of a set of zones.
+ *
+ * This allows the mesh to be refined in the zones where a high resolution is needed.
+ *
+ * @param[in] zone_bounds The (increasing) bounds of the zones. The first and last elements
+ *                  are the bounds of the domain.
+ * @param[in] zone_ncells The number of cells in each zone.
+ *
+ * @returns The break points.
+ */
+template <class Dim>
+std::vector<Coord<Dim>> build_piecewise_uniform_break_points(
+        std::vector<Coord<Dim>> const& zone_bounds,
+        std::vector<int> const& zone_ncells)
+{
+    assert(zone_bounds.size() == zone_ncells.size() + 1);
+
+    std::vector<Coord<Dim>> break_points {zone_bounds[0]};
+    for (std::size_t zone(0); zone < zone_ncells.size(); ++zone) {
+        assert(zone_bounds[zone + 1] > zone_bounds[zone]);
+        assert(zone_ncells[zone] > 0);
+        double const delta((zone_bounds[zone + 1] - zone_bounds[zone]) / zone_ncells[zone]);
+        for (int i(1); i < zone_ncells[zone]; ++i) {
+            break_points.push_back(zone_bounds[zone] + i * delta);
+        }
+        break_points.push_back(zone_bounds[zone + 1]);
+    }
+    return break_points;
+}
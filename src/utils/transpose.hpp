@@ -1,6 +1,177 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_aliases.hpp"
+#include "idx_range_utils.hpp"
+
+namespace detail {
+
+/// The size of the square tiles used by transpose_layout_tiled.
+inline constexpr int transpose_tile_size = 32;
+
+/// The dimension which is contiguous in memory in a layout_right index range.
+template <class IdxRangeType>
+using innermost_dim_t = ddc::type_seq_element_t<
+        IdxRangeType::rank() - 1,
+        ddc::to_type_seq_t<IdxRangeType>>;
+
+/**
+ * @brief Copy data from a view in one layout into a span in a transposed layout by iterating
+ * over the elements of the start domain.
+ *
+ * Reads are contiguous but writes may be strided.
+ *
+ * @param execution_space The execution space (Host/Device) where the code will run.
+ * @param end_span The span describing the data object which the data will be copied into.
+ * @param start_view The constant span describing the data object where the original
+ *                  data is found.
+ *
+ * @returns The end_span describing the data object which the data
+ *          was copied into.
+ */
+template <
+        class ExecSpace,
+        class ElementType,
+        class StartDomain,
+        class StartLayoutStridedPolicy,
+        class MemorySpace,
+        class EndDomain,
+        class EndLayoutStridedPolicy>
+ddc::ChunkSpan<ElementType, EndDomain, EndLayoutStridedPolicy, MemorySpace>
+transpose_layout_elementwise(
+        ExecSpace const& execution_space,
+        ddc::ChunkSpan<ElementType, EndDomain, EndLayoutStridedPolicy, MemorySpace> end_span,
+        ddc::ChunkView<ElementType, StartDomain, StartLayoutStridedPolicy, MemorySpace> start_view)
+{
+    using StartIndex = typename StartDomain::discrete_element_type;
+
+    ddc::parallel_for_each(
+            execution_space,
+            start_view.domain(),
+            KOKKOS_LAMBDA(StartIndex idx) { end_span(idx) = start_view(idx); });
+    return end_span;
+}
+
+/**
+ * @brief Copy data from a view in one layout into a span in a transposed layout using
+ * square tiles.
+ *
+ * The two dimensions which are contiguous in memory in the start and end layouts are
+ * split into tiles. Each tile is loaded into the team scratch memory along the contiguous
+ * dimension of the start layout and written from the scratch memory along the contiguous
+ * dimension of the end layout so both the reads and the writes are contiguous. The other
+ * dimensions are batch dimensions.
+ *
+ * Both layouts must be layout_right and their innermost dimensions must be different.
+ *
+ * @param execution_space The execution space (Host/Device) where the code will run.
+ * @param end_span The span describing the data object which the data will be copied into.
+ * @param start_view The constant span describing the data object where the original
+ *                  data is found.
+ *
+ * @returns The end_span describing the data object which the data
+ *          was copied into.
+ */
+template <
+        class ExecSpace,
+        class ElementType,
+        class StartDomain,
+        class MemorySpace,
+        class EndDomain>
+ddc::ChunkSpan<ElementType, EndDomain, std::experimental::layout_right, MemorySpace>
+transpose_layout_tiled(
+        ExecSpace const& execution_space,
+        ddc::ChunkSpan<ElementType, EndDomain, std::experimental::layout_right, MemorySpace>
+                end_span,
+        ddc::ChunkView<ElementType, StartDomain, std::experimental::layout_right, MemorySpace>
+                start_view)
+{
+    using GridRead = innermost_dim_t<StartDomain>;
+    using GridWrite = innermost_dim_t<EndDomain>;
+    static_assert(!std::is_same_v<GridRead, GridWrite>);
+    using BatchIdxRange = ddc::remove_dims_of_t<StartDomain, GridRead, GridWrite>;
+    using BatchIdx = typename BatchIdxRange::discrete_element_type;
+    using StartIndex = typename StartDomain::discrete_element_type;
+
+    using TeamPolicy = Kokkos::TeamPolicy<ExecSpace>;
+    using MemberType = typename TeamPolicy::member_type;
+    using ScratchTile = Kokkos::View<
+            ElementType**,
+            Kokkos::LayoutRight,
+            typename ExecSpace::scratch_memory_space,
+            Kokkos::MemoryUnmanaged>;
+
+    int const tile_size = transpose_tile_size;
+
+    StartDomain const idx_range = start_view.domain();
+    IdxRange<GridRead> const idx_range_read(idx_range);
+    IdxRange<GridWrite> const idx_range_write(idx_range);
+    BatchIdxRange const batch_idx_range(idx_range);
+
+    int const n_read = idx_range_read.size();
+    int const n_write = idx_range_write.size();
+    int const n_tiles_read = (n_read + tile_size - 1) / tile_size;
+    int const n_tiles_write = (n_write + tile_size - 1) / tile_size;
+    int const n_tiles = n_tiles_read * n_tiles_write;
+
+    TeamPolicy policy(execution_space, batch_idx_range.size() * n_tiles, Kokkos::AUTO);
+    // The padding of the tile avoids bank conflicts when it is read along its columns
+    std::size_t const tile_bytes = ScratchTile::shmem_size(tile_size, tile_size + 1);
+    policy.set_scratch_size(0, Kokkos::PerTeam(tile_bytes));
+
+    Kokkos::parallel_for(
+            "transpose_layout_tiled",
+            policy,
+            KOKKOS_LAMBDA(MemberType const& team) {
+                int const league_rank = team.league_rank();
+                int const tile_idx = league_rank % n_tiles;
+                BatchIdx const batch_idx
+                        = ddcHelper::to_discrete_element(league_rank / n_tiles, batch_idx_range);
+                int const read_start = (tile_idx % n_tiles_read) * tile_size;
+                int const write_start = (tile_idx / n_tiles_read) * tile_size;
+                int const n_tile_read = Kokkos::min(tile_size, n_read - read_start);
+                int const n_tile_write = Kokkos::min(tile_size, n_write - write_start);
+                int const n_tile_elements = n_tile_read * n_tile_write;
+
+                ScratchTile tile(team.team_scratch(0), tile_size, tile_size + 1);
+
+                // Load the tile with consecutive threads reading consecutive elements
+                Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange(team, n_tile_elements),
+                        [&](int const k) {
+                            int const i_read = k % n_tile_read;
+                            int const i_write = k / n_tile_read;
+                            StartIndex const idx(
+                                    batch_idx,
+                                    idx_range_read.front() + read_start + i_read,
+                                    idx_range_write.front() + write_start + i_write);
+                            tile(i_write, i_read) = start_view(idx);
+                        });
+                team.team_barrier();
+
+                // Store the tile with consecutive threads writing consecutive elements
+                Kokkos::parallel_for(
+                        Kokkos::TeamThreadRange(team, n_tile_elements),
+                        [&](int const k) {
+                            int const i_write = k % n_tile_write;
+                            int const i_read = k / n_tile_write;
+                            StartIndex const idx(
+                                    batch_idx,
+                                    idx_range_read.front() + read_start + i_read,
+                                    idx_range_write.front() + write_start + i_write);
+                            end_span(idx) = tile(i_write, i_read);
+                        });
+            });
+    return end_span;
+}
+
+} // namespace detail
 
 /**
  * @brief Copy data from a view in one layout into a span in a transposed layout.
@@ -9,6 +180,10 @@
  * to be a transposition of one another if both domains describe data on the same
  * physical dimensions.
  *
+ * If both layouts are layout_right and the transposition changes the dimension which is
+ * contiguous in memory then a tiled algorithm is used so that both the reads and the writes
+ * are contiguous. Otherwise the elements are copied one by one.
+ *
  * @param execution_space The execution space (Host/Device) where the code will run.
  * @param end_span The span describing the data object which the data will be copied into.
  * @param start_view The constant span describing the data object where the original
@@ -46,11 +221,17 @@ ddc::ChunkSpan<ElementType, EndDomain, EndLayoutStridedPolicy, MemorySpace> tran
     // Check that both views have the same domain (just reordered)
     assert(start_view.domain() == end_span.domain());
 
-    using StartIndex = typename StartDomain::discrete_element_type;
-
-    ddc::parallel_for_each(
-            execution_space,
-            start_view.domain(),
-            KOKKOS_LAMBDA(StartIndex idx) { end_span(idx) = start_view(idx); });
-    return end_span;
+    if constexpr (
+            std::is_same_v<StartLayoutStridedPolicy, std::experimental::layout_right>
+            && std::is_same_v<EndLayoutStridedPolicy, std::experimental::layout_right>) {
+        if constexpr (!std::is_same_v<
+                              detail::innermost_dim_t<StartDomain>,
+                              detail::innermost_dim_t<EndDomain>>) {
+            return detail::transpose_layout_tiled(execution_space, end_span, start_view);
+        } else {
+            return detail::transpose_layout_elementwise(execution_space, end_span, start_view);
+        }
+    } else {
+        return detail::transpose_layout_elementwise(execution_space, end_span, start_view);
+    }
 }
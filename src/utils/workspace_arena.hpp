@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc_aliases.hpp"
+#include "vector_field_mem.hpp"
+
+/**
+ * @brief A pool of memory from which the temporary arrays of the operators are allocated.
+ *
+ * The memory is handed out with a bump pointer so an allocation does not call the allocator of
+ * the memory space (and therefore does not cause an implicit fence). The memory is reclaimed
+ * when the Scope in which it was allocated ends. Scopes can be nested so each operator opens
+ * its own scope around its temporary arrays.
+ *
+ * If the pool is too small then the allocations which do not fit are made with
+ * Kokkos::kokkos_malloc. The largest amount of memory used simultaneously is saved and the
+ * pool is resized to this amount when the outermost scope ends. The operators which are called
+ * at each time step open their own outermost scope so after the first time step the pool is
+ * large enough and their temporary arrays no longer cause an allocation (and the associated
+ * implicit fence). Buffers which live for the whole time loop should not be allocated from an
+ * arena: they would always be allocated outside of the pool and would then be counted again
+ * in the size of the pool.
+ *
+ * Arrays allocated from an arena must not outlive the scope in which they were allocated.
+ *
+ * @tparam MemorySpace The memory space where the pool is allocated.
+ */
+template <class MemorySpace>
+class WorkspaceArena
+{
+public:
+    /// @brief The alignment (in bytes) of the allocations (the alignment of a Kokkos allocation).
+    static constexpr std::size_t alignment = 64;
+
+    /**
+     * @brief A class which releases all the memory allocated from the arena during its lifetime
+     * when it is destroyed.
+     */
+    class Scope
+    {
+        WorkspaceArena& m_arena;
+
+        std::size_t m_offset;
+
+        std::size_t m_used;
+
+    public:
+        /**
+         * @brief Open a scope on an arena.
+         * @param[in] arena The arena from which the memory is allocated in this scope.
+         */
+        explicit Scope(WorkspaceArena& arena)
+            : m_arena(arena)
+            , m_offset(arena.m_offset)
+            , m_used(arena.m_used)
+        {
+            ++m_arena.m_n_scopes;
+        }
+
+        Scope(Scope const&) = delete;
+
+        Scope& operator=(Scope const&) = delete;
+
+        ~Scope()
+        {
+            m_arena.m_offset = m_offset;
+            m_arena.m_used = m_used;
+            --m_arena.m_n_scopes;
+            m_arena.fit_to_high_water_mark();
+        }
+    };
+
+private:
+    std::string m_label;
+
+    Kokkos::View<char*, MemorySpace> m_pool;
+
+    // The position of the first free byte of the pool
+    std::size_t m_offset = 0;
+
+    // The memory currently allocated (in the pool or not)
+    std::size_t m_used = 0;
+
+    // The largest amount of memory which was allocated simultaneously
+    std::size_t m_high_water_mark = 0;
+
+    int m_n_scopes = 0;
+
+    int m_n_overflow_allocations = 0;
+
+public:
+    /**
+     * @brief Create an arena.
+     * @param[in] label The label of the pool (used by the Kokkos tools).
+     * @param[in] capacity The initial size of the pool in bytes.
+     */
+    explicit WorkspaceArena(std::string label = "workspace_arena", std::size_t capacity = 0)
+        : m_label(std::move(label))
+    {
+        if (capacity > 0) {
+            resize(capacity);
+        }
+    }
+
+    WorkspaceArena(WorkspaceArena const&) = delete;
+
+    WorkspaceArena& operator=(WorkspaceArena const&) = delete;
+
+    ~WorkspaceArena()
+    {
+        assert(m_n_scopes == 0);
+    }
+
+    /**
+     * @brief Allocate memory from the arena.
+     * @param[in] label The label of the allocation if it does not fit in the pool.
+     * @param[in] n_bytes The number of bytes to allocate.
+     * @return A pointer to the allocated memory.
+     */
+    void* allocate(std::string const& label, std::size_t n_bytes)
+    {
+        std::size_t const aligned_size = (n_bytes + alignment - 1) / alignment * alignment;
+        m_used += aligned_size;
+        m_high_water_mark = std::max(m_high_water_mark, m_used);
+        if (m_offset + aligned_size <= capacity()) {
+            void* const ptr = m_pool.data() + m_offset;
+            m_offset += aligned_size;
+            return ptr;
+        }
+        ++m_n_overflow_allocations;
+        return Kokkos::kokkos_malloc<MemorySpace>(label, n_bytes);
+    }
+
+    /**
+     * @brief Deallocate memory obtained from the arena.
+     *
+     * Memory in the pool is only reclaimed at the end of the enclosing scope so this function
+     * only releases the allocations which did not fit in the pool.
+     *
+     * @param[in] ptr The pointer to the memory.
+     */
+    void deallocate(void* ptr)
+    {
+        char const* const cptr = static_cast<char const*>(ptr);
+        if (cptr < m_pool.data() || cptr >= m_pool.data() + capacity()) {
+            Kokkos::kokkos_free<MemorySpace>(ptr);
+        }
+    }
+
+    /**
+     * @brief Get the size of the pool.
+     * @return The size of the pool in bytes.
+     */
+    std::size_t capacity() const
+    {
+        return m_pool.size();
+    }
+
+    /**
+     * @brief Get the largest amount of memory which was allocated simultaneously.
+     * @return The amount of memory in bytes.
+     */
+    std::size_t high_water_mark() const
+    {
+        return m_high_water_mark;
+    }
+
+    /**
+     * @brief Get the number of allocations which did not fit in the pool.
+     * @return The number of allocations.
+     */
+    int n_overflow_allocations() const
+    {
+        return m_n_overflow_allocations;
+    }
+
+    /**
+     * @brief Release the pool. This must be called before Kokkos is finalised.
+     */
+    void release()
+    {
+        assert(m_n_scopes == 0);
+        m_pool = Kokkos::View<char*, MemorySpace>();
+        m_offset = 0;
+        m_used = 0;
+        m_high_water_mark = 0;
+    }
+
+private:
+    void resize(std::size_t capacity)
+    {
+        m_pool = Kokkos::View<char*, MemorySpace>(
+                Kokkos::view_alloc(Kokkos::WithoutInitializing, m_label),
+                capacity);
+    }
+
+    void fit_to_high_water_mark()
+    {
+        // Memory allocated outside of the pool by an enclosing scope is still in use so the
+        // pool is only resized once all the scopes have ended
+        if (m_n_scopes == 0 && m_offset == 0 && m_high_water_mark > capacity()) {
+            m_pool = Kokkos::View<char*, MemorySpace>();
+            resize(m_high_water_mark);
+        }
+    }
+};
+
+/**
+ * @brief Get the arena shared by all the operators for temporary arrays on a memory space.
+ *
+ * The pool is released when Kokkos is finalised.
+ *
+ * @tparam MemorySpace The memory space of the arena.
+ * @return A reference to the arena.
+ */
+template <class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+WorkspaceArena<MemorySpace>& get_workspace_arena()
+{
+    static WorkspaceArena<MemorySpace>& arena = []() -> WorkspaceArena<MemorySpace>& {
+        static WorkspaceArena<MemorySpace> shared_arena;
+        Kokkos::push_finalize_hook([]() { shared_arena.release(); });
+        return shared_arena;
+    }();
+    return arena;
+}
+
+/**
+ * @brief An allocator which can be used to allocate a FieldMem from a WorkspaceArena.
+ *
+ * It has the same interface as ddc::KokkosAllocator.
+ *
+ * @tparam T The type of the elements.
+ * @tparam MemorySpace The memory space where the memory is allocated.
+ */
+template <class T, class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+class ArenaAllocator
+{
+    WorkspaceArena<MemorySpace>* m_arena;
+
+public:
+    /// @brief The type of the elements.
+    using value_type = T;
+
+    /// @brief The memory space where the memory is allocated.
+    using memory_space = MemorySpace;
+
+    /// @brief The type of an allocator for elements of a different type.
+    template <class U>
+    struct rebind
+    {
+        /// @brief The type of the allocator.
+        using other = ArenaAllocator<U, MemorySpace>;
+    };
+
+    /// @brief Create an allocator using the shared arena of the memory space.
+    ArenaAllocator() : m_arena(&get_workspace_arena<MemorySpace>()) {}
+
+    /**
+     * @brief Create an allocator using a given arena.
+     * @param[in] arena The arena.
+     */
+    explicit ArenaAllocator(WorkspaceArena<MemorySpace>& arena) : m_arena(&arena) {}
+
+    /**
+     * @brief Allocate memory for n elements.
+     * @param[in] label The label of the allocation.
+     * @param[in] n The number of elements.
+     * @return A pointer to the memory.
+     */
+    [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
+    {
+        return static_cast<T*>(m_arena->allocate(label, n * sizeof(T)));
+    }
+
+    /**
+     * @brief Deallocate memory.
+     * @param[in] ptr A pointer to the memory.
+     */
+    void deallocate(T* ptr, std::size_t) const
+    {
+        m_arena->deallocate(ptr);
+    }
+};
+
+/// A FieldMem for temporary arrays which is allocated from the shared arena of the memory space.
+template <
+        class ElementType,
+        class IdxRangeType,
+        class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+using WorkspaceFieldMem
+        = FieldMem<ElementType, IdxRangeType, ArenaAllocator<ElementType, MemorySpace>>;
+
+/// A FieldMem of doubles for temporary arrays which is allocated from the shared arena.
+template <class IdxRangeType, class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+using DWorkspaceFieldMem = WorkspaceFieldMem<double, IdxRangeType, MemorySpace>;
+
+namespace detail {
+template <class>
+struct OnWorkspace
+{
+};
+
+/**
+ * @brief Get the type of a `ddc::Chunk` allocated from the shared arena of its memory space.
+ * @tparam ElementType Type of the elements in the ddc::Chunk.
+ * @tparam SupportType Type of the domain of the ddc::Chunk.
+ * @tparam Allocator Allocator type (see ddc::KokkosAllocator).
+ */
+template <class ElementType, class SupportType, class Allocator>
+struct OnWorkspace<ddc::Chunk<ElementType, SupportType, Allocator>>
+{
+    using type = WorkspaceFieldMem<ElementType, SupportType, typename Allocator::memory_space>;
+};
+
+/**
+ * @brief Get the type of a `VectorFieldMem` allocated from the shared arena of its memory space.
+ * @tparam ElementType Type of the elements in the ddc::Chunk of the VectorFieldMem.
+ * @tparam SupportType Type of the domain of the ddc::Chunk in the VectorFieldMem.
+ * @tparam NDTag NDTag object storing the dimensions along which the VectorFieldMem is defined.
+ * @tparam Allocator Allocator type (see ddc::KokkosAllocator).
+ * @tparam ComponentLayout Tag describing how the components of the VectorFieldMem are stored.
+ */
+template <
+        class ElementType,
+        class SupportType,
+        class NDTag,
+        class Allocator,
+        class ComponentLayout>
+struct OnWorkspace<VectorFieldMem<ElementType, SupportType, NDTag, Allocator, ComponentLayout>>
+{
+    using type = VectorFieldMem<
+            ElementType,
+            SupportType,
+            NDTag,
+            ArenaAllocator<ElementType, typename Allocator::memory_space>,
+            ComponentLayout>;
+};
+} // namespace detail
+
+/**
+ * @brief Alias template helper returning the type of a `ddc::Chunk` or a `VectorFieldMem`
+ * allocated from the shared arena of its memory space.
+ *
+ * The span and view types are the same as those of the original type.
+ */
+template <class C>
+using workspace_t = typename detail::OnWorkspace<C>::type;
@@ -732,3 +732,41 @@ TEST(DerivFieldTest, FieldDeepCopy)
         EXPECT_EQ(right_x_derivs(iy), 2 * x_right);
     });
 }
+
+// Test that the values and all the derivatives are stored in a single allocation
+TEST(DerivFieldMemTest, SingleAllocation)
+{
+    // Index ranges where derivatives are defined
+    IdxRangeSlice<GridX> deriv_idx_range_x(idx_range_x.front(), IdxStepX(2), idx_range_x.extents());
+    IdxRangeSlice<GridY> deriv_idx_range_y(idx_range_y.front(), IdxStepY(2), idx_range_y.extents());
+
+    // Define fields on x-y with 1 derivative in x and y
+    DerivFieldMem<double, IdxRange_dXdYXY, 1>
+            dxdyField(idx_range_x_y, deriv_idx_range_x, deriv_idx_range_y);
+    DerivFieldMem<double, IdxRange_dXdYXY, 1>
+            dxdyField_copy(idx_range_x_y, deriv_idx_range_x, deriv_idx_range_y);
+
+    // The allocation contains the values, the derivatives in x, in y and the cross-derivatives
+    auto allocation = dxdyField.allocation_kokkos_view();
+    std::size_t const nx = nelems_x.value();
+    std::size_t const ny = nelems_y.value();
+    EXPECT_EQ(allocation.size(), nx * ny + 2 * ny + nx * 2 + 2 * 2);
+
+    // Each element of the allocation is an element of the DerivFieldMem
+    Kokkos::deep_copy(allocation, 0.0);
+    Idx_dXdYXY const cross_deriv_element(
+            Idx<dX, dY>(Idx<dX>(1), Idx<dY>(1)),
+            IdxXY(deriv_idx_range_x.back(), deriv_idx_range_y.back()));
+    dxdyField.get_values_field()(idx_range_x_y.front()) = 1.0;
+    dxdyField(cross_deriv_element) = 2.0;
+    double sum(0.0);
+    for (std::size_t i(0); i < allocation.size(); ++i) {
+        sum += allocation(i);
+    }
+    EXPECT_EQ(sum, 3.0);
+
+    // The copy only requires one operation on the allocation
+    ddcHelper::deepcopy(dxdyField_copy, dxdyField);
+    EXPECT_EQ(dxdyField_copy.get_values_field()(idx_range_x_y.front()), 1.0);
+    EXPECT_EQ(dxdyField_copy(cross_deriv_element), 2.0);
+}
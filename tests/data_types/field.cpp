@@ -76,6 +76,13 @@ using IdxStepYX = IdxStep<GridY, GridX>;
 using IdxRangeYX = IdxRange<GridY, GridX>;
 
 using DVectorFieldMemYX = VectorFieldMem<double, IdxRangeYX, Direction>;
+
+using DVectorFieldMemInterleavedXY = VectorFieldMem<
+        double,
+        IdxRangeXY,
+        Direction,
+        ddc::HostAllocator<double>,
+        InterleavedComponents>;
 using DVectorConstFieldYX = VectorField<double const, IdxRangeYX, Direction>;
 
 
@@ -615,3 +622,106 @@ TEST(VectorField2DTest, DeepcopyReordered)
         }
     }
 }
+
+// \}
+// Functions implemented in VectorFieldMem with interleaved components \{
+
+TEST(VectorFieldInterleavedTest, LayoutType)
+{
+    DVectorFieldMemInterleavedXY field(idx_range_x_y);
+    EXPECT_TRUE((std::is_same_v<
+                 std::decay_t<decltype(ddcHelper::get<Tag1>(field))>::layout_type,
+                 std::experimental::layout_stride>));
+    EXPECT_TRUE((std::is_same_v<
+                 std::decay_t<decltype(get_field(field))>::layout_type,
+                 std::experimental::layout_stride>));
+}
+
+TEST(VectorFieldInterleavedTest, ComponentsAreContiguous)
+{
+    DVectorFieldMemInterleavedXY field(idx_range_x_y);
+    IdxXY const idx = idx_range_x_y.front() + IdxStepXY(1, 2);
+    EXPECT_EQ(&ddcHelper::get<Tag2>(field)(idx), &ddcHelper::get<Tag1>(field)(idx) + 1);
+    EXPECT_EQ(ddcHelper::get<Tag1>(field).stride<GridY>(), std::size_t(2));
+    EXPECT_EQ(ddcHelper::get<Tag1>(field).stride<GridX>(), std::size_t(2 * nelems_y.value()));
+}
+
+TEST(VectorFieldInterleavedTest, Access)
+{
+    DVectorFieldMemInterleavedXY field(idx_range_x_y);
+    for (IdxX ix : get_idx_range<GridX>(field)) {
+        for (IdxY iy : get_idx_range<GridY>(field)) {
+            ddcHelper::get<Tag1>(field)(ix, iy) = 1.357 * (ix - idx_range_x.front()).value();
+            ddcHelper::get<Tag2>(field)(ix, iy)
+                    = 1.159 * (iy - ddc::select<GridY>(idx_range_x_y).front()).value();
+        }
+    }
+    for (IdxX ix : get_idx_range<GridX>(field)) {
+        for (IdxY iy : get_idx_range<GridY>(field)) {
+            EXPECT_EQ(
+                    ddc::get<Tag1>(field(ix, iy)),
+                    1.357 * (ix - idx_range_x.front()).value());
+            EXPECT_EQ(
+                    ddc::get<Tag2>(field(iy, ix)),
+                    1.159 * (iy - ddc::select<GridY>(idx_range_x_y).front()).value());
+        }
+    }
+}
+
+TEST(VectorFieldInterleavedTest, MoveConstructor)
+{
+    DVectorFieldMemInterleavedXY field(idx_range_x_y);
+    for (IdxXY ixy : get_idx_range(field)) {
+        ddcHelper::get<Tag1>(field)(ixy) = 1.001 * (IdxX(ixy) - lbound_x).value();
+        ddcHelper::get<Tag2>(field)(ixy) = 1.002 * (IdxY(ixy) - lbound_y).value();
+    }
+    DVectorFieldMemInterleavedXY field2(std::move(field));
+    EXPECT_EQ(get_idx_range(field2), idx_range_x_y);
+    for (IdxXY ixy : get_idx_range(field2)) {
+        EXPECT_EQ(
+                ddc::get<Tag1>(field2(ixy)),
+                1.001 * (IdxX(ixy) - lbound_x).value());
+        EXPECT_EQ(
+                ddc::get<Tag2>(field2(ixy)),
+                1.002 * (IdxY(ixy) - lbound_y).value());
+    }
+}
+
+TEST(VectorFieldInterleavedTest, DeepcopyFromAndToSeparate)
+{
+    DVectorFieldMemXY field(idx_range_x_y);
+    for (IdxXY ixy : get_idx_range(field)) {
+        ddcHelper::get<Tag1>(field)(ixy) = 1.739 * (IdxX(ixy) - lbound_x).value();
+        ddcHelper::get<Tag2>(field)(ixy) = 1.412 * (IdxY(ixy) - lbound_y).value();
+    }
+    DVectorFieldMemInterleavedXY field_interleaved(get_idx_range(field));
+    ddcHelper::deepcopy(field_interleaved, field);
+    DVectorFieldMemXY field2(get_idx_range(field));
+    ddcHelper::deepcopy(field2, field_interleaved);
+    for (IdxXY ixy : get_idx_range(field)) {
+        // we expect complete equality, not EXPECT_DOUBLE_EQ: these are copy
+        EXPECT_EQ(ddc::get<Tag1>(field_interleaved(ixy)), ddc::get<Tag1>(field(ixy)));
+        EXPECT_EQ(ddc::get<Tag2>(field_interleaved(ixy)), ddc::get<Tag2>(field(ixy)));
+        EXPECT_EQ(ddc::get<Tag1>(field2(ixy)), ddc::get<Tag1>(field(ixy)));
+        EXPECT_EQ(ddc::get<Tag2>(field2(ixy)), ddc::get<Tag2>(field(ixy)));
+    }
+}
+
+TEST(VectorFieldInterleavedTest, SliceCoordX)
+{
+    IdxX constexpr slice_x_val = IdxX(lbound_x + 1);
+
+    DVectorFieldMemInterleavedXY field(idx_range_x_y);
+    DVectorFieldMemInterleavedXY const& field_cref = field;
+    for (IdxXY ixy : get_idx_range(field)) {
+        ddcHelper::get<Tag1>(field)(ixy) = 1. * (IdxX(ixy) - lbound_x).value();
+        ddcHelper::get<Tag2>(field)(ixy) = .001 * (IdxY(ixy) - lbound_y).value();
+    }
+
+    auto field_y = field_cref[slice_x_val];
+    for (IdxY iy : get_idx_range<GridY>(field_cref)) {
+        // we expect complete equality, not EXPECT_DOUBLE_EQ: these are copy
+        EXPECT_EQ(ddc::get<Tag1>(field_y(iy)), ddc::get<Tag1>(field_cref(slice_x_val, iy)));
+        EXPECT_EQ(ddc::get<Tag2>(field_y(iy)), ddc::get<Tag2>(field_cref(slice_x_val, iy)));
+    }
+}
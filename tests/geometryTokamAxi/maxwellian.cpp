@@ -91,6 +91,18 @@ static void TestMaxwellianTokamAxi()
             magnetic_field_host);
     init_fequilibrium(allfequilibrium);
 
+    // Check that the on-the-fly evaluation of the Maxwellian matches the stored values
+    MaxwellianEvaluator const maxwellian = init_fequilibrium.get_evaluator();
+    double const max_error_evaluator = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range_spv2dtor2d,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxSpV2DTor2D const ispv2dtor2d) {
+                return Kokkos::fabs(maxwellian(ispv2dtor2d) - allfequilibrium(ispv2dtor2d));
+            });
+    EXPECT_LE(max_error_evaluator, 1e-14);
+
     // Initialization of the quadrature coefficients for integration in vpar, mu
     DFieldMemV2D quadrature_coeffs_v2d_alloc(
             trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(idx_range_v2d));
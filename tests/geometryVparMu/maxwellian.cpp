@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "maxwellianequilibrium.hpp"
+
+TEST(MaxwellianVparMu, EvaluatorMatchesComputeMaxwellian)
+{
+    CoordVpar const vpar_min(-6.);
+    CoordVpar const vpar_max(6.);
+    IdxStepVpar const vpar_size(32);
+    CoordMu const mu_min(0.);
+    CoordMu const mu_max(12.);
+    IdxStepMu const mu_size(16);
+
+    IdxStepSp const nb_kinspecies(2);
+    IdxRangeSp const idx_range_kinsp(IdxSp(0), nb_kinspecies);
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesVpar>(vpar_min, vpar_max, vpar_size);
+    ddc::init_discrete_space<BSplinesMu>(mu_min, mu_max, mu_size);
+
+    ddc::init_discrete_space<GridVpar>(SplineInterpPointsVpar::get_sampling<GridVpar>());
+    ddc::init_discrete_space<GridMu>(SplineInterpPointsMu::get_sampling<GridMu>());
+
+    IdxRangeVpar const gridvpar(SplineInterpPointsVpar::get_domain<GridVpar>());
+    IdxRangeMu const gridmu(SplineInterpPointsMu::get_domain<GridMu>());
+    IdxRangeSpVparMu const idx_range_spvparmu(idx_range_kinsp, gridvpar, gridmu);
+
+    // The species have different parameters so that each coefficient is checked
+    host_t<DFieldMemSp> mass(idx_range_kinsp);
+    host_t<DFieldMemSp> density_eq(idx_range_kinsp);
+    host_t<DFieldMemSp> temperature_eq(idx_range_kinsp);
+    host_t<DFieldMemSp> mean_velocity_eq(idx_range_kinsp);
+    IdxSp const isp1 = idx_range_kinsp.front();
+    IdxSp const isp2 = idx_range_kinsp.back();
+    mass(isp1) = 1.;
+    density_eq(isp1) = 1.;
+    temperature_eq(isp1) = 1.;
+    mean_velocity_eq(isp1) = 0.;
+    mass(isp2) = 2.;
+    density_eq(isp2) = 1.2;
+    temperature_eq(isp2) = 0.8;
+    mean_velocity_eq(isp2) = 0.5;
+    double const magnetic_field = 1.5;
+
+    // Reference computed species by species with the static formula
+    DFieldMemSpVparMu allfequilibrium_ref(idx_range_spvparmu);
+    for (IdxSp const isp : idx_range_kinsp) {
+        MaxwellianEquilibrium::compute_maxwellian(
+                get_field(allfequilibrium_ref)[isp],
+                mass(isp),
+                density_eq(isp),
+                temperature_eq(isp),
+                mean_velocity_eq(isp),
+                magnetic_field);
+    }
+
+    MaxwellianEquilibrium const init_fequilibrium(
+            std::move(mass),
+            std::move(density_eq),
+            std::move(temperature_eq),
+            std::move(mean_velocity_eq),
+            magnetic_field);
+    MaxwellianEvaluator const maxwellian = init_fequilibrium.get_evaluator();
+
+    // The equilibrium initialised by the operator uses the same evaluator
+    DFieldMemSpVparMu allfequilibrium(idx_range_spvparmu);
+    init_fequilibrium(get_field(allfequilibrium));
+
+    DConstFieldSpVparMu const allfequilibrium_ref_field = get_const_field(allfequilibrium_ref);
+    DConstFieldSpVparMu const allfequilibrium_field = get_const_field(allfequilibrium);
+    double const max_error_evaluator = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range_spvparmu,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxSpVparMu const ispvparmu) {
+                return Kokkos::fabs(maxwellian(ispvparmu) - allfequilibrium_ref_field(ispvparmu));
+            });
+    EXPECT_LE(max_error_evaluator, 1e-14);
+
+    double const max_error_operator = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range_spvparmu,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxSpVparMu const ispvparmu) {
+                return Kokkos::fabs(
+                        allfequilibrium_field(ispvparmu) - allfequilibrium_ref_field(ispvparmu));
+            });
+    EXPECT_LE(max_error_operator, 1e-14);
+}
@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: MIT
+#define _USE_MATH_DEFINES
+
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <pdi.h>
+
+#include "collisions_intra.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "species_info.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+/// Compute the density, momentum and energy of each species at each spatial point.
+void compute_conserved_moments(
+        host_t<DFieldSpX> density,
+        host_t<DFieldSpX> momentum,
+        host_t<DFieldSpX> energy,
+        host_t<DConstFieldSpXVx> allfdistribu,
+        host_t<DConstFieldVx> quadrature_coeffs)
+{
+    ddc::for_each(get_idx_range(density), [&](IdxSpX const ispx) {
+        density(ispx) = 0.;
+        momentum(ispx) = 0.;
+        energy(ispx) = 0.;
+        for (IdxVx const ivx : get_idx_range(quadrature_coeffs)) {
+            double const coordv = ddc::coordinate(ivx);
+            double const val = quadrature_coeffs(ivx) * allfdistribu(ispx, ivx);
+            density(ispx) += val;
+            momentum(ispx) += val * coordv;
+            energy(ispx) += val * coordv * coordv;
+        }
+    });
+}
+
+} // namespace
+
+/**
+ * Intra species collisions applied with tiles agree with the collisions applied on the whole
+ * grid and conserve the density, momentum and energy as well.
+ */
+TEST(CollisionsIntraTiles, MatchesUntiled)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(1.0);
+    IdxStepX const x_size(5);
+
+    CoordVx const vx_min(-10);
+    CoordVx const vx_max(10);
+    IdxStepVx const vx_size(200);
+
+    IdxStepSp const nb_kinspecies(2);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+    IdxSp const my_iion = idx_range_sp.front();
+    IdxSp const my_ielec = idx_range_sp.back();
+
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    IdxRangeX const gridx(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const gridvx(SplineInterpPointsVx::get_domain<GridVx>());
+    IdxRangeSpXVx const mesh(idx_range_sp, gridx, gridvx);
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    charges(my_ielec) = -1.;
+    charges(my_iion) = 1.;
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    // A bump on tail distribution function which is relaxed by the collisions
+    DFieldMemVx bulk_alloc(gridvx);
+    DFieldMemVx bump_alloc(gridvx);
+    MaxwellianEquilibrium::compute_maxwellian(get_field(bulk_alloc), 0.9, 1., 0.);
+    MaxwellianEquilibrium::compute_maxwellian(get_field(bump_alloc), 0.1, 0.5, 1.5);
+    auto bulk = ddc::create_mirror_view_and_copy(get_field(bulk_alloc));
+    auto bump = ddc::create_mirror_view_and_copy(get_field(bump_alloc));
+    host_t<DFieldMemSpXVx> allfdistribu_init(mesh);
+    ddc::for_each(mesh, [&](IdxSpXVx const ispxvx) {
+        IdxVx const ivx = ddc::select<GridVx>(ispxvx);
+        double const coordx = ddc::coordinate(ddc::select<GridX>(ispxvx));
+        double const bulk_density = 1. + 0.1 * std::sin(2 * M_PI * coordx);
+        allfdistribu_init(ispxvx) = bulk_density * bulk(ivx) + bump(ivx);
+    });
+
+    double const nustar0 = 0.1;
+    double const deltat = 0.1;
+    int const tile_size = 8;
+    double const tile_threshold = 1e-10;
+    CollisionsIntra const collisions(mesh, nustar0);
+    CollisionsIntra const collisions_tiled(mesh, nustar0, tile_size, tile_threshold);
+    EXPECT_EQ(collisions_tiled.get_tile_size(), tile_size);
+
+    DFieldMemSpXVx allfdistribu(mesh);
+    DFieldMemSpXVx allfdistribu_tiled(mesh);
+    ddc::parallel_deepcopy(allfdistribu, allfdistribu_init);
+    ddc::parallel_deepcopy(allfdistribu_tiled, allfdistribu_init);
+    for (int iter = 0; iter < 5; ++iter) {
+        collisions(get_field(allfdistribu), deltat);
+        collisions_tiled(get_field(allfdistribu_tiled), deltat);
+    }
+    auto allfdistribu_host = ddc::create_mirror_view_and_copy(get_field(allfdistribu));
+    auto allfdistribu_tiled_host = ddc::create_mirror_view_and_copy(get_field(allfdistribu_tiled));
+
+    // The tiled operator agrees with the untiled operator on the active tiles and leaves the
+    // negligible tails unchanged
+    ddc::for_each(mesh, [&](IdxSpXVx const ispxvx) {
+        EXPECT_NEAR(allfdistribu_tiled_host(ispxvx), allfdistribu_host(ispxvx), 1e-9);
+    });
+    ddc::for_each(ddc::select<Species, GridX>(mesh), [&](IdxSpX const ispx) {
+        IdxSpXVx const ispxvx_min(ispx, gridvx.front());
+        IdxSpXVx const ispxvx_max(ispx, gridvx.back());
+        EXPECT_EQ(allfdistribu_tiled_host(ispxvx_min), allfdistribu_init(ispxvx_min));
+        EXPECT_EQ(allfdistribu_tiled_host(ispxvx_max), allfdistribu_init(ispxvx_max));
+    });
+
+    // The tiled operator conserves the density, and the momentum and energy as well as the
+    // untiled operator
+    DFieldMemVx const quadrature_coeffs_alloc(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(gridvx));
+    auto quadrature_coeffs
+            = ddc::create_mirror_view_and_copy(get_const_field(quadrature_coeffs_alloc));
+    IdxRangeSpX const grid_sp_x(idx_range_sp, gridx);
+    host_t<DFieldMemSpX> density_init(grid_sp_x);
+    host_t<DFieldMemSpX> momentum_init(grid_sp_x);
+    host_t<DFieldMemSpX> energy_init(grid_sp_x);
+    host_t<DFieldMemSpX> density(grid_sp_x);
+    host_t<DFieldMemSpX> momentum(grid_sp_x);
+    host_t<DFieldMemSpX> energy(grid_sp_x);
+    host_t<DFieldMemSpX> density_tiled(grid_sp_x);
+    host_t<DFieldMemSpX> momentum_tiled(grid_sp_x);
+    host_t<DFieldMemSpX> energy_tiled(grid_sp_x);
+    compute_conserved_moments(
+            get_field(density_init),
+            get_field(momentum_init),
+            get_field(energy_init),
+            get_const_field(allfdistribu_init),
+            get_const_field(quadrature_coeffs));
+    compute_conserved_moments(
+            get_field(density),
+            get_field(momentum),
+            get_field(energy),
+            get_const_field(allfdistribu_host),
+            get_const_field(quadrature_coeffs));
+    compute_conserved_moments(
+            get_field(density_tiled),
+            get_field(momentum_tiled),
+            get_field(energy_tiled),
+            get_const_field(allfdistribu_tiled_host),
+            get_const_field(quadrature_coeffs));
+    double const tol = 1e-9;
+    ddc::for_each(grid_sp_x, [&](IdxSpX const ispx) {
+        EXPECT_NEAR(density_tiled(ispx), density_init(ispx), 1e-6);
+        EXPECT_LE(
+                std::fabs(momentum_tiled(ispx) - momentum_init(ispx)),
+                std::fabs(momentum(ispx) - momentum_init(ispx)) + tol);
+        EXPECT_LE(
+                std::fabs(energy_tiled(ispx) - energy_init(ispx)),
+                std::fabs(energy(ispx) - energy_init(ispx)) + tol);
+        EXPECT_NEAR(density_tiled(ispx), density(ispx), tol);
+    });
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "chargedensitycalculator.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "deltafchargedensitycalculator.hpp"
+#include "geometry.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "species_info.hpp"
+#include "trapezoid_quadrature.hpp"
+
+TEST(DeltaFChargeDensity, MatchesFullDistribution)
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2. * M_PI);
+    IdxStepX const x_size(16);
+
+    CoordVx const vx_min(-6);
+    CoordVx const vx_max(6);
+    IdxStepVx const vx_size(40);
+
+    IdxStepSp const nb_kinspecies(2);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+    IdxSp const my_iion = idx_range_sp.front();
+    IdxSp const my_ielec = idx_range_sp.back();
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+    IdxRangeX const gridx(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const gridvx(SplineInterpPointsVx::get_domain<GridVx>());
+    IdxRangeSpVx const mesh_spvx(idx_range_sp, gridvx);
+    IdxRangeSpXVx const mesh(idx_range_sp, gridx, gridvx);
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    charges(my_ielec) = -1.;
+    charges(my_iion) = 1.;
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    // The species have different equilibria so their contributions do not cancel out
+    DFieldMemSpVx allfequilibrium(mesh_spvx);
+    MaxwellianEquilibrium::compute_maxwellian(allfequilibrium[my_iion], 1., 1., 0.);
+    MaxwellianEquilibrium::compute_maxwellian(allfequilibrium[my_ielec], 1.5, 0.8, 0.2);
+
+    // A perturbation which depends on x, v and the species
+    DFieldMemSpXVx allfperturbation(mesh);
+    DFieldMemSpXVx allfdistribu(mesh);
+    DFieldSpXVx const allfperturbation_field = get_field(allfperturbation);
+    DFieldSpXVx const allfdistribu_field = get_field(allfdistribu);
+    DConstFieldSpVx const allfequilibrium_field = get_const_field(allfequilibrium);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            mesh,
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+                double const v = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                double const amplitude = 0.01 * (1 + ddc::select<Species>(ispxvx).uid());
+                double const fequilibrium = allfequilibrium_field(IdxSpVx(ispxvx));
+                allfperturbation_field(ispxvx)
+                        = amplitude * Kokkos::cos(x) * (1. + 0.5 * v) * fequilibrium;
+                allfdistribu_field(ispxvx) = fequilibrium + allfperturbation_field(ispxvx);
+            });
+
+    DFieldMemVx const quadrature_coeffs
+            = trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(gridvx);
+    ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
+    DeltaFChargeDensityCalculator const deltaf_rhs(
+            rhs,
+            get_const_field(quadrature_coeffs),
+            get_const_field(allfequilibrium));
+
+    DFieldMemX rho(gridx);
+    DFieldMemX rho_deltaf(gridx);
+    rhs(get_field(rho), get_const_field(allfdistribu));
+    deltaf_rhs(get_field(rho_deltaf), get_const_field(allfperturbation));
+    auto rho_host = ddc::create_mirror_view_and_copy(get_field(rho));
+    auto rho_deltaf_host = ddc::create_mirror_view_and_copy(get_field(rho_deltaf));
+
+    for (IdxX const ix : gridx) {
+        EXPECT_NEAR(rho_deltaf_host(ix), rho_host(ix), 1e-12);
+    }
+}
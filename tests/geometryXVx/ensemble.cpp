@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "bsl_advection_xvx.hpp"
+#include "chargedensitycalculator.hpp"
+#include "ensemble_initialization.hpp"
+#include "ensemble_predcorr.hpp"
+#include "ensemble_qnsolver.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "geometry_ensemble.hpp"
+#include "ipoisson_solver.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "predcorr.hpp"
+#include "qnsolver.hpp"
+#include "quadrature.hpp"
+#include "species_info.hpp"
+#include "splitvlasovsolver.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+/// A Poisson solver which does nothing, the tests only use the charge density.
+class NullEnsemblePoissonSolver
+    : public IPoissonSolver<
+              IdxRangeX,
+              IdxRangeEnsX,
+              std::experimental::layout_right,
+              Kokkos::DefaultExecutionSpace::memory_space>
+{
+public:
+    field_type operator()(field_type phi, field_type) const override
+    {
+        return phi;
+    }
+
+    field_type operator()(field_type phi, vector_field_type, field_type) const override
+    {
+        return phi;
+    }
+};
+
+IdxRangeSpXVx init_mesh()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2. * M_PI);
+    IdxStepX const x_size(16);
+
+    CoordVx const vx_min(-6);
+    CoordVx const vx_max(6);
+    IdxStepVx const vx_size(40);
+
+    IdxStepSp const nb_kinspecies(2);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+    IdxSp const my_iion = idx_range_sp.front();
+    IdxSp const my_ielec = idx_range_sp.back();
+
+    // Creating mesh & supports
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+    IdxRangeX const gridx(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const gridvx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    charges(my_ielec) = -1.;
+    charges(my_iion) = 1.;
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpXVx(idx_range_sp, gridx, gridvx);
+}
+
+/// The perturbation amplitude of the electrons of a member.
+double member_amplitude(IdxEns const iens)
+{
+    return 0.1 * iens.uid();
+}
+
+/**
+ * Initialise a distribution function whose members share the equilibrium but have different
+ * perturbation amplitudes.
+ */
+void init_ensemble(DFieldSpEnsXVx const allfdistribu)
+{
+    IdxRangeSp const idx_range_sp = get_idx_range<Species>(allfdistribu);
+    IdxRangeEns const idx_range_ens = get_idx_range<GridEnsemble>(allfdistribu);
+    IdxSp const my_iion = idx_range_sp.front();
+    IdxSp const my_ielec = idx_range_sp.back();
+
+    IdxRangeEnsSpVx const
+            idx_range_ens_sp_vx(idx_range_ens, idx_range_sp, get_idx_range<GridVx>(allfdistribu));
+    DFieldMemEnsSpVx fequilibrium(idx_range_ens_sp_vx);
+    for (IdxEns const iens : idx_range_ens) {
+        for (IdxSp const isp : idx_range_sp) {
+            MaxwellianEquilibrium::compute_maxwellian(fequilibrium[iens][isp], 1., 1., 0.);
+        }
+    }
+    host_t<IFieldMemSp> perturb_mode(idx_range_sp);
+    host_t<DFieldMemEnsSp> perturb_amplitude(IdxRangeEnsSp(idx_range_ens, idx_range_sp));
+    perturb_mode(my_iion) = 1;
+    perturb_mode(my_ielec) = 1;
+    for (IdxEns const iens : idx_range_ens) {
+        perturb_amplitude(iens, my_iion) = 0.;
+        perturb_amplitude(iens, my_ielec) = member_amplitude(iens);
+    }
+
+    EnsembleSingleModePerturbInitialization const
+            init(get_const_field(fequilibrium),
+                 std::move(perturb_mode),
+                 std::move(perturb_amplitude));
+    init(allfdistribu);
+}
+
+/// Copy the distribution function of one member.
+void extract_member(
+        DFieldSpXVx const fdistribu_member,
+        DConstFieldSpEnsXVx const allfdistribu,
+        IdxEns const iens)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(fdistribu_member),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                fdistribu_member(ispxvx) = allfdistribu(iens, ispxvx);
+            });
+}
+
+} // namespace
+
+TEST(Ensemble, ChargeDensityMatchesSingleRuns)
+{
+    IdxRangeSpXVx const mesh_member = init_mesh();
+    IdxRangeX const gridx = get_idx_range<GridX>(mesh_member);
+    IdxRangeVx const gridvx = get_idx_range<GridVx>(mesh_member);
+    IdxRangeEns const idx_range_ens(IdxEns(0), IdxStepEns(3));
+
+    IdxRangeSpEnsXVx const mesh(get_idx_range<Species>(mesh_member), idx_range_ens, gridx, gridvx);
+    DFieldMemSpEnsXVx allfdistribu(mesh);
+    init_ensemble(get_field(allfdistribu));
+
+    DFieldMemVx const quadrature_coeffs
+            = trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(gridvx);
+    NullEnsemblePoissonSolver const poisson_solver;
+    EnsembleQNSolver const qn_solver(poisson_solver, get_const_field(quadrature_coeffs));
+
+    DFieldMemEnsX rho(IdxRangeEnsX(idx_range_ens, gridx));
+    qn_solver.compute_charge_density(get_field(rho), get_const_field(allfdistribu));
+    auto rho_host = ddc::create_mirror_view_and_copy(get_field(rho));
+
+    // Compare each member with a simulation of this member alone
+    ChargeDensityCalculator const single_rhs(get_const_field(quadrature_coeffs));
+    DFieldMemSpXVx fdistribu_member(mesh_member);
+    DFieldMemX rho_member(gridx);
+    for (IdxEns const iens : idx_range_ens) {
+        extract_member(get_field(fdistribu_member), get_const_field(allfdistribu), iens);
+        single_rhs(get_field(rho_member), get_const_field(fdistribu_member));
+        auto rho_member_host = ddc::create_mirror_view_and_copy(get_field(rho_member));
+
+        double const amplitude = member_amplitude(iens);
+        for (IdxX const ix : gridx) {
+            EXPECT_NEAR(rho_host(iens, ix), rho_member_host(ix), 1e-12);
+            // The ion and electron densities cancel out except for the perturbation
+            double const expected = -amplitude * std::cos(ddc::coordinate(ix));
+            EXPECT_NEAR(rho_host(iens, ix), expected, 1e-2);
+        }
+    }
+}
+
+#ifdef PERIODIC_RDIMX
+TEST(Ensemble, PredCorrMatchesSingleRuns)
+{
+    IdxRangeSpXVx const mesh_member = init_mesh();
+    IdxRangeX const gridx = get_idx_range<GridX>(mesh_member);
+    IdxRangeVx const gridvx = get_idx_range<GridVx>(mesh_member);
+    IdxRangeXVx const mesh_xvx(gridx, gridvx);
+    IdxRangeEns const idx_range_ens(IdxEns(0), IdxStepEns(3));
+    IdxRangeEnsXVx const mesh_ens_xvx(idx_range_ens, gridx, gridvx);
+
+    IdxRangeSpEnsXVx const mesh(get_idx_range<Species>(mesh_member), mesh_ens_xvx);
+    DFieldMemSpEnsXVx allfdistribu(mesh);
+    init_ensemble(get_field(allfdistribu));
+
+    double const dt = 0.1;
+    int const steps = 5;
+    DFieldMemVx const quadrature_coeffs
+            = trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(gridvx);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_min(ddc::coordinate(gridvx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_max(ddc::coordinate(gridvx.back()));
+
+    // Advance all the members at once
+    SplineXBuilderEns const builder_x_ens(mesh_ens_xvx);
+    SplineVxBuilderEns const builder_vx_ens(mesh_ens_xvx);
+    SplineXEvaluatorEns const spline_x_evaluator_ens(bv_x_min, bv_x_max);
+    SplineVxEvaluatorEns const spline_vx_evaluator_ens(bv_vx_min, bv_vx_max);
+    PreallocatableSplineInterpolatorXEns const
+            spline_x_interpolator_ens(builder_x_ens, spline_x_evaluator_ens);
+    PreallocatableSplineInterpolatorVxEns const
+            spline_vx_interpolator_ens(builder_vx_ens, spline_vx_evaluator_ens);
+    BslAdvectionEnsX const advection_x_ens(spline_x_interpolator_ens);
+    BslAdvectionEnsVx const advection_vx_ens(spline_vx_interpolator_ens);
+    FFTPoissonSolver<IdxRangeX, IdxRangeEnsX, Kokkos::DefaultExecutionSpace>
+            fft_poisson_solver_ens(gridx);
+    EnsembleQNSolver const poisson_ens(fft_poisson_solver_ens, get_const_field(quadrature_coeffs));
+    EnsemblePredCorr const predcorr_ens(advection_x_ens, advection_vx_ens, poisson_ens, 0);
+
+    // Advance one member with the single-run operators
+    SplineXBuilder const builder_x(mesh_xvx);
+    SplineVxBuilder const builder_vx(mesh_xvx);
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    SplineVxEvaluator const spline_vx_evaluator(bv_vx_min, bv_vx_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    BslAdvectionX const advection_x(spline_x_interpolator);
+    BslAdvectionVx const advection_vx(spline_vx_interpolator);
+    SplitVlasovSolver const vlasov(advection_x, advection_vx);
+    FFTPoissonSolver<IdxRangeX, IdxRangeX, Kokkos::DefaultExecutionSpace> fft_poisson_solver(
+            gridx);
+    ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
+    QNSolver const poisson(fft_poisson_solver, rhs);
+    PredCorr const predcorr(vlasov, poisson, 0);
+
+    // Keep the initial state of every member for the single runs
+    DFieldMemSpEnsXVx allfdistribu_init(mesh);
+    ddc::parallel_deepcopy(allfdistribu_init, allfdistribu);
+
+    predcorr_ens(get_field(allfdistribu), 0., dt, steps);
+    auto allfdistribu_host = ddc::create_mirror_view_and_copy(get_field(allfdistribu));
+
+    DFieldMemSpXVx fdistribu_member(mesh_member);
+    for (IdxEns const iens : idx_range_ens) {
+        extract_member(get_field(fdistribu_member), get_const_field(allfdistribu_init), iens);
+        predcorr(get_field(fdistribu_member), 0., dt, steps);
+        auto fdistribu_member_host = ddc::create_mirror_view_and_copy(get_field(fdistribu_member));
+
+        double max_error = 0.;
+        ddc::for_each(mesh_member, [&](IdxSpXVx const ispxvx) {
+            max_error = std::max(
+                    max_error,
+                    std::fabs(allfdistribu_host(iens, ispxvx) - fdistribu_member_host(ispxvx)));
+        });
+        EXPECT_LE(max_error, 1e-12);
+    }
+}
+#endif
@@ -167,3 +167,115 @@ TEST_P(LagrangeTestFixture, InterpolationError)
 }
 
 INSTANTIATE_TEST_SUITE_P(DegMesh, LagrangeTestFixture, ::testing::Values(3, 4, 5, 6, 7, 8, 9));
+
+namespace {
+
+struct ZU
+{
+    static bool constexpr PERIODIC = false;
+};
+
+struct GridZU : UniformGridBase<ZU>
+{
+};
+
+struct GridZL : UniformGridBase<ZU>
+{
+};
+
+struct GridBatch
+{
+};
+
+} // namespace
+
+TEST(LagrangeUniformBatched, ExactPolynomial)
+{
+    using IdxRangeBZ = IdxRange<GridBatch, GridZU>;
+    using IdxBZ = Idx<GridBatch, GridZU>;
+    int const deg = 3;
+    Coord<ZU> const z_min(-1.);
+    Coord<ZU> const z_max(1.);
+    IdxStep<GridZU> const z_ncells(40);
+    ddc::init_discrete_space<GridZU>(GridZU::init<GridZU>(z_min, z_max, z_ncells + 1));
+    IdxRange<GridZU> const idx_range_z(Idx<GridZU>(0), z_ncells + 1);
+    IdxRange<GridBatch> const idx_range_batch(Idx<GridBatch>(0), IdxStep<GridBatch>(5));
+    IdxRangeBZ const idx_range(idx_range_batch, idx_range_z);
+
+    auto f = [](int ib, double z) { return (ib + 1) * z * z * z - z; };
+
+    host_t<DFieldMem<IdxRangeBZ>> values_host(idx_range);
+    host_t<FieldMem<Coord<ZU>, IdxRangeBZ>> coords_host(idx_range);
+    ddc::for_each(idx_range, [&](IdxBZ const ibz) {
+        int const ib = (ddc::select<GridBatch>(ibz) - idx_range_batch.front()).value();
+        double const z = ddc::coordinate(ddc::select<GridZU>(ibz));
+        values_host(ibz) = f(ib, z);
+        // Shift the points by a fraction of a cell, staying inside the domain
+        coords_host(ibz) = Coord<ZU>(Kokkos::min(z + 0.37 * ddc::step<GridZU>(), double(z_max)));
+    });
+
+    auto values = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(values_host));
+    auto coords = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(coords_host));
+
+    LagrangeInterpolator<GridZU, BCond::DIRICHLET, BCond::DIRICHLET, GridBatch, GridZU>
+            interpolator(deg, IdxStep<GridZU>(0));
+    interpolator(get_field(values), get_const_field(coords));
+    ddc::parallel_deepcopy(values_host, values);
+
+    double max_error = 0.;
+    ddc::for_each(idx_range, [&](IdxBZ const ibz) {
+        int const ib = (ddc::select<GridBatch>(ibz) - idx_range_batch.front()).value();
+        max_error = std::max(max_error, std::abs(values_host(ibz) - f(ib, coords_host(ibz))));
+    });
+    EXPECT_LE(max_error, 1e-13);
+}
+
+TEST(LagrangeUniformBatched, LongLine)
+{
+    using IdxRangeBZ = IdxRange<GridBatch, GridZL>;
+    using IdxBZ = Idx<GridBatch, GridZL>;
+    int const deg = 3;
+    Coord<ZU> const z_min(-1.);
+    Coord<ZU> const z_max(1.);
+    // A line of more than 4096 doubles does not fit in the level 0 scratch memory of a team
+    IdxStep<GridZL> const z_ncells(6000);
+    ddc::init_discrete_space<GridZL>(GridZL::init<GridZL>(z_min, z_max, z_ncells + 1));
+    IdxRange<GridZL> const idx_range_z(Idx<GridZL>(0), z_ncells + 1);
+    IdxRange<GridBatch> const idx_range_batch(Idx<GridBatch>(0), IdxStep<GridBatch>(2));
+    IdxRangeBZ const idx_range(idx_range_batch, idx_range_z);
+
+    auto f = [](int ib, double z) { return (ib + 1) * z * z * z - z; };
+
+    host_t<DFieldMem<IdxRangeBZ>> values_host(idx_range);
+    host_t<FieldMem<Coord<ZU>, IdxRangeBZ>> coords_host(idx_range);
+    ddc::for_each(idx_range, [&](IdxBZ const ibz) {
+        int const ib = (ddc::select<GridBatch>(ibz) - idx_range_batch.front()).value();
+        double const z = ddc::coordinate(ddc::select<GridZL>(ibz));
+        values_host(ibz) = f(ib, z);
+        // Shift the points by a fraction of a cell, staying inside the domain
+        coords_host(ibz) = Coord<ZU>(Kokkos::min(z + 0.37 * ddc::step<GridZL>(), double(z_max)));
+    });
+
+    auto values = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(values_host));
+    auto coords = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(coords_host));
+
+    LagrangeInterpolator<GridZL, BCond::DIRICHLET, BCond::DIRICHLET, GridBatch, GridZL>
+            interpolator(deg, IdxStep<GridZL>(0));
+    interpolator(get_field(values), get_const_field(coords));
+    ddc::parallel_deepcopy(values_host, values);
+
+    double max_error = 0.;
+    ddc::for_each(idx_range, [&](IdxBZ const ibz) {
+        int const ib = (ddc::select<GridBatch>(ibz) - idx_range_batch.front()).value();
+        max_error = std::max(max_error, std::abs(values_host(ibz) - f(ib, coords_host(ibz))));
+    });
+    EXPECT_LE(max_error, 1e-13);
+}
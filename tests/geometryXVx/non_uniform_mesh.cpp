@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <paraconf.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "input.hpp"
+
+// This file is compiled with NON_UNIFORM_BSPLINES_X and NON_UNIFORM_BSPLINES_VX defined
+static_assert(!BSplinesX::is_uniform());
+static_assert(!BSplinesVx::is_uniform());
+
+TEST(NonUniformMesh, InitFromInput)
+{
+    PC_tree_t conf = PC_parse_string(R"(
+SplineMesh:
+  x_mesh_type: tanh
+  x_min: 0.0
+  x_max: 1.0
+  x_ncells: 16
+  x_stretching: 2.0
+  vx_mesh_type: piecewise
+  vx_zones: [-6.0, -1.0, 1.0, 6.0]
+  vx_zones_ncells: [4, 8, 4]
+)");
+    IdxRangeX const gridx
+            = init_spline_dependent_idx_range<GridX, BSplinesX, SplineInterpPointsX>(conf, "x");
+    IdxRangeVx const gridvx
+            = init_spline_dependent_idx_range<GridVx, BSplinesVx, SplineInterpPointsVx>(
+                    conf,
+                    "vx");
+    PC_tree_destroy(&conf);
+
+    EXPECT_EQ(ddc::discrete_space<BSplinesX>().ncells(), 16);
+    EXPECT_DOUBLE_EQ(ddc::discrete_space<BSplinesX>().rmin(), 0.0);
+    EXPECT_DOUBLE_EQ(ddc::discrete_space<BSplinesX>().rmax(), 1.0);
+    EXPECT_EQ(ddc::discrete_space<BSplinesVx>().ncells(), 16);
+    EXPECT_DOUBLE_EQ(ddc::discrete_space<BSplinesVx>().rmin(), -6.0);
+    EXPECT_DOUBLE_EQ(ddc::discrete_space<BSplinesVx>().rmax(), 6.0);
+
+    // The interpolation points are sorted and lie inside the domain
+    for (IdxX const ix : gridx.remove_first(IdxStepX(1))) {
+        EXPECT_GT(ddc::coordinate(ix), ddc::coordinate(ix - 1));
+    }
+    EXPECT_GE(ddc::coordinate(gridx.front()), 0.0);
+    EXPECT_LE(ddc::coordinate(gridx.back()), 1.0);
+    for (IdxVx const ivx : gridvx.remove_first(IdxStepVx(1))) {
+        EXPECT_GT(ddc::coordinate(ivx), ddc::coordinate(ivx - 1));
+    }
+    EXPECT_DOUBLE_EQ(ddc::coordinate(gridvx.front()), -6.0);
+    EXPECT_DOUBLE_EQ(ddc::coordinate(gridvx.back()), 6.0);
+
+    // The splines reproduce a function of their approximation space exactly
+    SplineXBuilder_1d const builder_x(gridx);
+#ifdef PERIODIC_RDIMX
+    ddc::PeriodicExtrapolationRule<X> extrapolation_rule_min;
+    ddc::PeriodicExtrapolationRule<X> extrapolation_rule_max;
+    double const slope = 0.;
+#else
+    ddc::ConstantExtrapolationRule<X> extrapolation_rule_min(CoordX(0.0));
+    ddc::ConstantExtrapolationRule<X> extrapolation_rule_max(CoordX(1.0));
+    double const slope = 2.;
+#endif
+    SplineXEvaluator_1d const evaluator_x(extrapolation_rule_min, extrapolation_rule_max);
+
+    DFieldMemX values_alloc(gridx);
+    DFieldX const values = get_field(values_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            gridx,
+            KOKKOS_LAMBDA(IdxX const ix) { values(ix) = slope * ddc::coordinate(ix) + 1.; });
+    DFieldMem<IdxRange<BSplinesX>> coefs(builder_x.batched_spline_domain());
+    builder_x(get_field(coefs), get_const_field(values));
+
+    // Evaluate away from the interpolation points
+    FieldMem<CoordX, IdxRangeX> coords_alloc(gridx);
+    Field<CoordX, IdxRangeX> const coords = get_field(coords_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            gridx,
+            KOKKOS_LAMBDA(IdxX const ix) {
+                coords(ix) = CoordX(0.5 * ddc::coordinate(ix) + 0.3);
+            });
+    DFieldMemX evaluated_alloc(gridx);
+    evaluator_x(get_field(evaluated_alloc), get_const_field(coords_alloc), get_const_field(coefs));
+    auto evaluated = ddc::create_mirror_view_and_copy(get_field(evaluated_alloc));
+    for (IdxX const ix : gridx) {
+        double const x = 0.5 * ddc::coordinate(ix) + 0.3;
+        EXPECT_NEAR(evaluated(ix), slope * x + 1., 1e-12);
+    }
+}
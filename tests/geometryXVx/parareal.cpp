@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "geometry.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "parareal.hpp"
+#include "predcorr.hpp"
+#include "singlemodeperturbinitialization.hpp"
+#include "species_info.hpp"
+#include "xvx_solvers.hpp"
+
+namespace {
+
+/// A time solver which leaves the distribution function unchanged.
+class NullTimeSolver : public ITimeSolver
+{
+public:
+    DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double, double, int) const override
+    {
+        return allfdistribu;
+    }
+};
+
+IdxRangeSpXVx init_mesh()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(4. * M_PI);
+    IdxStepX const x_size(16);
+
+    CoordVx const vx_min(-6);
+    CoordVx const vx_max(6);
+    IdxStepVx const vx_size(32);
+
+    IdxStepSp const nb_kinspecies(2);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+    IdxSp const my_iion = idx_range_sp.front();
+    IdxSp const my_ielec = idx_range_sp.back();
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+    IdxRangeX const gridx(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const gridvx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    charges(my_ielec) = -1.;
+    charges(my_iion) = 1.;
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpXVx(idx_range_sp, gridx, gridvx);
+}
+
+void init_landau(DFieldSpXVx const allfdistribu)
+{
+    IdxRangeSp const idx_range_sp = get_idx_range<Species>(allfdistribu);
+    IdxRangeSpVx const idx_range_sp_vx(idx_range_sp, get_idx_range<GridVx>(allfdistribu));
+    DFieldMemSpVx allfequilibrium(idx_range_sp_vx);
+    for (IdxSp const isp : idx_range_sp) {
+        MaxwellianEquilibrium::compute_maxwellian(get_field(allfequilibrium)[isp], 1., 1., 0.);
+    }
+    host_t<IFieldMemSp> perturb_mode(idx_range_sp);
+    host_t<DFieldMemSp> perturb_amplitude(idx_range_sp);
+    perturb_mode(idx_range_sp.front()) = 0;
+    perturb_mode(idx_range_sp.back()) = 1;
+    perturb_amplitude(idx_range_sp.front()) = 0.;
+    perturb_amplitude(idx_range_sp.back()) = 0.1;
+    SingleModePerturbInitialization const
+            init(get_const_field(allfequilibrium),
+                 std::move(perturb_mode),
+                 std::move(perturb_amplitude));
+    init(allfdistribu);
+}
+
+} // namespace
+
+TEST(Parareal, MatchesSerialPredCorr)
+{
+    IdxRangeSpXVx const mesh = init_mesh();
+    IdxRangeXVx const mesh_xvx(mesh);
+
+    XVxSolverConfiguration const configuration = admissible_configurations().front();
+    XVxSolvers const solvers(configuration, mesh_xvx);
+    PredCorr const predcorr(solvers.vlasov_solver(), solvers.qn_solver(), 0);
+
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    int const coarse_ratio = 2;
+    int const steps = 4 * coarse_ratio * comm_size;
+    double const dt = 0.05;
+
+    DFieldMemSpXVx allfdistribu_serial(mesh);
+    init_landau(get_field(allfdistribu_serial));
+    predcorr(get_field(allfdistribu_serial), 0., dt, steps);
+
+    // After as many iterations as time slices the Parareal solution is the fine solution
+    DFieldMemSpXVx allfdistribu_parareal(mesh);
+    init_landau(get_field(allfdistribu_parareal));
+    Parareal const parareal(predcorr, predcorr, MPI_COMM_WORLD, coarse_ratio, comm_size, 1e-14);
+    parareal(get_field(allfdistribu_parareal), 0., dt, steps);
+
+    auto allfdistribu_serial_host
+            = ddc::create_mirror_view_and_copy(get_field(allfdistribu_serial));
+    auto allfdistribu_parareal_host
+            = ddc::create_mirror_view_and_copy(get_field(allfdistribu_parareal));
+    double max_error = 0.;
+    ddc::for_each(mesh, [&](IdxSpXVx const ispxvx) {
+        max_error = std::max(
+                max_error,
+                std::abs(allfdistribu_parareal_host(ispxvx) - allfdistribu_serial_host(ispxvx)));
+    });
+    EXPECT_LE(max_error, 1e-12);
+}
+
+TEST(Parareal, InvalidArguments)
+{
+    NullTimeSolver const solver;
+    EXPECT_THROW(Parareal(solver, solver, MPI_COMM_WORLD, 0, 2, 1e-10), std::invalid_argument);
+    EXPECT_THROW(Parareal(solver, solver, MPI_COMM_WORLD, 2, 0, 1e-10), std::invalid_argument);
+
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    Parareal const parareal(solver, solver, MPI_COMM_WORLD, 2, 2, 1e-10);
+    // The number of steps is not a multiple of the number of time slices
+    if (comm_size > 1) {
+        EXPECT_THROW(parareal(DFieldSpXVx(), 0., 0.1, 2 * comm_size + 1), std::invalid_argument);
+    }
+    // The number of steps in each time slice is not a multiple of the coarse ratio
+    EXPECT_THROW(parareal(DFieldSpXVx(), 0., 0.1, 3 * comm_size), std::invalid_argument);
+}
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "phase_space_tile_map.hpp"
+
+namespace {
+
+int count_active_points(PhaseSpaceTileMap::View const active_tiles, IdxRangeSpXVx const& mesh)
+{
+    return ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            mesh,
+            0,
+            ddc::reducer::sum<int>(),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                return active_tiles.is_active(ispxvx) ? 1 : 0;
+            });
+}
+
+int count_active_tiles(ConstField<bool, PhaseSpaceTileMap::IdxRangeSpXVxTile> const active)
+{
+    return ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(active),
+            0,
+            ddc::reducer::sum<int>(),
+            KOKKOS_LAMBDA(PhaseSpaceTileMap::IdxSpXVxTile const itile) {
+                return active(itile) ? 1 : 0;
+            });
+}
+
+} // namespace
+
+TEST(PhaseSpaceTileMap, Dilation)
+{
+    using GridVxTile = PhaseSpaceTileMap::GridVxTile;
+    using IdxRangeSpXVxTile = PhaseSpaceTileMap::IdxRangeSpXVxTile;
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+    IdxRangeX const gridx(IdxX(0), IdxStepX(10));
+    IdxRangeVx const gridvx(IdxVx(0), IdxStepVx(60));
+    IdxRangeSpXVx const mesh(idx_range_sp, gridx, gridvx);
+
+    int const tile_size = 8;
+    IdxRangeSpXVxTile const tile_idx_range(
+            idx_range_sp,
+            gridx,
+            IdxRange<GridVxTile>(Idx<GridVxTile>(0), IdxStep<GridVxTile>(8)));
+
+    // A default View considers all the points as active
+    EXPECT_EQ(count_active_points(PhaseSpaceTileMap::View(), mesh), int(mesh.size()));
+
+    // Only the tile 2 of the line (0, 5) is occupied
+    host_t<FieldMem<bool, IdxRangeSpXVxTile>> occupied_host(tile_idx_range);
+    ddc::for_each(tile_idx_range, [&](PhaseSpaceTileMap::IdxSpXVxTile const itile) {
+        occupied_host(itile) = ddc::select<Species>(itile) == IdxSp(0)
+                               && ddc::select<GridX>(itile) == IdxX(5)
+                               && ddc::select<GridVxTile>(itile) == Idx<GridVxTile>(2);
+    });
+    FieldMem<bool, IdxRangeSpXVxTile> occupied(tile_idx_range);
+    ddc::parallel_deepcopy(occupied, occupied_host);
+    FieldMem<bool, IdxRangeSpXVxTile> active(tile_idx_range);
+
+    PhaseSpaceTileMap::dilate(get_field(active), get_const_field(occupied), 1, 1);
+
+    // The tiles 1 to 3 of the lines 4 to 6 of the first species are active
+    PhaseSpaceTileMap::View const active_tiles(get_const_field(active), gridvx, tile_size);
+    EXPECT_EQ(count_active_tiles(get_const_field(active)), 9);
+    EXPECT_EQ(count_active_points(active_tiles, mesh), 9 * tile_size);
+
+    // Without a halo only the occupied tile is active
+    PhaseSpaceTileMap::dilate(get_field(active), get_const_field(occupied), 0, 0);
+    EXPECT_EQ(count_active_tiles(get_const_field(active)), 1);
+    EXPECT_EQ(count_active_points(active_tiles, mesh), tile_size);
+
+    // The last tile is truncated to the velocity grid
+    IdxRangeVx const last_tile = active_tiles.tile_idx_range(Idx<GridVxTile>(7));
+    EXPECT_EQ(last_tile.front(), IdxVx(56));
+    EXPECT_EQ(last_tile.size(), 4u);
+}
@@ -0,0 +1,59 @@
+#!/bin/bash
+set -xe
+
+if [ $# -ne 5 ]
+then
+    echo "Usage: $0 <VOICEXX_SRCDIR> <VOICEXX_EXEC> <PYTHON3_EXE> <MPIEXEC> <MPIEXEC_NUMPROC_FLAG>"
+    exit 1
+fi
+VOICEXX_SRCDIR="$1"
+VOICEXX_EXEC="$2"
+PYTHON3_EXE="$3"
+MPIEXEC="$4"
+MPIEXEC_NUMPROC_FLAG="$5"
+
+TMPDIR="$(mktemp -p "${PWD}" -d run-XXXXXXXXXX)"
+function finish {
+  rm -rf "${TMPDIR}"
+}
+trap finish EXIT QUIT ABRT KILL SEGV TERM STOP
+
+cd "${TMPDIR}"
+
+# Small sheath simulation with the sources and the collisions
+"${VOICEXX_EXEC}" "--dump-config" "${TMPDIR}/sheath_small.yaml"
+sed -i 's/^  x_ncells: .*/  x_ncells: 16/' sheath_small.yaml
+sed -i 's/^  vx_ncells: .*/  vx_ncells: 16/' sheath_small.yaml
+sed -i 's/^  nbiter: .*/  nbiter: 4/' sheath_small.yaml
+sed -i 's/^  deltat: .*/  deltat: 0.125/' sheath_small.yaml
+sed -i 's/^  time_diag: .*/  time_diag: 0.25/' sheath_small.yaml
+
+# Reference simulation with the predictor-corrector scheme
+PREDCORRDIR="${TMPDIR}/predcorr"
+mkdir "${PREDCORRDIR}"
+cd "${PREDCORRDIR}"
+cp "${TMPDIR}/sheath_small.yaml" sheath.yaml
+sed -i 's/^  time_integrator: .*/  time_integrator: predcorr/' sheath.yaml
+"${VOICEXX_EXEC}" "${PWD}/sheath.yaml"
+
+# Same simulation with Parareal on 2 time slices. With as many iterations as time slices
+# Parareal reproduces the fine solver up to rounding errors.
+PARAREALDIR="${TMPDIR}/parareal"
+mkdir "${PARAREALDIR}"
+cd "${PARAREALDIR}"
+cp "${TMPDIR}/sheath_small.yaml" sheath.yaml
+sed -i 's/^  time_integrator: .*/  time_integrator: parareal/' sheath.yaml
+sed -i 's/^  coarse_ratio: .*/  coarse_ratio: 2/' sheath.yaml
+sed -i 's/^  max_iterations: .*/  max_iterations: 2/' sheath.yaml
+sed -i 's/^  tolerance: .*/  tolerance: 0./' sheath.yaml
+"${MPIEXEC}" "${MPIEXEC_NUMPROC_FLAG}" 2 "${VOICEXX_EXEC}" "${PWD}/sheath.yaml"
+
+${PYTHON3_EXE} ${VOICEXX_SRCDIR}/post-process/PythonScripts/compare_hdf5_results.py ${PARAREALDIR}/VOICEXX_00002.h5 ${PREDCORRDIR}/VOICEXX_00002.h5 electrostatic_potential -R 1e-10 -A 1e-12
+if [ $? -ne 0 ]; then
+    exit 1
+fi
+
+${PYTHON3_EXE} ${VOICEXX_SRCDIR}/post-process/PythonScripts/compare_hdf5_results.py ${PARAREALDIR}/VOICEXX_00002.h5 ${PREDCORRDIR}/VOICEXX_00002.h5 fdistribu -R 1e-10 -A 1e-12
+if [ $? -ne 0 ]; then
+    exit 1
+fi
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "geometry.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "species_info.hpp"
+#include "xvx_solver_autotuner.hpp"
+#include "xvx_solvers.hpp"
+
+namespace {
+
+IdxRangeSpXVx init_mesh()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(4. * M_PI);
+    IdxStepX const x_size(16);
+
+    CoordVx const vx_min(-6);
+    CoordVx const vx_max(6);
+    IdxStepVx const vx_size(32);
+
+    IdxStepSp const nb_kinspecies(2);
+    IdxRangeSp const idx_range_sp(IdxSp(0), nb_kinspecies);
+    IdxSp const my_iion = idx_range_sp.front();
+    IdxSp const my_ielec = idx_range_sp.back();
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_size);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_size);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+    IdxRangeX const gridx(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const gridvx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    charges(my_ielec) = -1.;
+    charges(my_iion) = 1.;
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    masses(my_ielec) = 1.;
+    masses(my_iion) = 400.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpXVx(idx_range_sp, gridx, gridvx);
+}
+
+} // namespace
+
+TEST(SolverSelection, AdmissibleConfigurations)
+{
+    std::vector<XVxSolverConfiguration> const configurations = admissible_configurations();
+    ASSERT_FALSE(configurations.empty());
+
+    // The reference uses splines in both directions
+    EXPECT_EQ(configurations.front().interpolator_x, InterpolatorChoice::Spline);
+    EXPECT_EQ(configurations.front().interpolator_vx, InterpolatorChoice::Spline);
+
+    for (XVxSolverConfiguration const& configuration : configurations) {
+        if (X::PERIODIC) {
+            EXPECT_EQ(configuration.interpolator_x, InterpolatorChoice::Spline);
+        } else {
+            EXPECT_EQ(configuration.poisson_solver, PoissonSolverChoice::FEM);
+        }
+    }
+    // Both Poisson solvers are available for periodic geometries and both interpolators
+    // otherwise so there are always 4 configurations
+    EXPECT_EQ(int(configurations.size()), 4);
+}
+
+TEST(SolverSelection, FromString)
+{
+    EXPECT_EQ(interpolator_choice_from_string("spline"), InterpolatorChoice::Spline);
+    EXPECT_EQ(interpolator_choice_from_string("lagrange"), InterpolatorChoice::Lagrange);
+    EXPECT_EQ(poisson_solver_choice_from_string("FFT"), PoissonSolverChoice::FFT);
+    EXPECT_EQ(poisson_solver_choice_from_string("FEM"), PoissonSolverChoice::FEM);
+    EXPECT_THROW(interpolator_choice_from_string("hermite"), std::runtime_error);
+    EXPECT_THROW(poisson_solver_choice_from_string("multigrid"), std::runtime_error);
+}
+
+TEST(SolverSelection, AutotunerSelectsFastestAccurate)
+{
+    IdxRangeXVx const mesh_xvx(IdxXVx(0, 0), IdxStepXVx(0, 0));
+    XVxSolverAutotuner const autotuner(mesh_xvx, 3, 4, 1e-3);
+
+    XVxSolverConfiguration const reference {
+            InterpolatorChoice::Spline,
+            InterpolatorChoice::Spline,
+            PoissonSolverChoice::FEM};
+    XVxSolverConfiguration const fast_inaccurate {
+            InterpolatorChoice::Spline,
+            InterpolatorChoice::Lagrange,
+            PoissonSolverChoice::FEM};
+    XVxSolverConfiguration const fast_accurate {
+            InterpolatorChoice::Lagrange,
+            InterpolatorChoice::Spline,
+            PoissonSolverChoice::FEM};
+
+    std::vector<XVxSolverTiming> timings {
+            {reference, 1.0, 0.},
+            {fast_inaccurate, 0.1, 1e-2},
+            {fast_accurate, 0.5, 1e-4}};
+    XVxSolverConfiguration const selected = autotuner.select(timings);
+    EXPECT_EQ(selected.interpolator_x, fast_accurate.interpolator_x);
+    EXPECT_EQ(selected.interpolator_vx, fast_accurate.interpolator_vx);
+    EXPECT_EQ(selected.poisson_solver, fast_accurate.poisson_solver);
+
+    // If no configuration is accurate enough the reference is kept
+    timings.pop_back();
+    XVxSolverConfiguration const fallback = autotuner.select(timings);
+    EXPECT_EQ(fallback.interpolator_vx, reference.interpolator_vx);
+}
+
+TEST(SolverSelection, BuildAdmissibleConfigurations)
+{
+    IdxRangeSpXVx const mesh = init_mesh();
+    IdxRangeXVx const mesh_xvx(mesh);
+    IdxRangeSpVx const mesh_sp_vx(mesh);
+
+    // A neutral plasma at equilibrium
+    DFieldMemSpVx allfequilibrium(mesh_sp_vx);
+    for (IdxSp const isp : get_idx_range<Species>(mesh)) {
+        MaxwellianEquilibrium::compute_maxwellian(get_field(allfequilibrium)[isp], 1., 1., 0.);
+    }
+    DFieldMemSpXVx allfdistribu(mesh);
+    DFieldMemX electrostatic_potential(get_idx_range<GridX>(mesh));
+    DFieldMemX electric_field(get_idx_range<GridX>(mesh));
+
+    std::vector<XVxSolverConfiguration> const configurations = admissible_configurations();
+    // The Lagrange interpolator can only be used along x if x is not periodic
+    bool const has_lagrange_x = std::any_of(
+            configurations.begin(),
+            configurations.end(),
+            [](XVxSolverConfiguration const& configuration) {
+                return configuration.interpolator_x == InterpolatorChoice::Lagrange;
+            });
+    EXPECT_EQ(has_lagrange_x, !X::PERIODIC);
+
+    for (XVxSolverConfiguration const& configuration : configurations) {
+        SCOPED_TRACE(to_string(configuration));
+        XVxSolvers const solvers(configuration, mesh_xvx);
+        EXPECT_EQ(solvers.configuration().interpolator_x, configuration.interpolator_x);
+        EXPECT_EQ(solvers.configuration().interpolator_vx, configuration.interpolator_vx);
+        EXPECT_EQ(solvers.configuration().poisson_solver, configuration.poisson_solver);
+
+        DFieldSpXVx const allfdistribu_proxy = get_field(allfdistribu);
+        DConstFieldSpVx const allfequilibrium_proxy = get_const_field(allfequilibrium);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                mesh,
+                KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                    allfdistribu_proxy(ispxvx) = allfequilibrium_proxy(IdxSpVx(ispxvx));
+                });
+
+        // The electric field of a neutral plasma vanishes
+        solvers.qn_solver()(
+                get_field(electrostatic_potential),
+                get_field(electric_field),
+                get_const_field(allfdistribu));
+        auto electric_field_host = ddc::create_mirror_view_and_copy(get_field(electric_field));
+        for (IdxX const ix : get_idx_range(electric_field_host)) {
+            EXPECT_NEAR(electric_field_host(ix), 0., 1e-12);
+        }
+
+        // The Vlasov solver can be applied and gives a finite distribution function
+        solvers.vlasov_solver()(get_field(allfdistribu), get_const_field(electric_field), 0.1);
+        auto allfdistribu_host = ddc::create_mirror_view_and_copy(get_field(allfdistribu));
+        ddc::for_each(mesh, [&](IdxSpXVx const ispxvx) {
+            EXPECT_TRUE(std::isfinite(allfdistribu_host(ispxvx)));
+        });
+    }
+}
+
+TEST(SolverSelection, InvalidConfigurationThrows)
+{
+    IdxRangeSpXVx const mesh = init_mesh();
+    IdxRangeXVx const mesh_xvx(mesh);
+
+    // The Lagrange interpolator cannot be used along a periodic x and the FFT solver cannot be
+    // used if x is not periodic
+    XVxSolverConfiguration const invalid_configuration {
+            X::PERIODIC ? InterpolatorChoice::Lagrange : InterpolatorChoice::Spline,
+            InterpolatorChoice::Spline,
+            X::PERIODIC ? PoissonSolverChoice::FEM : PoissonSolverChoice::FFT};
+    EXPECT_FALSE(is_admissible(invalid_configuration));
+    EXPECT_THROW(XVxSolvers(invalid_configuration, mesh_xvx), std::runtime_error);
+}
@@ -5,6 +5,7 @@
 #include "bsl_advection_x.hpp"
 #include "geometry.hpp"
 #include "spline_interpolator.hpp"
+#include "spline_solver_selection.hpp"
 
 
 
@@ -28,7 +29,7 @@ std::pair<IdxRange<GridX>, IdxRange<GridVx>> Init_idx_range_spatial_adv()
 }
 
 
-template <class Geometry, class GridX>
+template <class Geometry, class GridX, class ElementType = double>
 double SpatialAdvection(
         IAdvectionSpatial<Geometry, GridX> const& advection_x,
         IdxRange<GridX> idx_range_x,
@@ -53,20 +54,20 @@ double SpatialAdvection(
     // Initialization Species index range
     ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
     // Initialization of the distribution function
-    host_t<DFieldMemSpXVx> allfdistribu_host(meshSpXVx);
+    host_t<FieldMem<ElementType, IdxRangeSpXVx>> allfdistribu_host(meshSpXVx);
     ddc::for_each(meshSpXVx, [&](IdxSpXVx const ispxvx) {
         IdxX const ix = ddc::select<GridX>(ispxvx);
-        allfdistribu_host(ispxvx) = cos(ddc::coordinate(ix));
+        allfdistribu_host(ispxvx) = static_cast<ElementType>(cos(ddc::coordinate(ix)));
     });
 
     double const timestep = .1;
     std::vector<double> Error;
     Error.reserve(allfdistribu_host.size());
 
-    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    FieldMem<ElementType, IdxRangeSpXVx> allfdistribu(meshSpXVx);
 
     ddc::parallel_deepcopy(allfdistribu, allfdistribu_host);
-    advection_x(allfdistribu, timestep);
+    advection_x(get_field(allfdistribu), timestep);
     ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
 
     ddc::for_each(meshSpXVx, [&](IdxSpXVx const ispxvx) {
@@ -107,3 +108,108 @@ TEST(SpatialAdvection, SplineBatched)
             = SpatialAdvection<GeometryXVx, GridX>(spline_advection_x, idx_range_x, idx_range_vx);
     EXPECT_LE(err, 1.e-6);
 }
+
+TEST(SpatialAdvection, SplineBatchedFloatStorage)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_spatial_adv();
+    IdxRangeXVx meshXVx(idx_range_x, idx_range_vx);
+    SplineXBuilder const builder_x(meshXVx);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    BslAdvectionSpatial<GeometryXVx, GridX> const spline_advection_x(spline_x_interpolator);
+    // The advection is carried out block by block on the velocity dimension
+    double const err = SpatialAdvection<
+            GeometryXVx,
+            GridX,
+            float>(spline_advection_x, idx_range_x, idx_range_vx);
+    EXPECT_LE(err, 2.e-6);
+}
+
+TEST(SpatialAdvection, SplineBatchedGinkgo)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_spatial_adv();
+    IdxRangeXVx meshXVx(idx_range_x, idx_range_vx);
+    SplineXBuilderGinkgo const builder_x(meshXVx);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    BslAdvectionSpatial<GeometryXVx, GridX> const spline_advection_x(spline_x_interpolator);
+    double const err
+            = SpatialAdvection<GeometryXVx, GridX>(spline_advection_x, idx_range_x, idx_range_vx);
+    EXPECT_LE(err, 1.e-6);
+}
+
+TEST(SpatialAdvection, SplineSolverSelection)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_spatial_adv();
+    IdxRangeXVx meshXVx(idx_range_x, idx_range_vx);
+    SplineXBuilder const builder_x_lapack(meshXVx);
+    SplineXBuilderGinkgo const builder_x_ginkgo(meshXVx);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const lapack_interpolator(
+            builder_x_lapack,
+            spline_x_evaluator);
+    PreallocatableSplineInterpolator const ginkgo_interpolator(
+            builder_x_ginkgo,
+            spline_x_evaluator);
+
+    EXPECT_EQ(
+            &select_spline_interpolator(
+                    spline_solver_choice_from_string("LAPACK"),
+                    lapack_interpolator,
+                    ginkgo_interpolator,
+                    meshXVx),
+            &lapack_interpolator);
+    EXPECT_EQ(
+            &select_spline_interpolator(
+                    spline_solver_choice_from_string("GINKGO"),
+                    lapack_interpolator,
+                    ginkgo_interpolator,
+                    meshXVx),
+            &ginkgo_interpolator);
+    EXPECT_THROW(spline_solver_choice_from_string("CHOLESKY"), std::runtime_error);
+
+    // Only the chosen interpolator needs to be created
+    EXPECT_EQ(
+            &select_spline_interpolator(
+                    SplineSolverChoice::LAPACK,
+                    &lapack_interpolator,
+                    static_cast<decltype(&ginkgo_interpolator)>(nullptr),
+                    meshXVx),
+            &lapack_interpolator);
+    EXPECT_THROW(
+            select_spline_interpolator(
+                    SplineSolverChoice::GINKGO,
+                    &lapack_interpolator,
+                    static_cast<decltype(&ginkgo_interpolator)>(nullptr),
+                    meshXVx),
+            std::invalid_argument);
+    EXPECT_THROW(
+            select_spline_interpolator(
+                    SplineSolverChoice::Benchmark,
+                    static_cast<decltype(&lapack_interpolator)>(nullptr),
+                    &ginkgo_interpolator,
+                    meshXVx),
+            std::invalid_argument);
+
+    // The benchmark must choose one of the two interpolators and both give the same advection
+    IPreallocatableInterpolator<GridX, GridX, GridVx> const& fastest_interpolator
+            = select_spline_interpolator(
+                    SplineSolverChoice::Benchmark,
+                    lapack_interpolator,
+                    ginkgo_interpolator,
+                    meshXVx,
+                    2);
+    EXPECT_TRUE(
+            &fastest_interpolator == &lapack_interpolator
+            || &fastest_interpolator == &ginkgo_interpolator);
+    BslAdvectionSpatial<GeometryXVx, GridX> const spline_advection_x(fastest_interpolator);
+    double const err
+            = SpatialAdvection<GeometryXVx, GridX>(spline_advection_x, idx_range_x, idx_range_vx);
+    EXPECT_LE(err, 1.e-6);
+}
@@ -20,6 +20,8 @@ class MockAdvectionX : public IAdvectionSpatial<GeometryXVx, GridX>
 public:
     MockAdvectionX() = default;
 
+    using IAdvectionSpatial<GeometryXVx, GridX>::operator();
+
     MOCK_METHOD((DField<IdxRange>), CallOp, ((DField<IdxRange>)allfdistribu, double dt), (const));
 
     DField<IdxRange> operator()(DField<IdxRange> const allfdistribu, double const dt) const override
@@ -36,6 +38,8 @@ class MockAdvectionVx : public IAdvectionVelocity<GeometryXVx, GridVx>
 public:
     MockAdvectionVx() = default;
 
+    using IAdvectionVelocity<GeometryXVx, GridVx>::operator();
+
     MOCK_METHOD(
             (DField<IdxRange>),
             CallOp,
@@ -5,6 +5,7 @@
 
 #include "Lagrange_interpolator.hpp"
 #include "bsl_advection_vx.hpp"
+#include "deltafadvectionvx.hpp"
 #include "geometry.hpp"
 #include "spline_interpolator.hpp"
 
@@ -132,3 +133,84 @@ TEST(VelocityAdvection, SplineBatched)
             GridVx>(spline_advection_vx, idx_range_x, idx_range_vx);
     EXPECT_LE(err, 1e-5);
 }
+
+TEST(VelocityAdvection, DeltaFSplineBatched)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_velocity_adv();
+    IdxRangeXVx meshXVx(idx_range_x, idx_range_vx);
+
+    SplineVxBuilder const builder_vx(meshXVx);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(vx_min);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(vx_max);
+    SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const spline_advection_vx(spline_vx_interpolator);
+
+    IdxStepSp const nb_species(2);
+    IdxRangeSp const idx_range_allsp(IdxSp(0), nb_species);
+    IdxSp const i_elec = idx_range_allsp.front();
+    IdxSp const i_ion = idx_range_allsp.back();
+    host_t<DFieldMemSp> masses_host(idx_range_allsp);
+    host_t<DFieldMemSp> charges_host(idx_range_allsp);
+    masses_host(i_elec) = 1.;
+    charges_host(i_elec) = -1.;
+    masses_host(i_ion) = 1.;
+    charges_host(i_ion) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
+
+    IdxRangeSpXVx const meshSpXVx(idx_range_allsp, idx_range_x, idx_range_vx);
+    IdxRangeSpVx const meshSpVx(idx_range_allsp, idx_range_vx);
+
+    host_t<DFieldMemSpVx> allfequilibrium_host(meshSpVx);
+    ddc::for_each(meshSpVx, [&](IdxSpVx const ispvx) {
+        double const v = ddc::coordinate(ddc::select<GridVx>(ispvx));
+        allfequilibrium_host(ispvx) = exp(-0.5 * v * v);
+    });
+    host_t<DFieldMemSpXVx> allfdistribu_host(meshSpXVx);
+    host_t<DFieldMemSpXVx> alldeltaf_host(meshSpXVx);
+    ddc::for_each(meshSpXVx, [&](IdxSpXVx const ispxvx) {
+        double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+        alldeltaf_host(ispxvx) = 1e-3 * cos(x) * allfequilibrium_host(IdxSpVx(ispxvx));
+        allfdistribu_host(ispxvx) = allfequilibrium_host(IdxSpVx(ispxvx)) + alldeltaf_host(ispxvx);
+    });
+    host_t<DFieldMemX> electric_field_host(idx_range_x);
+    ddc::for_each(idx_range_x, [&](IdxX const ix) {
+        electric_field_host(ix) = sin(ddc::coordinate(ix));
+    });
+
+    DFieldMemSpVx allfequilibrium(meshSpVx);
+    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    DFieldMemSpXVx alldeltaf(meshSpXVx);
+    DFieldMemX electric_field(idx_range_x);
+    ddc::parallel_deepcopy(allfequilibrium, allfequilibrium_host);
+    ddc::parallel_deepcopy(allfdistribu, allfdistribu_host);
+    ddc::parallel_deepcopy(alldeltaf, alldeltaf_host);
+    ddc::parallel_deepcopy(electric_field, electric_field_host);
+
+    SplineSpVxBuilder const builder_spvx(meshSpVx);
+    SplineSpVxEvaluator const spline_spvx_evaluator(bv_v_min, bv_v_max);
+    DeltaFAdvectionVelocity<GeometryXVx, GridVx, SplineSpVxBuilder, SplineSpVxEvaluator> const
+            deltaf_advection_vx(
+                    spline_advection_vx,
+                    builder_spvx,
+                    spline_spvx_evaluator,
+                    get_const_field(allfequilibrium));
+
+    double const timestep = .1;
+    spline_advection_vx(get_field(allfdistribu), get_const_field(electric_field), timestep);
+    deltaf_advection_vx(get_field(alldeltaf), get_const_field(electric_field), timestep);
+    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+    ddc::parallel_deepcopy(alldeltaf_host, alldeltaf);
+
+    // The perturbation added to the equilibrium must match the advected full distribution function
+    double const max_error = ddc::transform_reduce(
+            meshSpXVx,
+            0.0,
+            ddc::reducer::max<double>(),
+            [&](IdxSpXVx const ispxvx) {
+                return std::abs(
+                        allfdistribu_host(ispxvx) - allfequilibrium_host(IdxSpVx(ispxvx))
+                        - alldeltaf_host(ispxvx));
+            });
+    EXPECT_LE(max_error, 1e-13);
+}
@@ -0,0 +1,47 @@
+#!/bin/bash
+set -xe
+
+if [ $# -ne 4 ]
+then
+    echo "Usage: $0 <VOICEXX_SRCDIR> <VOICEXX_EXEC> <PYTHON3_EXE> <SIMULATION_NAME>"
+    exit 1
+fi
+VOICEXX_SRCDIR="$1"
+VOICEXX_EXEC="$2"
+PYTHON3_EXE="$3"
+SIMULATION_NAME="$4"
+
+TMPDIR="$(mktemp -p "${PWD}" -d run-XXXXXXXXXX)"
+function finish {
+  rm -rf "${TMPDIR}"
+}
+trap finish EXIT QUIT ABRT KILL SEGV TERM STOP
+
+cd "$(dirname "$0")"
+INPUT_LANDAU="${PWD}/landau_small.yaml"
+
+# Reference simulation with a double precision distribution function
+DOUBLEDIR="${TMPDIR}/double"
+mkdir "${DOUBLEDIR}"
+cd "${DOUBLEDIR}"
+cp ${INPUT_LANDAU} landau.yaml
+sed -i 's/^  float_storage: .*/  float_storage: false/' landau.yaml
+"${VOICEXX_EXEC}" "${PWD}/landau.yaml"
+
+# Same simulation with a single precision distribution function
+FLOATDIR="${TMPDIR}/float"
+mkdir "${FLOATDIR}"
+cd "${FLOATDIR}"
+cp ${INPUT_LANDAU} landau.yaml
+sed -i 's/^  float_storage: .*/  float_storage: true/' landau.yaml
+"${VOICEXX_EXEC}" "${PWD}/landau.yaml"
+
+${PYTHON3_EXE} ${VOICEXX_SRCDIR}/post-process/PythonScripts/compare_hdf5_results.py ${FLOATDIR}/VOICEXX_00002.h5 ${DOUBLEDIR}/VOICEXX_00002.h5 electrostatic_potential -R 1e-4 -A 1e-6
+if [ $? -ne 0 ]; then
+    exit 1
+fi
+
+${PYTHON3_EXE} ${VOICEXX_SRCDIR}/post-process/PythonScripts/compare_hdf5_results.py ${FLOATDIR}/VOICEXX_00002.h5 ${DOUBLEDIR}/VOICEXX_00002.h5 fdistribu -R 1e-4 -A 1e-6
+if [ $? -ne 0 ]; then
+    exit 1
+fi
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "lowranksplitvlasovsolver.hpp"
+#include "species_info.hpp"
+#include "tensortrain.hpp"
+#include "tensortrainchargedensitycalculator.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+IdxRangeSpXYVxVy init_lowrank_idx_range()
+{
+    // The discrete spaces can only be initialised once
+    static IdxRangeSpXYVxVy const idx_range = []() {
+        CoordX const x_min(0.0);
+        CoordX const x_max(2.0 * M_PI);
+        IdxStepX const x_ncells(32);
+        CoordY const y_min(0.0);
+        CoordY const y_max(2.0 * M_PI);
+        IdxStepY const y_ncells(32);
+        CoordVx const vx_min(-6.0);
+        CoordVx const vx_max(6.0);
+        IdxStepVx const vx_ncells(15);
+        CoordVy const vy_min(-6.0);
+        CoordVy const vy_max(6.0);
+        IdxStepVy const vy_ncells(15);
+
+        ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+        ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_ncells);
+        ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+        ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_ncells);
+        ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+        ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+        ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+        ddc::init_discrete_space<GridVy>(SplineInterpPointsVy::get_sampling<GridVy>());
+
+        IdxStepSp const nb_species(2);
+        IdxRangeSp const idx_range_sp(IdxSp(0), nb_species);
+        host_t<DFieldMemSp> masses(idx_range_sp);
+        host_t<DFieldMemSp> charges(idx_range_sp);
+        masses(idx_range_sp.front()) = 1.0;
+        charges(idx_range_sp.front()) = -1.0;
+        masses(idx_range_sp.back()) = 1.0;
+        charges(idx_range_sp.back()) = 1.0;
+        ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+        return IdxRangeSpXYVxVy(
+                idx_range_sp,
+                SplineInterpPointsX::get_domain<GridX>(),
+                SplineInterpPointsY::get_domain<GridY>(),
+                SplineInterpPointsVx::get_domain<GridVx>(),
+                SplineInterpPointsVy::get_domain<GridVy>());
+    }();
+    return idx_range;
+}
+
+/// A perturbed Maxwellian, advected in a uniform electric field (ex, ey) during a time t.
+double accelerated_solution(
+        IdxSpXYVxVy const ispxyvxvy,
+        double const t,
+        double const ex,
+        double const ey)
+{
+    // All the species have the same mass as the electrons
+    double const q = charge(ddc::select<Species>(ispxyvxvy));
+    double const x = ddc::coordinate(ddc::select<GridX>(ispxyvxvy));
+    double const y = ddc::coordinate(ddc::select<GridY>(ispxyvxvy));
+    double const vx = ddc::coordinate(ddc::select<GridVx>(ispxyvxvy));
+    double const vy = ddc::coordinate(ddc::select<GridVy>(ispxyvxvy));
+    // The feet of the characteristics at time 0
+    double const x0 = x - vx * t + 0.5 * q * ex * t * t;
+    double const y0 = y - vy * t + 0.5 * q * ey * t * t;
+    double const vx0 = vx - q * ex * t;
+    double const vy0 = vy - q * ey * t;
+    double const maxwellian = std::exp(-0.5 * (vx0 * vx0 + vy0 * vy0)) / (2.0 * M_PI);
+    return maxwellian * (1.0 + 0.1 * std::cos(x0) * std::cos(y0));
+}
+
+/// A perturbed Maxwellian, advected freely during a time t.
+double free_streaming_solution(IdxSpXYVxVy const ispxyvxvy, double const t)
+{
+    return accelerated_solution(ispxyvxvy, t, 0.0, 0.0);
+}
+
+TEST(LowRank, TensorTrainRoundTrip)
+{
+    IdxRangeSpXYVxVy const idx_range = init_lowrank_idx_range();
+    host_t<DFieldMemSpXYVxVy> allfdistribu(idx_range);
+    ddc::for_each(idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        allfdistribu(ispxyvxvy) = free_streaming_solution(ispxyvxvy, 0.0);
+    });
+
+    TensorTrainFdistribu const allfdistribu_tt(get_const_field(allfdistribu), 1e-12, 10);
+    for (IdxSp const isp : get_idx_range<Species>(allfdistribu)) {
+        for (int const rank : allfdistribu_tt.ranks(isp)) {
+            EXPECT_LE(rank, 2);
+        }
+    }
+    EXPECT_LT(allfdistribu_tt.size(), allfdistribu.size() / 100);
+
+    host_t<DFieldMemSpXYVxVy> allfdistribu_full(idx_range);
+    allfdistribu_tt.to_full(get_field(allfdistribu_full));
+    ddc::for_each(idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        EXPECT_NEAR(allfdistribu_full(ispxyvxvy), allfdistribu(ispxyvxvy), 1e-12);
+    });
+}
+
+TEST(LowRank, FreeStreaming)
+{
+    IdxRangeSpXYVxVy const idx_range = init_lowrank_idx_range();
+    host_t<DFieldMemSpXYVxVy> allfdistribu(idx_range);
+    ddc::for_each(idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        allfdistribu(ispxyvxvy) = free_streaming_solution(ispxyvxvy, 0.0);
+    });
+    TensorTrainFdistribu allfdistribu_tt(get_const_field(allfdistribu), 1e-10, 20);
+
+    IdxRangeXY const idx_range_xy(idx_range);
+    host_t<DFieldMemXY> electric_field(idx_range_xy);
+    ddc::parallel_fill(electric_field, 0.0);
+
+    LowRankSplitVlasovSolver const vlasov(IdxRangeXYVxVy {idx_range});
+    double const dt = 0.05;
+    int const nb_iter = 4;
+    for (int iter(0); iter < nb_iter; ++iter) {
+        vlasov(allfdistribu_tt,
+               get_const_field(electric_field),
+               get_const_field(electric_field),
+               dt);
+    }
+
+    allfdistribu_tt.to_full(get_field(allfdistribu));
+    double max_error = 0.0;
+    ddc::for_each(idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        double const exact = free_streaming_solution(ispxyvxvy, nb_iter * dt);
+        max_error = std::max(max_error, std::abs(allfdistribu(ispxyvxvy) - exact));
+    });
+    EXPECT_LE(max_error, 1e-3);
+}
+
+TEST(LowRank, UniformElectricField)
+{
+    IdxRangeSpXYVxVy const idx_range = init_lowrank_idx_range();
+    double const ex = 0.2;
+    double const ey = -0.1;
+    host_t<DFieldMemSpXYVxVy> allfdistribu(idx_range);
+    ddc::for_each(idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        allfdistribu(ispxyvxvy) = accelerated_solution(ispxyvxvy, 0.0, ex, ey);
+    });
+    TensorTrainFdistribu allfdistribu_tt(get_const_field(allfdistribu), 1e-10, 20);
+
+    IdxRangeXY const idx_range_xy(idx_range);
+    host_t<DFieldMemXY> electric_field_x(idx_range_xy);
+    host_t<DFieldMemXY> electric_field_y(idx_range_xy);
+    ddc::parallel_fill(electric_field_x, ex);
+    ddc::parallel_fill(electric_field_y, ey);
+
+    // The splitting is exact for a uniform electric field so only the interpolations and the
+    // truncations introduce errors
+    LowRankSplitVlasovSolver const vlasov(IdxRangeXYVxVy {idx_range});
+    double const dt = 0.05;
+    int const nb_iter = 4;
+    for (int iter(0); iter < nb_iter; ++iter) {
+        vlasov(allfdistribu_tt,
+               get_const_field(electric_field_x),
+               get_const_field(electric_field_y),
+               dt);
+    }
+    // The peak memory includes the cores and the workspace of the velocity advections
+    EXPECT_GT(vlasov.peak_memory_bytes(), allfdistribu_tt.size() * sizeof(double));
+
+    allfdistribu_tt.to_full(get_field(allfdistribu));
+    double max_error = 0.0;
+    ddc::for_each(idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        double const exact = accelerated_solution(ispxyvxvy, nb_iter * dt, ex, ey);
+        max_error = std::max(max_error, std::abs(allfdistribu(ispxyvxvy) - exact));
+    });
+    EXPECT_LE(max_error, 1e-3);
+}
+
+TEST(LowRank, ChargeDensity)
+{
+    IdxRangeSpXYVxVy const idx_range = init_lowrank_idx_range();
+    host_t<DFieldMemSpXYVxVy> allfdistribu(idx_range);
+    ddc::for_each(idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        double const scale = 1.0 + (ddc::select<Species>(ispxyvxvy) - IdxSp(0));
+        allfdistribu(ispxyvxvy) = scale * free_streaming_solution(ispxyvxvy, 0.3);
+    });
+    TensorTrainFdistribu const allfdistribu_tt(get_const_field(allfdistribu), 1e-12, 20);
+
+    IdxRangeVx const idx_range_vx(idx_range);
+    IdxRangeVy const idx_range_vy(idx_range);
+    host_t<FieldMemVx<double>> coeffs_vx(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultHostExecutionSpace>(idx_range_vx));
+    host_t<FieldMemVy<double>> coeffs_vy(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultHostExecutionSpace>(idx_range_vy));
+    TensorTrainChargeDensityCalculator const
+            rhs(get_const_field(coeffs_vx), get_const_field(coeffs_vy));
+
+    IdxRangeXY const idx_range_xy(idx_range);
+    host_t<DFieldMemXY> rho(idx_range_xy);
+    rhs(get_field(rho), allfdistribu_tt);
+
+    ddc::for_each(idx_range_xy, [&](IdxXY const ixy) {
+        double rho_ref = 0.0;
+        ddc::for_each(IdxRangeSpVxVy(idx_range), [&](Idx<Species, GridVx, GridVy> const ispvxvy) {
+            IdxVx const ivx = ddc::select<GridVx>(ispvxvy);
+            IdxVy const ivy = ddc::select<GridVy>(ispvxvy);
+            IdxSp const isp = ddc::select<Species>(ispvxvy);
+            rho_ref += charge(isp) * coeffs_vx(ivx) * coeffs_vy(ivy)
+                       * allfdistribu(IdxSpXYVxVy(isp, ixy, ivx, ivy));
+        });
+        EXPECT_NEAR(rho(ixy), rho_ref, 1e-11);
+    });
+}
+
+} // namespace
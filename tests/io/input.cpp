@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <paraconf.h>
+
+#include "ddc_aliases.hpp"
+#include "input.hpp"
+
+namespace {
+
+struct X
+{
+};
+
+struct GridX : NonUniformGridBase<X>
+{
+};
+
+using CoordX = Coord<X>;
+
+std::vector<CoordX> read_break_points_from_string(std::string const& yaml)
+{
+    PC_errhandler(PC_NULL_HANDLER);
+    PC_tree_t conf = PC_parse_string(yaml.c_str());
+    std::vector<CoordX> break_points;
+    try {
+        break_points = read_break_points<GridX>(conf, "x");
+    } catch (...) {
+        PC_tree_destroy(&conf);
+        throw;
+    }
+    PC_tree_destroy(&conf);
+    return break_points;
+}
+
+void check_increasing(std::vector<CoordX> const& break_points, CoordX min, CoordX max)
+{
+    ASSERT_GE(break_points.size(), std::size_t(2));
+    EXPECT_DOUBLE_EQ(break_points.front(), min);
+    EXPECT_DOUBLE_EQ(break_points.back(), max);
+    for (std::size_t i(1); i < break_points.size(); ++i) {
+        EXPECT_GT(break_points[i], break_points[i - 1]);
+    }
+}
+
+} // namespace
+
+TEST(ReadBreakPoints, DefaultIsUniform)
+{
+    std::vector<CoordX> const break_points = read_break_points_from_string(R"(
+SplineMesh:
+  x_min: -1.0
+  x_max: 3.0
+  x_ncells: 8
+)");
+    EXPECT_EQ(break_points.size(), std::size_t(9));
+    check_increasing(break_points, CoordX(-1.0), CoordX(3.0));
+    for (std::size_t i(0); i < break_points.size(); ++i) {
+        EXPECT_NEAR(break_points[i], -1.0 + 0.5 * i, 1e-14);
+    }
+}
+
+TEST(ReadBreakPoints, Stretched)
+{
+    std::vector<CoordX> const tanh_break_points = read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: tanh
+  x_min: 0.0
+  x_max: 10.0
+  x_ncells: 16
+  x_stretching: 2.0
+)");
+    EXPECT_EQ(tanh_break_points.size(), std::size_t(17));
+    check_increasing(tanh_break_points, CoordX(0.0), CoordX(10.0));
+
+    std::vector<CoordX> const geometric_break_points = read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: geometric
+  x_min: 0.0
+  x_max: 10.0
+  x_ncells: 16
+  x_ratio: 1.1
+)");
+    EXPECT_EQ(geometric_break_points.size(), std::size_t(17));
+    check_increasing(geometric_break_points, CoordX(0.0), CoordX(10.0));
+}
+
+TEST(ReadBreakPoints, Piecewise)
+{
+    std::vector<CoordX> const break_points = read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: piecewise
+  x_zones: [0.0, 1.0, 3.0]
+  x_zones_ncells: [4, 2]
+)");
+    EXPECT_EQ(break_points.size(), std::size_t(7));
+    check_increasing(break_points, CoordX(0.0), CoordX(3.0));
+    EXPECT_DOUBLE_EQ(break_points[4], 1.0);
+}
+
+TEST(ReadBreakPoints, UserBreakPoints)
+{
+    std::vector<CoordX> const break_points = read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: break_points
+  x_break_points: [0.0, 0.1, 0.5, 2.0]
+)");
+    EXPECT_EQ(break_points.size(), std::size_t(4));
+    check_increasing(break_points, CoordX(0.0), CoordX(2.0));
+    EXPECT_DOUBLE_EQ(break_points[2], 0.5);
+}
+
+TEST(ReadBreakPoints, BadInput)
+{
+    // Unknown mesh type
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: random
+  x_min: 0.0
+  x_max: 1.0
+  x_ncells: 4
+)"),
+                 std::runtime_error);
+    // Unsorted break points
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: break_points
+  x_break_points: [0.0, 0.5, 0.2, 2.0]
+)"),
+                 std::runtime_error);
+    // Not enough break points
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: break_points
+  x_break_points: [1.0]
+)"),
+                 std::runtime_error);
+    // Inverted bounds
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_min: 1.0
+  x_max: 0.0
+  x_ncells: 4
+)"),
+                 std::runtime_error);
+    // Non-positive stretching and ratio
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: tanh
+  x_min: 0.0
+  x_max: 1.0
+  x_ncells: 4
+  x_stretching: 0.0
+)"),
+                 std::runtime_error);
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: geometric
+  x_min: 0.0
+  x_max: 1.0
+  x_ncells: 4
+  x_ratio: -1.1
+)"),
+                 std::runtime_error);
+    // Missing number of cells
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_min: 0.0
+  x_max: 1.0
+)"),
+                 std::runtime_error);
+    // Inconsistent zones
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: piecewise
+  x_zones: [0.0, 1.0]
+  x_zones_ncells: [4, 2]
+)"),
+                 std::runtime_error);
+    EXPECT_THROW(read_break_points_from_string(R"(
+SplineMesh:
+  x_mesh_type: piecewise
+  x_zones: [0.0, 2.0, 1.0]
+  x_zones_ncells: [4, 2]
+)"),
+                 std::runtime_error);
+}
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "combination_technique.hpp"
+
+TEST(CombinationTechnique, Scheme2D)
+{
+    std::vector<CombinationComponent<2>> const components = combination_scheme<2>({2, 3}, 2);
+    // 3 grids with |l - l_min|_1 = 2 and 2 grids with |l - l_min|_1 = 1
+    ASSERT_EQ(components.size(), 5u);
+    int n_positive = 0;
+    for (CombinationComponent<2> const& component : components) {
+        int const level_sum = component.levels[0] - 2 + component.levels[1] - 3;
+        if (component.coefficient > 0) {
+            EXPECT_EQ(level_sum, 2);
+            EXPECT_DOUBLE_EQ(component.coefficient, 1.);
+            ++n_positive;
+        } else {
+            EXPECT_EQ(level_sum, 1);
+            EXPECT_DOUBLE_EQ(component.coefficient, -1.);
+        }
+    }
+    EXPECT_EQ(n_positive, 3);
+    EXPECT_EQ(components.front().ncells(1), 32);
+}
+
+TEST(CombinationTechnique, Scheme4DConsistency)
+{
+    std::vector<CombinationComponent<4>> const components = combination_scheme<4>({3, 3, 3, 3}, 4);
+    // The coefficients of a consistent combination sum to one
+    double coefficient_sum = 0.;
+    for (CombinationComponent<4> const& component : components) {
+        coefficient_sum += component.coefficient;
+    }
+    EXPECT_DOUBLE_EQ(coefficient_sum, 1.);
+    // 35 + 20 + 10 + 4 component grids
+    EXPECT_EQ(components.size(), 69u);
+}
+
+TEST(CombinationTechnique, CombineValues)
+{
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    int const component = get_combination_component(MPI_COMM_WORLD, comm_size);
+    // Each rank is a component with coefficient 0.5 and values (component, 1)
+    std::vector<double> const local_values {double(component), 1.};
+    std::vector<double> const combined
+            = combine_component_values(local_values, 0.5, MPI_COMM_WORLD);
+    EXPECT_DOUBLE_EQ(combined[0], 0.25 * comm_size * (comm_size - 1));
+    EXPECT_DOUBLE_EQ(combined[1], 0.5 * comm_size);
+}
+
+TEST(CombinationTechnique, WrongNumberOfRanks)
+{
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    // Exactly one rank per component grid is required
+    EXPECT_THROW(get_combination_component(MPI_COMM_WORLD, comm_size + 1), std::runtime_error);
+    if (comm_size > 1) {
+        EXPECT_THROW(get_combination_component(MPI_COMM_WORLD, comm_size - 1), std::runtime_error);
+    }
+}
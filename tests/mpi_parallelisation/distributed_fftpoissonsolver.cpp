@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "distributed_fft_poisson_solver.hpp"
+#include "vector_field_mem.hpp"
+
+namespace {
+
+template <int N>
+struct X
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+
+template <int N>
+struct Y
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+
+template <int N>
+struct GridX : UniformGridBase<X<N>>
+{
+};
+
+template <int N>
+struct GridY : UniformGridBase<Y<N>>
+{
+};
+
+/**
+ * Solve -Delta phi = 2 cos(x) cos(y) and compare the solution and its gradient with the exact
+ * values phi = cos(x) cos(y), E = (sin(x) cos(y), cos(x) sin(y)).
+ * The grid has x_points_per_rank (resp. y_points_per_rank) points per process along x (resp. y).
+ */
+template <int N, class Solver>
+void test_cosine_source(
+        typename Solver::RhoDistribution rho_distribution,
+        int x_points_per_rank,
+        int y_points_per_rank)
+{
+    using DimX = X<N>;
+    using DimY = Y<N>;
+    using GridXN = GridX<N>;
+    using GridYN = GridY<N>;
+    using IdxRangeXY = IdxRange<GridXN, GridYN>;
+    using IdxXY = Idx<GridXN, GridYN>;
+
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    Coord<DimX> const x_min(0.0);
+    Coord<DimX> const x_max(2.0 * M_PI);
+    IdxStep<GridXN> const x_size(x_points_per_rank * comm_size);
+    Coord<DimY> const y_min(0.0);
+    Coord<DimY> const y_max(2.0 * M_PI);
+    IdxStep<GridYN> const y_size(y_points_per_rank * comm_size);
+
+    ddc::init_discrete_space<GridXN>(GridXN::template init<GridXN>(x_min, x_max, x_size + 1));
+    ddc::init_discrete_space<GridYN>(GridYN::template init<GridYN>(y_min, y_max, y_size + 1));
+    IdxRange<GridXN> const gridx(Idx<GridXN>(0), x_size);
+    IdxRange<GridYN> const gridy(Idx<GridYN>(0), y_size);
+    IdxRangeXY const gridxy(gridx, gridy);
+
+    Solver const poisson(gridxy, MPI_COMM_WORLD, rho_distribution);
+
+    DFieldMem<IdxRangeXY> electrostatic_potential_alloc(gridxy);
+    VectorFieldMem<double, IdxRangeXY, NDTag<DimX, DimY>, ddc::DeviceAllocator<double>>
+            electric_field_alloc(gridxy);
+    DFieldMem<IdxRangeXY> rhs_alloc(gridxy);
+    DField<IdxRangeXY> const electrostatic_potential = get_field(electrostatic_potential_alloc);
+    DField<IdxRangeXY> const rhs = get_field(rhs_alloc);
+    VectorField electric_field = get_field(electric_field_alloc);
+
+    // Each process holds a share of the right-hand side if the contributions are summed
+    double const rhs_factor
+            = rho_distribution == Solver::RhoDistribution::PartialSum ? 1. / comm_size : 1.;
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            gridxy,
+            KOKKOS_LAMBDA(IdxXY const ixy) {
+                double const x = ddc::coordinate(ddc::select<GridXN>(ixy));
+                double const y = ddc::coordinate(ddc::select<GridYN>(ixy));
+                rhs(ixy) = rhs_factor * 2. * Kokkos::cos(x) * Kokkos::cos(y);
+            });
+
+    poisson(electrostatic_potential, electric_field, rhs);
+
+    DField<IdxRangeXY> const electric_field_x = electric_field.template get<DimX>();
+    DField<IdxRangeXY> const electric_field_y = electric_field.template get<DimY>();
+    double const error = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            gridxy,
+            0.,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxXY const ixy) {
+                double const x = ddc::coordinate(ddc::select<GridXN>(ixy));
+                double const y = ddc::coordinate(ddc::select<GridYN>(ixy));
+                double const error_pot = Kokkos::abs(
+                        electrostatic_potential(ixy) - Kokkos::cos(x) * Kokkos::cos(y));
+                double const error_field_x = Kokkos::abs(
+                        electric_field_x(ixy) - Kokkos::sin(x) * Kokkos::cos(y));
+                double const error_field_y = Kokkos::abs(
+                        electric_field_y(ixy) - Kokkos::cos(x) * Kokkos::sin(y));
+                return Kokkos::max(error_pot, Kokkos::max(error_field_x, error_field_y));
+            });
+    EXPECT_LE(error, 1e-12);
+}
+
+} // namespace
+
+TEST(DistributedFftPoissonSolver, ReplicatedRho)
+{
+    using Solver = DistributedFFTPoissonSolver<
+            IdxRange<GridX<0>, GridY<0>>,
+            IdxRange<GridX<0>, GridY<0>>,
+            Kokkos::DefaultExecutionSpace>;
+    test_cosine_source<0, Solver>(Solver::RhoDistribution::Replicated, 8, 4);
+}
+
+TEST(DistributedFftPoissonSolver, PartialSumRho)
+{
+    using Solver = DistributedFFTPoissonSolver<
+            IdxRange<GridX<1>, GridY<1>>,
+            IdxRange<GridX<1>, GridY<1>>,
+            Kokkos::DefaultExecutionSpace>;
+    test_cosine_source<1, Solver>(Solver::RhoDistribution::PartialSum, 8, 4);
+}
+
+TEST(DistributedFftPoissonSolver, NonPowerOfTwoSize)
+{
+    using Solver = DistributedFFTPoissonSolver<
+            IdxRange<GridX<2>, GridY<2>>,
+            IdxRange<GridX<2>, GridY<2>>,
+            Kokkos::DefaultExecutionSpace>;
+    // The lines are transformed one after the other instead of by the radix-2 kernel
+    test_cosine_source<2, Solver>(Solver::RhoDistribution::Replicated, 6, 3);
+}
+
+TEST(DistributedFftPoissonSolver, InvalidSize)
+{
+    using Solver = DistributedFFTPoissonSolver<
+            IdxRange<GridX<3>, GridY<3>>,
+            IdxRange<GridX<3>, GridY<3>>,
+            Kokkos::DefaultExecutionSpace>;
+    int comm_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    if (comm_size > 1) {
+        // The number of points along x is not a multiple of the number of processes
+        IdxRange<GridX<3>, GridY<3>> const gridxy(
+                IdxRange<GridX<3>>(Idx<GridX<3>>(0), IdxStep<GridX<3>>(4 * comm_size + 1)),
+                IdxRange<GridY<3>>(Idx<GridY<3>>(0), IdxStep<GridY<3>>(4 * comm_size)));
+        EXPECT_THROW(Solver(gridxy, MPI_COMM_WORLD), std::invalid_argument);
+    }
+}
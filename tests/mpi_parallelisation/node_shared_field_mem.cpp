@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "node_shared_field_mem.hpp"
+
+namespace {
+
+struct GridX
+{
+};
+struct GridY
+{
+};
+
+using IdxXY = Idx<GridX, GridY>;
+using IdxStepXY = IdxStep<GridX, GridY>;
+using IdxRangeXY = IdxRange<GridX, GridY>;
+
+double test_value(IdxXY const ixy)
+{
+    return 100 * ddc::select<GridX>(ixy).uid() + ddc::select<GridY>(ixy).uid();
+}
+
+} // namespace
+
+TEST(NodeSharedFieldMem, ComputeOnce)
+{
+    IdxRangeXY const idx_range(IdxXY(0, 0), IdxStepXY(10, 12));
+    NodeSharedFieldMem<double, IdxRangeXY> shared_alloc(idx_range, MPI_COMM_WORLD);
+
+    int n_calls = 0;
+    shared_alloc.compute_once([&](host_t<DField<IdxRangeXY>> const shared) {
+        ++n_calls;
+        ddc::for_each(get_idx_range(shared), [&](IdxXY const ixy) {
+            shared(ixy) = test_value(ixy);
+        });
+    });
+    EXPECT_EQ(n_calls, shared_alloc.is_writer() ? 1 : 0);
+
+    // Only one rank per node computes the values
+    int n_writers;
+    int const is_writer = shared_alloc.is_writer();
+    MPI_Allreduce(&is_writer, &n_writers, 1, MPI_INT, MPI_SUM, shared_alloc.node_communicator());
+    EXPECT_EQ(n_writers, 1);
+
+    // All the ranks of the node see the values computed by the writer
+    host_t<DConstField<IdxRangeXY>> const shared = get_const_field(shared_alloc);
+    ddc::for_each(idx_range, [&](IdxXY const ixy) {
+        EXPECT_DOUBLE_EQ(shared(ixy), test_value(ixy));
+    });
+}
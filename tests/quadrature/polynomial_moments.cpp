@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+#include <array>
+
+#include <ddc/ddc.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
+#include "polynomial_moments.hpp"
+#include "quadrature.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+struct Batch
+{
+};
+
+struct Vpar
+{
+    static bool constexpr PERIODIC = false;
+};
+
+struct Mu
+{
+    static bool constexpr PERIODIC = false;
+};
+
+using CoordBatch = Coord<Batch>;
+using CoordVpar = Coord<Vpar>;
+using CoordMu = Coord<Mu>;
+
+struct GridBatch : UniformGridBase<Batch>
+{
+};
+struct GridVpar : UniformGridBase<Vpar>
+{
+};
+struct GridMu : UniformGridBase<Mu>
+{
+};
+
+using IdxBatch = Idx<GridBatch>;
+using IdxBVparMu = Idx<GridBatch, GridVpar, GridMu>;
+
+using IdxStepBatch = IdxStep<GridBatch>;
+using IdxStepVpar = IdxStep<GridVpar>;
+using IdxStepMu = IdxStep<GridMu>;
+
+using IdxRangeBatch = IdxRange<GridBatch>;
+using IdxRangeVpar = IdxRange<GridVpar>;
+using IdxRangeMu = IdxRange<GridMu>;
+using IdxRangeVparMu = IdxRange<GridVpar, GridMu>;
+using IdxRangeBVparMu = IdxRange<GridBatch, GridVpar, GridMu>;
+
+using DFieldMemBatch = DFieldMem<IdxRangeBatch>;
+using DFieldBatch = DField<IdxRangeBatch>;
+using DFieldMemVparMu = DFieldMem<IdxRangeVparMu>;
+
+TEST(PolynomialMoments, MatchesBatchedQuadrature)
+{
+    CoordBatch b_min(1.0);
+    CoordBatch b_max(2.0);
+    IdxStepBatch b_ncells(4);
+    CoordVpar vpar_min(-10.0);
+    CoordVpar vpar_max(10.0);
+    IdxStepVpar vpar_ncells(128);
+    CoordMu mu_min(0.0);
+    CoordMu mu_max(12.0);
+    IdxStepMu mu_ncells(32);
+
+    IdxRangeBatch gridb = ddc::init_discrete_space<GridBatch>(
+            GridBatch::init<GridBatch>(b_min, b_max, b_ncells));
+    IdxRangeVpar gridvpar = ddc::init_discrete_space<GridVpar>(
+            GridVpar::init<GridVpar>(vpar_min, vpar_max, vpar_ncells));
+    IdxRangeMu gridmu
+            = ddc::init_discrete_space<GridMu>(GridMu::init<GridMu>(mu_min, mu_max, mu_ncells));
+    IdxRangeVparMu gridvparmu(gridvpar, gridmu);
+
+    DFieldMemVparMu quad_coeffs(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(gridvparmu));
+
+    constexpr std::size_t n_moments = 4;
+    PolynomialMoments<IdxRangeVparMu, IdxRangeBVparMu, n_moments> const moments(
+            get_const_field(quad_coeffs),
+            {{{0, 0}, {1, 0}, {2, 0}, {0, 1}}});
+    Quadrature<IdxRangeVparMu, IdxRangeBVparMu> const integrate(get_const_field(quad_coeffs));
+
+    auto function = KOKKOS_LAMBDA(IdxBVparMu ibv)
+    {
+        double const b = ddc::coordinate(ddc::select<GridBatch>(ibv));
+        double const vpar = ddc::coordinate(ddc::select<GridVpar>(ibv));
+        double const mu = ddc::coordinate(ddc::select<GridMu>(ibv));
+        return b * Kokkos::exp(-0.5 * (vpar - 0.5) * (vpar - 0.5) / b - mu);
+    };
+
+    std::array<DFieldMemBatch, n_moments> moments_alloc {
+            DFieldMemBatch(gridb),
+            DFieldMemBatch(gridb),
+            DFieldMemBatch(gridb),
+            DFieldMemBatch(gridb)};
+    std::array<DFieldBatch, n_moments> moments_res {
+            get_field(moments_alloc[0]),
+            get_field(moments_alloc[1]),
+            get_field(moments_alloc[2]),
+            get_field(moments_alloc[3])};
+    moments(Kokkos::DefaultExecutionSpace(), moments_res, function);
+
+    // Reference values calculated with one quadrature per moment
+    std::array<DFieldMemBatch, n_moments> reference_alloc {
+            DFieldMemBatch(gridb),
+            DFieldMemBatch(gridb),
+            DFieldMemBatch(gridb),
+            DFieldMemBatch(gridb)};
+    integrate(Kokkos::DefaultExecutionSpace(), get_field(reference_alloc[0]), function);
+    integrate(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(reference_alloc[1]),
+            KOKKOS_LAMBDA(IdxBVparMu ibv) {
+                double const vpar = ddc::coordinate(ddc::select<GridVpar>(ibv));
+                return vpar * function(ibv);
+            });
+    integrate(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(reference_alloc[2]),
+            KOKKOS_LAMBDA(IdxBVparMu ibv) {
+                double const vpar = ddc::coordinate(ddc::select<GridVpar>(ibv));
+                return vpar * vpar * function(ibv);
+            });
+    integrate(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(reference_alloc[3]),
+            KOKKOS_LAMBDA(IdxBVparMu ibv) {
+                double const mu = ddc::coordinate(ddc::select<GridMu>(ibv));
+                return mu * function(ibv);
+            });
+
+    for (std::size_t k(0); k < n_moments; ++k) {
+        auto moment_host = ddc::create_mirror_view_and_copy(get_field(moments_alloc[k]));
+        auto reference_host = ddc::create_mirror_view_and_copy(get_field(reference_alloc[k]));
+        ddc::for_each(gridb, [&](IdxBatch ib) {
+            EXPECT_NEAR(
+                    moment_host(ib),
+                    reference_host(ib),
+                    1e-12 * Kokkos::fabs(reference_host(ib)));
+        });
+    }
+
+    // Check the physical meaning of the moments: the mean velocity is 0.5 and the parallel
+    // temperature is b
+    auto density_host = ddc::create_mirror_view_and_copy(get_field(moments_alloc[0]));
+    auto momentum_host = ddc::create_mirror_view_and_copy(get_field(moments_alloc[1]));
+    auto energy_host = ddc::create_mirror_view_and_copy(get_field(moments_alloc[2]));
+    ddc::for_each(gridb, [&](IdxBatch ib) {
+        double const b = ddc::coordinate(ib);
+        double const mean_velocity = momentum_host(ib) / density_host(ib);
+        double const temperature
+                = energy_host(ib) / density_host(ib) - mean_velocity * mean_velocity;
+        EXPECT_NEAR(mean_velocity, 0.5, 1e-6);
+        EXPECT_NEAR(temperature, b, 1e-6);
+    });
+}
+
+} // namespace
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include "species_count_dispatch.hpp"
 #include "species_info.hpp"
 
 TEST(SpeciesInfo, Ielec)
@@ -23,3 +24,29 @@ TEST(SpeciesInfo, Ielec)
     ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
     EXPECT_EQ(my_ielec, ielec());
 }
+
+TEST(SpeciesInfo, SpeciesCountDispatch)
+{
+    for (std::size_t n_species(1); n_species <= max_static_species_count + 2; ++n_species) {
+        std::size_t dispatched_count = max_static_species_count + 10;
+        dispatch_species_count(n_species, [&](auto species_count) {
+            dispatched_count = decltype(species_count)::value;
+        });
+        if (n_species <= max_static_species_count) {
+            EXPECT_EQ(dispatched_count, n_species);
+        } else {
+            EXPECT_EQ(dispatched_count, dynamic_species_count);
+        }
+    }
+
+    IdxRangeSp const idx_range_sp(IdxSp(2), IdxStepSp(3));
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    charges(IdxSp(2)) = -1.;
+    charges(IdxSp(3)) = 1.;
+    charges(IdxSp(4)) = 2.;
+    Kokkos::Array<double, 3> const static_charges
+            = get_static_species_attribute<3>(get_const_field(charges));
+    EXPECT_EQ(static_charges[0], -1.);
+    EXPECT_EQ(static_charges[1], 1.);
+    EXPECT_EQ(static_charges[2], 2.);
+}
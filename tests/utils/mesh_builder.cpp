@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_aliases.hpp"
+#include "mesh_builder.hpp"
+
+namespace {
+
+struct X
+{
+};
+
+struct GridX : NonUniformGridBase<X>
+{
+};
+
+using CoordX = Coord<X>;
+using IdxStepX = IdxStep<GridX>;
+
+void check_increasing(std::vector<CoordX> const& break_points, CoordX min, CoordX max)
+{
+    EXPECT_EQ(break_points.front(), min);
+    EXPECT_EQ(break_points.back(), max);
+    for (std::size_t i(1); i < break_points.size(); ++i) {
+        EXPECT_GT(break_points[i], break_points[i - 1]);
+    }
+}
+
+} // namespace
+
+TEST(MeshBuilder, Tanh)
+{
+    CoordX const min(0.0);
+    CoordX const max(50.0);
+    IdxStepX const n_cells(64);
+    std::vector<CoordX> const break_points = build_tanh_break_points(min, max, n_cells, 2.0);
+
+    ASSERT_EQ(break_points.size(), 65u);
+    check_increasing(break_points, min, max);
+    // The mesh is symmetric and refined near the boundaries
+    for (int i(0); i < n_cells; ++i) {
+        EXPECT_NEAR(break_points[i] - min, max - break_points[n_cells - i], 1e-12);
+    }
+    double const boundary_cell = break_points[1] - break_points[0];
+    double const central_cell = break_points[33] - break_points[32];
+    EXPECT_LT(boundary_cell, central_cell);
+}
+
+TEST(MeshBuilder, Geometric)
+{
+    CoordX const min(-1.0);
+    CoordX const max(2.0);
+    IdxStepX const n_cells(20);
+    double const ratio = 1.1;
+    std::vector<CoordX> const break_points
+            = build_geometric_break_points(min, max, n_cells, ratio);
+
+    ASSERT_EQ(break_points.size(), 21u);
+    check_increasing(break_points, min, max);
+    for (int i(2); i < n_cells; ++i) {
+        double const cell = break_points[i] - break_points[i - 1];
+        double const previous_cell = break_points[i - 1] - break_points[i - 2];
+        EXPECT_NEAR(cell / previous_cell, ratio, 1e-12);
+    }
+}
+
+TEST(MeshBuilder, PiecewiseUniform)
+{
+    std::vector<CoordX> const zone_bounds {CoordX(-6.0), CoordX(-1.0), CoordX(1.0), CoordX(6.0)};
+    std::vector<int> const zone_ncells {10, 20, 10};
+    std::vector<CoordX> const break_points
+            = build_piecewise_uniform_break_points(zone_bounds, zone_ncells);
+
+    ASSERT_EQ(break_points.size(), 41u);
+    check_increasing(break_points, zone_bounds.front(), zone_bounds.back());
+    EXPECT_EQ(break_points[10], zone_bounds[1]);
+    EXPECT_EQ(break_points[30], zone_bounds[2]);
+    EXPECT_NEAR(break_points[1] - break_points[0], 0.5, 1e-12);
+    EXPECT_NEAR(break_points[11] - break_points[10], 0.1, 1e-12);
+}
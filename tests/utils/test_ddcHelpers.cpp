@@ -5,6 +5,7 @@
 
 #include "ddc_aliases.hpp"
 #include "ddc_helper.hpp"
+#include "idx_range_utils.hpp"
 
 namespace {
 
@@ -24,6 +25,14 @@ struct GridNonUniform : NonUniformGridBase<Tag>
 {
 };
 
+struct GridA
+{
+};
+
+struct GridB
+{
+};
+
 } // namespace
 
 TEST(DDCHelper, UniformPeriodicRestriction)
@@ -113,3 +122,22 @@ TEST(DDCHelper, NonUniformPeriodicRestriction)
         }
     }
 }
+
+TEST(DDCHelper, ToDiscreteElement)
+{
+    IdxRange<GridA> const idx_range_a(Idx<GridA>(2), IdxStep<GridA>(3));
+    IdxRange<GridB> const idx_range_b(Idx<GridB>(5), IdxStep<GridB>(4));
+    IdxRange<GridA, GridB> const idx_range(idx_range_a, idx_range_b);
+
+    // The last dimension is the fastest varying dimension
+    std::size_t idx = 0;
+    for (Idx<GridA> const ia : idx_range_a) {
+        for (Idx<GridB> const ib : idx_range_b) {
+            Idx<GridA, GridB> const elem = ddcHelper::to_discrete_element(idx, idx_range);
+            EXPECT_EQ(ddc::select<GridA>(elem), ia);
+            EXPECT_EQ(ddc::select<GridB>(elem), ib);
+            ++idx;
+        }
+    }
+    EXPECT_EQ(ddcHelper::to_discrete_element(0, IdxRange<>()), Idx<>());
+}
@@ -296,4 +296,46 @@ TEST(LayoutTransposition, Transpose3D)
     });
 }
 
+static void TestTiledTranspose3D_Device()
+{
+    // The sizes are not multiples of the tile size to check the partial tiles
+    IdxXYZ start_idx_range_origin(2, 3, 1);
+    IdxStepXYZ start_idx_range_size(5, 45, 70);
+    IdxRangeXYZ start_idx_range(start_idx_range_origin, start_idx_range_size);
+    IdxRangeZXY end_idx_range(start_idx_range);
+
+    device_t<DFieldMemXYZ> start_values_alloc(start_idx_range);
+    device_t<DFieldMemZXY> end_values_alloc(end_idx_range);
+
+    device_t<DFieldXYZ> start_values = get_field(start_values_alloc);
+    device_t<DFieldZXY> end_values = get_field(end_values_alloc);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            start_idx_range,
+            KOKKOS_LAMBDA(IdxXYZ ixyz) {
+                double coord_x = get_coordinate(ddc::select<GridX>(ixyz));
+                double coord_y = get_coordinate(ddc::select<GridY>(ixyz));
+                double coord_z = get_coordinate(ddc::select<GridZ>(ixyz));
+                start_values(ixyz) = coord_x + 10 * coord_y + 100 * coord_z;
+            });
+
+    transpose_layout(Kokkos::DefaultExecutionSpace(), end_values, get_const_field(start_values));
+
+    auto start_values_host = ddc::create_mirror_view_and_copy(get_const_field(start_values));
+    auto end_values_host = ddc::create_mirror_view_and_copy(get_const_field(end_values));
+
+    ddc::for_each(start_idx_range, [&](IdxXYZ ixyz) {
+        IdxX ix(ixyz);
+        IdxY iy(ixyz);
+        IdxZ iz(ixyz);
+        EXPECT_EQ(start_values_host(ix, iy, iz), end_values_host(ix, iy, iz));
+    });
+}
+
+TEST(LayoutTransposition, TiledTranspose3D_Device)
+{
+    TestTiledTranspose3D_Device();
+}
+
 } // namespace
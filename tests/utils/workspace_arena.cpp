@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+#include <cstddef>
+#include <cstdint>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
+#include "workspace_arena.hpp"
+
+namespace {
+
+struct X
+{
+};
+
+using GridX = UniformGridBase<X>;
+
+using IdxX = Idx<GridX>;
+using IdxStepX = IdxStep<GridX>;
+using IdxRangeX = IdxRange<GridX>;
+
+using HostArena = WorkspaceArena<Kokkos::HostSpace>;
+using HostArenaAllocator = ArenaAllocator<double, Kokkos::HostSpace>;
+using HostWorkspaceFieldMemX = FieldMem<double, IdxRangeX, HostArenaAllocator>;
+
+void fill_temporaries(HostArena& arena, IdxRangeX idx_range, double*& ptr_a, double*& ptr_b)
+{
+    HostArena::Scope const scope(arena);
+    HostWorkspaceFieldMemX a(idx_range, HostArenaAllocator(arena));
+    HostWorkspaceFieldMemX b(idx_range, HostArenaAllocator(arena));
+    ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), get_field(a), 1.);
+    ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), get_field(b), 2.);
+    {
+        // A nested scope reuses the memory after the memory of the enclosing scope
+        HostArena::Scope const nested_scope(arena);
+        HostWorkspaceFieldMemX c(idx_range, HostArenaAllocator(arena));
+        ddc::parallel_fill(Kokkos::DefaultHostExecutionSpace(), get_field(c), 3.);
+    }
+    for (IdxX const ix : idx_range) {
+        EXPECT_EQ(a(ix), 1.);
+        EXPECT_EQ(b(ix), 2.);
+    }
+    ptr_a = a.data_handle();
+    ptr_b = b.data_handle();
+}
+
+} // namespace
+
+TEST(WorkspaceArena, GrowsToHighWaterMark)
+{
+    IdxRangeX const idx_range(IdxX(0), IdxStepX(100));
+    std::size_t const aligned_size = (100 * sizeof(double) + HostArena::alignment - 1)
+                                     / HostArena::alignment * HostArena::alignment;
+
+    HostArena arena("test_arena");
+    EXPECT_EQ(arena.capacity(), std::size_t(0));
+
+    double* ptr_a;
+    double* ptr_b;
+    fill_temporaries(arena, idx_range, ptr_a, ptr_b);
+    EXPECT_EQ(arena.n_overflow_allocations(), 3);
+    EXPECT_EQ(arena.high_water_mark(), 3 * aligned_size);
+    EXPECT_EQ(arena.capacity(), 3 * aligned_size);
+
+    // Once the pool has grown the same allocations fit in it
+    fill_temporaries(arena, idx_range, ptr_a, ptr_b);
+    EXPECT_EQ(arena.n_overflow_allocations(), 3);
+    EXPECT_EQ(arena.capacity(), 3 * aligned_size);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr_a) % HostArena::alignment, 0u);
+    std::ptrdiff_t const distance = reinterpret_cast<char*>(ptr_b) - reinterpret_cast<char*>(ptr_a);
+    EXPECT_EQ(std::size_t(distance), aligned_size);
+
+    arena.release();
+    EXPECT_EQ(arena.capacity(), std::size_t(0));
+}
+
+TEST(WorkspaceArena, GrowsWhenOutermostScopeEnds)
+{
+    IdxRangeX const idx_range(IdxX(0), IdxStepX(100));
+    std::size_t const aligned_size = (100 * sizeof(double) + HostArena::alignment - 1)
+                                     / HostArena::alignment * HostArena::alignment;
+
+    HostArena arena("test_arena");
+    {
+        // A buffer living for the whole loop does not fit in the empty pool
+        HostArena::Scope const scope(arena);
+        HostWorkspaceFieldMemX buffer(idx_range, HostArenaAllocator(arena));
+        for (int i = 0; i < 2; ++i) {
+            HostArena::Scope const nested_scope(arena);
+            HostWorkspaceFieldMemX temporary(idx_range, HostArenaAllocator(arena));
+        }
+        // The pool is not resized while the buffer is held outside of it
+        EXPECT_EQ(arena.capacity(), std::size_t(0));
+    }
+    EXPECT_EQ(arena.capacity(), 2 * aligned_size);
+
+    arena.release();
+}
+
+TEST(WorkspaceArena, SharedArena)
+{
+    IdxRangeX const idx_range(IdxX(0), IdxStepX(10));
+    WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>& arena = get_workspace_arena();
+    {
+        WorkspaceArena<Kokkos::DefaultExecutionSpace::memory_space>::Scope const scope(arena);
+        DWorkspaceFieldMem<IdxRangeX> field(idx_range);
+        ddc::parallel_fill(get_field(field), 1.);
+        auto field_host = ddc::create_mirror_view_and_copy(get_field(field));
+        for (IdxX const ix : idx_range) {
+            EXPECT_EQ(field_host(ix), 1.);
+        }
+    }
+    EXPECT_GE(arena.capacity(), 10 * sizeof(double));
+}